@@ -421,7 +421,7 @@ class BestPractices : public vvl::DeviceProxy {
                                          const ErrorObject& error_obj) const override;
 
     using QueueCallback = std::function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state)>;
-    using QueueCallbacks = std::vector<QueueCallback>;
+    using QueueCallbacks = vvl::ArenaVector<QueueCallback>;
 
     void QueueValidateImageView(QueueCallbacks& func, const Location& loc, const vvl::ImageView& image_view,
                                 IMAGE_SUBRESOURCE_USAGE_BP usage);
@@ -574,6 +574,7 @@ class BestPractices : public vvl::DeviceProxy {
 
     void Created(vvl::CommandBuffer& cb_state) override;
     void Created(vvl::Image& image_state) override;
+    void ReportMemoryUsage(vvl::MemoryReport& report) override;
 
     // Check that vendor-specific checks are enabled for at least one of the vendors
     bool VendorCheckEnabled(BPVendorFlags vendors) const { return IsVendorCheckEnabled(enabled, vendors); }
@@ -611,6 +612,17 @@ class BestPractices : public vvl::DeviceProxy {
         uint32_t iteration = 0;
     };
 
+    // What ValidateIndexBufferArm needs to know about the indices of a draw, it only depends on their values
+    struct IndexBufferScan {
+        uint32_t min_index;
+        uint32_t max_index;
+        // Only counted when the index range is dense enough to be worth it
+        uint32_t vertex_shade_count;
+        uint32_t vertex_reference_count;
+    };
+    static IndexBufferScan ScanIndexBufferArm(const uint8_t* scan_begin, uint32_t index_count, VkIndexType index_type,
+                                              bool primitive_restart_enable);
+
     bool ValidateClearAttachment(const bp_state::CommandBufferSubState& cb_state, uint32_t fb_attachment, uint32_t color_attachment,
                                  VkImageAspectFlags aspects, const Location& loc) const;
 
@@ -659,6 +671,12 @@ class BestPractices : public vvl::DeviceProxy {
 
     vvl::unordered_set<VkPipeline> pipelines_used_in_frame_;
     mutable std::shared_mutex pipeline_lock_;
+
+    // ARM tracked
+    // Keyed on a hash of the indices of the draw, the index type and the primitive restart state
+    static constexpr size_t kMaxIndexBufferScans = 4096;
+    mutable vvl::unordered_map<size_t, IndexBufferScan> index_buffer_scans_;
+    mutable std::shared_mutex index_buffer_scans_lock_;
 };
 
 static inline bool RenderPassUsesAttachmentOnTile(const vku::safe_VkRenderPassCreateInfo2& create_info, uint32_t attachment) {
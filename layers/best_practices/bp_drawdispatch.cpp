@@ -23,7 +23,10 @@
 #include "state_tracker/last_bound_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/pipeline_state.h"
+#include "utils/hash_util.h"
 #include <bitset>
+#include <cstring>
+#include <limits>
 
 // Generic function to handle validation for all CmdDraw* type functions
 bool BestPractices::ValidateCmdDrawType(const bp_state::CommandBufferSubState& cb_state, const Location& loc) const {
@@ -50,8 +53,8 @@ bool BestPractices::ValidatePushConstants(const bp_state::CommandBufferSubState&
     for (const VkPushConstantRange& push_constant_range : *cb_state.base.push_constant_ranges_layout) {
         Range layout_range(push_constant_range.offset, push_constant_range.offset + push_constant_range.size);
         uint32_t size_not_set = push_constant_range.size;
-        for (const PushConstantData& filled_pcr : cb_state.push_constant_data_chunks) {
-            Range filled_range(filled_pcr.offset, filled_pcr.offset + static_cast<uint32_t>(filled_pcr.values.size()));
+        for (const auto& filled_pcr : cb_state.push_constant_data_chunks) {
+            Range filled_range(filled_pcr.offset, filled_pcr.offset + filled_pcr.size);
             Range intersection = layout_range & filled_range;
             if (intersection.valid()) {
                 size_not_set -= std::min(intersection.distance(), size_not_set);
@@ -169,6 +172,101 @@ bool BestPractices::PostTransformLRUCacheModel::query_cache(uint32_t value) {
     return false;
 }
 
+// Kept free of branches and of the post-transform cache model so the compiler can vectorize it
+template <typename IndexType>
+static void GetIndexRange(const uint8_t* scan_begin, uint32_t index_count, uint32_t& min_index, uint32_t& max_index) {
+    IndexType min_value = std::numeric_limits<IndexType>::max();
+    IndexType max_value = 0;
+    for (uint32_t i = 0; i < index_count; i++) {
+        // Index buffer offset only needs to be a multiple of the index size, memcpy handles unaligned memory
+        IndexType value;
+        memcpy(&value, scan_begin + i * sizeof(IndexType), sizeof(IndexType));
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+    }
+    min_index = index_count > 0 ? min_value : ~0u;
+    max_index = max_value;
+}
+
+BestPractices::IndexBufferScan BestPractices::ScanIndexBufferArm(const uint8_t* scan_begin, uint32_t index_count,
+                                                                 VkIndexType index_type, bool primitive_restart_enable) {
+    IndexBufferScan scan = {};
+
+    // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
+    // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
+    // irrespective of whether or not they're part of the draw call.
+    uint32_t primitive_restart_value;
+    if (index_type == VK_INDEX_TYPE_UINT8) {
+        GetIndexRange<uint8_t>(scan_begin, index_count, scan.min_index, scan.max_index);
+        primitive_restart_value = 0xFF;
+    } else if (index_type == VK_INDEX_TYPE_UINT16) {
+        GetIndexRange<uint16_t>(scan_begin, index_count, scan.min_index, scan.max_index);
+        primitive_restart_value = 0xFFFF;
+    } else {
+        GetIndexRange<uint32_t>(scan_begin, index_count, scan.min_index, scan.max_index);
+        primitive_restart_value = 0xFFFFFFFF;
+    }
+
+    // Nothing else is reported for those, don't go through the indices again
+    if (scan.max_index <= scan.min_index || scan.max_index - scan.min_index >= index_count) {
+        return scan;
+    }
+
+    // Simulate a model LRU post-transform cache, estimating the number of vertices shaded for the given index buffer
+    PostTransformLRUCacheModel post_transform_cache;
+
+    // The size of the cache being modelled positively correlates with how much behaviour it can capture about
+    // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
+    // target architecture.
+    // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
+    // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
+    post_transform_cache.resize(32);
+
+    // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
+    // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
+    const size_t refs_per_bucket = 64;
+    std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
+
+    const uint32_t n_indices = scan.max_index - scan.min_index + 1;
+    const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
+                               ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
+
+    // there needs to be at least one bitset to store a set of indices smaller than n_buckets
+    vertex_reference_buckets.resize(std::max(1u, n_buckets));
+
+    // Knowing the range from the first scan allows us to record index usage with bitsets
+    const uint32_t scan_stride = IndexTypeByteSize(index_type);
+    const uint8_t* scan_end = scan_begin + index_count * scan_stride;
+    for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
+        uint32_t scan_index;
+        if (index_type == VK_INDEX_TYPE_UINT8) {
+            scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
+        } else if (index_type == VK_INDEX_TYPE_UINT16) {
+            scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
+        } else {
+            scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
+        }
+
+        if (!primitive_restart_enable || scan_index != primitive_restart_value) {
+            const bool in_cache = post_transform_cache.query_cache(scan_index);
+            // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
+            if (!in_cache) scan.vertex_shade_count++;
+        }
+
+        // keep track of the set of all indices used to reference vertices in the draw call
+        size_t index_offset = scan_index - scan.min_index;
+        size_t bitset_bucket_index = index_offset / refs_per_bucket;
+        uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
+        vertex_reference_buckets[bitset_bucket_index] |= used_indices;
+    }
+
+    for (const auto& bitset : vertex_reference_buckets) {
+        scan.vertex_reference_count += static_cast<uint32_t>(bitset.count());
+    }
+
+    return scan;
+}
+
 bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBufferSubState& cb_state, uint32_t indexCount,
                                            uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset,
                                            uint32_t firstInstance, const Location& loc) const {
@@ -200,54 +298,36 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBufferSubState
             return skip;
         }
         const uint8_t* scan_begin = static_cast<const uint8_t*>(ib_mem) + firstIndex * scan_stride;
-        const uint8_t* scan_end = scan_begin + indexCount * scan_stride;
-
-        // Min and max are important to track for some Mali architectures. In older Mali devices without IDVS, all
-        // vertices corresponding to indices between the minimum and maximum may be loaded, and possibly shaded,
-        // irrespective of whether or not they're part of the draw call.
-
-        // start with minimum as 0xFFFFFFFF and adjust to indices in the buffer
-        uint32_t min_index = ~0u;
-        // start with maximum as 0 and adjust to indices in the buffer
-        uint32_t max_index = 0u;
-
-        // first scan-through, we're looking to simulate a model LRU post-transform cache, estimating the number of vertices shaded
-        // for the given index buffer
-        uint32_t vertex_shade_count = 0;
-
-        PostTransformLRUCacheModel post_transform_cache;
-
-        // The size of the cache being modelled positively correlates with how much behaviour it can capture about
-        // arbitrary ground-truth hardware/architecture cache behaviour. I.e. it's a good solution when we don't know the
-        // target architecture.
-        // However, modelling a post-transform cache with more than 32 elements gives diminishing returns in practice.
-        // http://eelpi.gotdns.org/papers/fast_vert_cache_opt.html
-        post_transform_cache.resize(32);
-
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            uint32_t primitive_restart_value;
-            if (ib_type == VK_INDEX_TYPE_UINT8) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-                primitive_restart_value = 0xFF;
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFF;
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-                primitive_restart_value = 0xFFFFFFFF;
-            }
 
-            max_index = std::max(max_index, scan_index);
-            min_index = std::min(min_index, scan_index);
-
-            if (!primitive_restart_enable || scan_index != primitive_restart_value) {
-                const bool in_cache = post_transform_cache.query_cache(scan_index);
-                // if the shaded vertex corresponding to the index is not in the PT-cache, we need to shade again
-                if (!in_cache) vertex_shade_count++;
+        // The scan only depends on the index values, so static meshes drawn every frame are looked up by hashing their
+        // indices. Hashing is a lot cheaper than modelling the post-transform cache, and unlike tracking the buffer and
+        // its memory it can't miss a host write to mapped memory.
+        const size_t scan_key = hash_util::HashCombiner(hash_util::Hash64(scan_begin, size_t(indexCount) * scan_stride))
+                                    .Combine(ib_type)
+                                    .Combine(primitive_restart_enable)
+                                    .Value();
+        IndexBufferScan scan;
+        bool scan_found = false;
+        {
+            ReadLockGuard guard(index_buffer_scans_lock_);
+            auto scan_it = index_buffer_scans_.find(scan_key);
+            if (scan_it != index_buffer_scans_.end()) {
+                scan = scan_it->second;
+                scan_found = true;
+            }
+        }
+        if (!scan_found) {
+            scan = ScanIndexBufferArm(scan_begin, indexCount, ib_type, primitive_restart_enable);
+            WriteLockGuard guard(index_buffer_scans_lock_);
+            if (index_buffer_scans_.size() >= kMaxIndexBufferScans) {
+                index_buffer_scans_.clear();
             }
+            index_buffer_scans_.emplace(scan_key, scan);
         }
 
+        const uint32_t min_index = scan.min_index;
+        const uint32_t max_index = scan.max_index;
+
         // if the max and min values were not set, then we either have no indices, or all primitive restarts, exit...
         // if the max and min are the same, then it implies all the indices are the same, then we don't need to do anything
         if (max_index < min_index || max_index == min_index) return skip;
@@ -264,45 +344,10 @@ bool BestPractices::ValidateIndexBufferArm(const bp_state::CommandBufferSubState
             return skip;
         }
 
-        // use a dynamic vector of bitsets as a memory-compact representation of which indices are included in the draw call
-        // each bit of the n-th bucket contains the inclusion information for indices (n*n_buckets) to ((n+1)*n_buckets)
-        const size_t refs_per_bucket = 64;
-        std::vector<std::bitset<refs_per_bucket>> vertex_reference_buckets;
-
-        const uint32_t n_indices = max_index - min_index + 1;
-        const uint32_t n_buckets = (n_indices / static_cast<uint32_t>(refs_per_bucket)) +
-                                   ((n_indices % static_cast<uint32_t>(refs_per_bucket)) != 0 ? 1 : 0);
-
-        // there needs to be at least one bitset to store a set of indices smaller than n_buckets
-        vertex_reference_buckets.resize(std::max(1u, n_buckets));
-
-        // To avoid using too much memory, we run over the indices again.
-        // Knowing the size from the last scan allows us to record index usage with bitsets
-        for (const uint8_t* scan_ptr = scan_begin; scan_ptr < scan_end; scan_ptr += scan_stride) {
-            uint32_t scan_index;
-            if (ib_type == VK_INDEX_TYPE_UINT8) {
-                scan_index = *reinterpret_cast<const uint8_t*>(scan_ptr);
-            } else if (ib_type == VK_INDEX_TYPE_UINT16) {
-                scan_index = *reinterpret_cast<const uint16_t*>(scan_ptr);
-            } else {
-                scan_index = *reinterpret_cast<const uint32_t*>(scan_ptr);
-            }
-            // keep track of the set of all indices used to reference vertices in the draw call
-            size_t index_offset = scan_index - min_index;
-            size_t bitset_bucket_index = index_offset / refs_per_bucket;
-            uint64_t used_indices = 1ull << ((index_offset % refs_per_bucket) & 0xFFFFFFFFu);
-            vertex_reference_buckets[bitset_bucket_index] |= used_indices;
-        }
-
-        uint32_t vertex_reference_count = 0;
-        for (const auto& bitset : vertex_reference_buckets) {
-            vertex_reference_count += static_cast<uint32_t>(bitset.count());
-        }
-
         // low index buffer utilization implies that: of the vertices available to the draw call, not all are utilized
-        float utilization = static_cast<float>(vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
+        float utilization = static_cast<float>(scan.vertex_reference_count) / static_cast<float>(max_index - min_index + 1);
         // low hit rate (high miss rate) implies the order of indices in the draw call may be possible to improve
-        float cache_hit_rate = static_cast<float>(vertex_reference_count) / static_cast<float>(vertex_shade_count);
+        float cache_hit_rate = static_cast<float>(scan.vertex_reference_count) / static_cast<float>(scan.vertex_shade_count);
 
         if (utilization < 0.5f) {
             skip |= LogPerformanceWarning("BestPractices-Arm-vkCmdDrawIndexed-sparse-index-buffer", device, loc,
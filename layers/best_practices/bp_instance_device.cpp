@@ -23,6 +23,8 @@
 #include "state_tracker/event_state.h"
 #include "state_tracker/queue_state.h"
 #include "state_tracker/device_state.h"
+#include "profiling/api_timing.h"
+#include "profiling/memory_report.h"
 
 bool bp_state::Instance::ValidateSpecialUseExtensions(const Location& loc, vvl::Extension extension) const {
     bool skip = false;
@@ -210,6 +212,48 @@ WriteLockGuard BestPractices::WriteLock() {
     return WriteLockGuard(validation_object_mutex, std::defer_lock);
 }
 
+void BestPractices::ReportMemoryUsage(vvl::MemoryReport& report) {
+    using vvl::MemoryReport;
+    const char* owner = vvl::String(container_type);
+
+    uint64_t cb_count = 0;
+    uint64_t cb_bytes = 0;
+    device_state->ForEachShared<vvl::CommandBuffer>([&cb_count, &cb_bytes](const std::shared_ptr<vvl::CommandBuffer>& cb) {
+        auto guard = cb->ReadLock();
+        cb_bytes += bp_state::SubState(*cb).HeapMemoryUsage();
+        cb_count++;
+    });
+    report.Add(owner, "CommandBuffer", cb_count, cb_bytes);
+
+    // The usages are sized when the image is created
+    uint64_t image_count = 0;
+    uint64_t image_bytes = 0;
+    device_state->ForEachShared<vvl::Image>([&image_count, &image_bytes](const std::shared_ptr<vvl::Image>& image) {
+        image_bytes += bp_state::SubState(*image).HeapMemoryUsage();
+        image_count++;
+    });
+    report.Add(owner, "ImageUsages", image_count, image_bytes);
+
+    {
+        ReadLockGuard guard(pipeline_lock_);
+        report.Add(owner, "PipelinesUsedInFrame", pipelines_used_in_frame_.size(),
+                   MemoryReport::MapBytes(pipelines_used_in_frame_));
+    }
+    {
+        ReadLockGuard guard(index_buffer_scans_lock_);
+        report.Add(owner, "IndexBufferScans", index_buffer_scans_.size(), MemoryReport::MapBytes(index_buffer_scans_));
+    }
+    {
+        ReadLockGuard guard(clear_colors_lock_);
+        report.Add(owner, "ClearColors", clear_colors_.size(),
+                   clear_colors_.size() * (sizeof(*clear_colors_.begin()) + MemoryReport::kNodeOverhead));
+    }
+    {
+        ReadLockGuard guard(memory_free_events_lock_);
+        report.Add(owner, "MemoryFreeEvents", memory_free_events_.size(), memory_free_events_.size() * sizeof(MemoryFreeEvent));
+    }
+}
+
 void BestPractices::PreCallRecordQueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo* pSubmits, VkFence fence,
                                              const RecordObject& record_obj) {
     auto queue_state = Get<vvl::Queue>(queue);
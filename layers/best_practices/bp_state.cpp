@@ -21,6 +21,7 @@
 #include "best_practices/best_practices_validation.h"
 #include "containers/container_utils.h"
 #include "generated/error_location_helper.h"
+#include "profiling/memory_report.h"
 #include "state_tracker/queue_state.h"
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/pipeline_state.h"
@@ -65,6 +66,14 @@ uint32_t ImageSubState::GetLastQueueFamily(uint32_t array_layer, uint32_t mip_le
     return GetUsage(array_layer, mip_level).queue_family_index;
 }
 
+size_t ImageSubState::HeapMemoryUsage() const {
+    size_t bytes = vvl::MemoryReport::VectorBytes(usages_);
+    for (const auto& mip_usages : usages_) {
+        bytes += vvl::MemoryReport::VectorBytes(mip_usages);
+    }
+    return bytes;
+}
+
 void ImageSubState::SetupUsages() {
     usages_.resize(base.GetArrayLayers());
     for (auto& mip_vec : usages_) {
@@ -73,7 +82,11 @@ void ImageSubState::SetupUsages() {
 }
 
 CommandBufferSubState::CommandBufferSubState(vvl::CommandBuffer& cb, BestPractices& validator)
-    : vvl::CommandBufferSubState(cb), validator(validator) {}
+    : vvl::CommandBufferSubState(cb),
+      validator(validator),
+      push_constant_data_chunks(vvl::ArenaAllocator<PushConstantChunk>(cb.arena)),
+      queue_submit_functions(vvl::ArenaAllocator<QueueCallback>(cb.arena)),
+      queue_submit_functions_after_render_pass(vvl::ArenaAllocator<QueueCallback>(cb.arena)) {}
 
 void CommandBufferSubState::RecordExecuteCommand(vvl::CommandBuffer& secondary_command_buffer, uint32_t, const Location&) {
     auto& secondary_sub_state = SubState(secondary_command_buffer);
@@ -110,16 +123,9 @@ void CommandBufferSubState::RecordExecuteCommand(vvl::CommandBuffer& secondary_c
     }
 }
 
-void CommandBufferSubState::RecordPushConstants(VkPipelineLayout layout, VkShaderStageFlags stage_flags, uint32_t offset,
-                                                uint32_t size, const void* values) {
-    PushConstantData push_constant_data;
-    push_constant_data.layout = layout;
-    push_constant_data.stage_flags = stage_flags;
-    push_constant_data.offset = offset;
-    push_constant_data.values.resize(size);
-    auto byte_values = static_cast<const std::byte*>(values);
-    std::copy(byte_values, byte_values + size, push_constant_data.values.data());
-    push_constant_data_chunks.emplace_back(push_constant_data);
+void CommandBufferSubState::RecordPushConstants(VkPipelineLayout, VkShaderStageFlags, uint32_t offset, uint32_t size,
+                                                const void*) {
+    push_constant_data_chunks.emplace_back(PushConstantChunk{offset, size});
 }
 
 void CommandBufferSubState::ClearPushConstants() { push_constant_data_chunks.clear(); }
@@ -595,12 +601,29 @@ void CommandBufferSubState::Destroy() { ResetCBState(); }
 
 void CommandBufferSubState::Reset(const Location&) { ResetCBState(); }
 
+size_t CommandBufferSubState::HeapMemoryUsage() const {
+    using vvl::MemoryReport;
+    // The vectors in the arena of the command buffer are counted with it
+    size_t bytes = MemoryReport::VectorBytes(render_pass_state.earlyClearAttachments) +
+             MemoryReport::VectorBytes(render_pass_state.touchesAttachments) +
+             MemoryReport::VectorBytes(render_pass_state.nextDrawTouchesAttachments);
+    for (const auto& clear_info : render_pass_state.earlyClearAttachments) {
+        bytes += MemoryReport::VectorBytes(clear_info.rects);
+    }
+    bytes += MemoryReport::MapBytes(nv.zcull_per_image);
+    for (const auto& [image, zcull_tree] : nv.zcull_per_image) {
+        bytes += MemoryReport::VectorBytes(zcull_tree.states);
+    }
+    bytes += MemoryReport::MapBytes(event_signaling_state);
+    return bytes;
+}
+
 void CommandBufferSubState::ResetCBState() {
     num_submits = 0;
     small_indexed_draw_call_count = 0;
-    queue_submit_functions.clear();
-    queue_submit_functions_after_render_pass.clear();
-    ClearPushConstants();
+    vvl::ReleaseArenaVector(queue_submit_functions);
+    vvl::ReleaseArenaVector(queue_submit_functions_after_render_pass);
+    vvl::ReleaseArenaVector(push_constant_data_chunks);
 }
 
 void CommandBufferSubState::RecordActionCommand(LastBound& last_bound, const Location& loc) {
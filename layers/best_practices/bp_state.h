@@ -26,7 +26,6 @@
 #include "state_tracker/cmd_buffer_state.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/descriptor_sets.h"
-#include "state_tracker/push_constant_data.h"
 
 class BestPractices;
 
@@ -45,6 +44,8 @@ class ImageSubState : public vvl::ImageSubState {
     Usage GetUsage(uint32_t array_layer, uint32_t mip_level) const;
     IMAGE_SUBRESOURCE_USAGE_BP GetUsageType(uint32_t array_layer, uint32_t mip_level) const;
     uint32_t GetLastQueueFamily(uint32_t array_layer, uint32_t mip_level) const;
+    // For the memory_report_frames setting
+    size_t HeapMemoryUsage() const;
 
     std::array<bool, vvl::Image::kMaxPlanes> memory_requirements_checked = {};
 
@@ -156,7 +157,15 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     uint64_t num_submits = 0;
     uint32_t small_indexed_draw_call_count = 0;
 
-    std::vector<PushConstantData> push_constant_data_chunks;
+    // The containers filled while recording are in the arena of the command buffer, ResetCBState() releases them before it is
+    // reset. The render pass state keeps its capacity from one render pass to the next and stays on the heap.
+
+    // Ranges set with vkCmdPushConstants, only their extent is checked so the values are not kept
+    struct PushConstantChunk {
+        uint32_t offset;
+        uint32_t size;
+    };
+    vvl::ArenaVector<PushConstantChunk> push_constant_data_chunks;
 
     // This function used to not be empty. It has been left empty because
     // the logic to decide to call this function is not simple, so adding this
@@ -165,6 +174,8 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
 
     void Destroy() final;
     void Reset(const Location& loc) final;
+    // For the memory_report_frames setting
+    size_t HeapMemoryUsage() const;
 
     void RecordExecuteCommand(vvl::CommandBuffer& secondary_command_buffer, uint32_t cmd_index, const Location& loc) final;
     void RecordActionCommand(LastBound& last_bound, const Location& loc) final;
@@ -248,10 +259,10 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
     vvl::unordered_map<VkEvent, SignalingInfo> event_signaling_state;
 
     using QueueCallback = std::function<bool(const class vvl::Queue& queue_state, const vvl::CommandBuffer& cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
+    vvl::ArenaVector<QueueCallback> queue_submit_functions;
     // Used by some layers to defer actions until vkCmdEndRenderPass time.
     // Layers using this are responsible for inserting the callbacks into queue_submit_functions.
-    std::vector<QueueCallback> queue_submit_functions_after_render_pass;
+    vvl::ArenaVector<QueueCallback> queue_submit_functions_after_render_pass;
 
     void RecordBindZcullScopeNV(VkImage depth_attachment, const VkImageSubresourceRange& subresource_range);
     void RecordUnbindZcullScopeNV();
@@ -31,6 +31,7 @@
 #include "chassis/chassis_modification_state.h"
 #include "core_checks/core_validation.h"
 #include "profiling/profiling.h"
+#include "profiling/api_timing.h"
 #include "containers/small_vector.h"
 #include "utils/dispatch_utils.h"
 
@@ -221,6 +222,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateInstance, vo->container_type);
         skip |= vo->PreCallValidateCreateInstance(pCreateInfo, pAllocator, pInstance, error_obj);
         if (skip) {
             return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -232,6 +234,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateInstance, vo->container_type);
         vo->PreCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
     }
 
@@ -261,6 +264,10 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
     InstanceExtensionWhitelist(instance_dispatch.get(), pCreateInfo, *pInstance, loc);
     instance_dispatch->FindSupportedExtensions();
 
+    if (!instance_dispatch->settings.global_settings.api_timing_file.empty()) {
+        vvl::ApiTimer::Start(instance_dispatch->settings.global_settings.api_timing_file);
+    }
+
     // save a raw pointer since the unique_ptr will be invalidate by the move() below
     auto* id = instance_dispatch.get();
     vvl::SetDispatchInstance(*pInstance, std::move(instance_dispatch));
@@ -269,6 +276,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreat
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateInstance, vo->container_type);
         vo->PostCallRecordCreateInstance(pCreateInfo, pAllocator, pInstance, record_obj);
         vo->CopyExtensions();
     }
@@ -289,6 +297,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkDestroyInstance, vo->container_type);
         vo->PreCallValidateDestroyInstance(instance, pAllocator, error_obj);
     }
     vvl::BaseInstance* state_tracker = nullptr;
@@ -301,6 +310,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
             state_tracker = vo.get();
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkDestroyInstance, vo->container_type);
         vo->PreCallRecordDestroyInstance(instance, pAllocator, record_obj);
     }
     if (state_tracker) {
@@ -320,6 +330,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
         if (vo->container_type == LayerObjectTypeStateTracker) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkDestroyInstance, vo->container_type);
         vo->PostCallRecordDestroyInstance(instance, pAllocator, record_obj);
     }
     if (state_tracker) {
@@ -327,7 +338,11 @@ VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocati
     }
 
     DeactivateInstanceDebugCallbacks(instance_dispatch->debug_report);
+    const bool api_timing = !instance_dispatch->settings.global_settings.api_timing_file.empty();
     vvl::FreeDispatchInstance(key);
+    if (api_timing) {
+        vvl::ApiTimer::Stop();
+    }
 
     VVL_TracyCZoneEnd(tracy_zone_postcall);
 
@@ -368,6 +383,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateDevice, vo->container_type);
         skip |= vo->PreCallValidateCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, error_obj);
         if (skip) {
             return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -383,6 +399,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateDevice, vo->container_type);
         vo->PreCallRecordCreateDevice(gpu, pCreateInfo, pAllocator, pDevice, record_obj, &modified_create_info);
     }
 
@@ -428,6 +445,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDevice
             continue;
         }
         // Send down modified create info as we want to mark enabled features that we sent down on behalf of the app
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateDevice, vo->container_type);
         vo->PostCallRecordCreateDevice(gpu, modified_create_info.ptr(), pAllocator, pDevice, record_obj);
     }
     // Note: device_dispatch is no longer valid since it was a std::move source above.
@@ -449,10 +467,15 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     auto* key = GetDispatchKey(device);
     auto device_dispatch = vvl::GetDispatchDevice(device);
     ErrorObject error_obj(vvl::Func::vkDestroyDevice, VulkanTypedHandle(device, kVulkanObjectTypeDevice));
+    device_dispatch->ReportValidationSamplingCoverage();
+    if (device_dispatch->settings.global_settings.memory_report_frames != 0) {
+        device_dispatch->ReportMemoryUsage(error_obj.location);
+    }
     for (const auto& vo : device_dispatch->object_dispatch) {
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkDestroyDevice, vo->container_type);
         vo->PreCallValidateDestroyDevice(device, pAllocator, error_obj);
     }
     RecordObject record_obj(vvl::Func::vkDestroyDevice);
@@ -466,6 +489,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
             continue;
         }
 
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkDestroyDevice, vo->container_type);
         vo->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
     }
     // Before device is destroyed, allow aborted objects to clean up
@@ -473,6 +497,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkDestroyDevice, vo->container_type);
         vo->PreCallRecordDestroyDevice(device, pAllocator, record_obj);
     }
 
@@ -496,12 +521,14 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
             state_tracker = vo.get();
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkDestroyDevice, vo->container_type);
         vo->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
     }
     for (auto& vo : device_dispatch->aborted_object_dispatch) {
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkDestroyDevice, vo->container_type);
         vo->PostCallRecordDestroyDevice(device, pAllocator, record_obj);
     }
     if (state_tracker) {
@@ -535,6 +562,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateGraphicsPipelines, vo->container_type);
             skip |= vo->PreCallValidateCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                pPipelines, error_obj, pipeline_states, chassis_state);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -549,6 +577,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateGraphicsPipelines, vo->container_type);
             vo->PreCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
                                                      record_obj, pipeline_states, chassis_state);
         }
@@ -557,6 +586,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateGraphicsPipelines");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateGraphicsPipelines, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateGraphicsPipelines(device, pipelineCache, createInfoCount, chassis_state.pCreateInfos,
                                                           pAllocator, pPipelines);
 
@@ -576,6 +606,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateGraphicsPipelines, vo->container_type);
             vo->PostCallRecordCreateGraphicsPipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
                                                       record_obj, pipeline_states, chassis_state);
         }
@@ -603,6 +634,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateComputePipelines, vo->container_type);
             skip |= vo->PreCallValidateCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                               pPipelines, error_obj, pipeline_states, chassis_state);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -617,6 +649,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateComputePipelines, vo->container_type);
             vo->PreCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
                                                     record_obj, pipeline_states, chassis_state);
         }
@@ -625,6 +658,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateComputePipelines");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateComputePipelines, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateComputePipelines(device, pipelineCache, createInfoCount, chassis_state.pCreateInfos,
                                                          pAllocator, pPipelines);
         // If we have modified the pCreateInfos caused things to fail, revert to allow the app to continue
@@ -643,6 +677,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, VkPipelin
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateComputePipelines, vo->container_type);
             vo->PostCallRecordCreateComputePipelines(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
                                                      record_obj, pipeline_states, chassis_state);
         }
@@ -664,6 +699,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(VkDevice device, VkPi
             continue;
         }
         auto lock = vo->ReadLock();
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateRayTracingPipelinesNV, vo->container_type);
         skip |= vo->PreCallValidateCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator,
                                                                pPipelines, error_obj, pipeline_states);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
@@ -675,6 +711,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(VkDevice device, VkPi
             continue;
         }
         auto lock = vo->WriteLock();
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateRayTracingPipelinesNV, vo->container_type);
         vo->PreCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
                                                      record_obj, pipeline_states);
     }
@@ -689,6 +726,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(VkDevice device, VkPi
             continue;
         }
         auto lock = vo->WriteLock();
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateRayTracingPipelinesNV, vo->container_type);
         vo->PostCallRecordCreateRayTracingPipelinesNV(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines,
                                                       record_obj, pipeline_states);
     }
@@ -715,6 +753,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateRayTracingPipelinesKHR, vo->container_type);
             skip |= vo->PreCallValidateCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                     pCreateInfos, pAllocator, pPipelines, error_obj,
                                                                     pipeline_states, *chassis_state);
@@ -730,6 +769,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateRayTracingPipelinesKHR, vo->container_type);
             vo->PreCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                           pAllocator, pPipelines, record_obj, pipeline_states, *chassis_state);
         }
@@ -738,6 +778,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateRayTracingPipelinesKHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateRayTracingPipelinesKHR, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount,
                                                                chassis_state->pCreateInfos, pAllocator, pPipelines);
 
@@ -758,6 +799,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice device, VkD
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateRayTracingPipelinesKHR, vo->container_type);
             vo->PostCallRecordCreateRayTracingPipelinesKHR(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                            pAllocator, pPipelines, record_obj, pipeline_states, chassis_state);
         }
@@ -783,6 +825,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelinesARM(VkDevice device, VkDe
         VVL_ZoneScopedN("PreCallValidate");
         for (const auto& vo : device_dispatch->object_dispatch) {
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateDataGraphPipelinesARM, vo->container_type);
             skip |= vo->PreCallValidateCreateDataGraphPipelinesARM(device, deferredOperation, pipelineCache, createInfoCount,
                                                                    pCreateInfos, pAllocator, pPipelines, error_obj, pipeline_states,
                                                                    chassis_state);
@@ -795,6 +838,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelinesARM(VkDevice device, VkDe
         VVL_ZoneScopedN("PreCallRecord");
         for (auto& vo : device_dispatch->object_dispatch) {
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateDataGraphPipelinesARM, vo->container_type);
             vo->PreCallRecordCreateDataGraphPipelinesARM(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                          pAllocator, pPipelines, record_obj, pipeline_states, chassis_state);
         }
@@ -803,6 +847,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelinesARM(VkDevice device, VkDe
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateDataGraphPipelinesARM, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateDataGraphPipelinesARM(device, deferredOperation, pipelineCache, createInfoCount,
                                                               chassis_state.pCreateInfos, pAllocator, pPipelines);
     }
@@ -812,6 +857,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelinesARM(VkDevice device, VkDe
         VVL_ZoneScopedN("PostCallRecord");
         for (auto& vo : device_dispatch->object_dispatch) {
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateDataGraphPipelinesARM, vo->container_type);
             vo->PostCallRecordCreateDataGraphPipelinesARM(device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos,
                                                           pAllocator, pPipelines, record_obj, pipeline_states, chassis_state);
         }
@@ -835,6 +881,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreatePipelineLayout, vo->container_type);
             skip |= vo->PreCallValidateCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -851,6 +898,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreatePipelineLayout, vo->container_type);
             vo->PreCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj, chassis_state);
         }
     }
@@ -858,6 +906,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreatePipelineLayout");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreatePipelineLayout, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreatePipelineLayout(device, &chassis_state.modified_create_info, pAllocator, pPipelineLayout);
     }
     record_obj.result = result;
@@ -869,6 +918,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPip
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreatePipelineLayout, vo->container_type);
             vo->PostCallRecordCreatePipelineLayout(device, pCreateInfo, pAllocator, pPipelineLayout, record_obj);
         }
     }
@@ -888,6 +938,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkGetShaderBinaryDataEXT, vo->container_type);
             skip |= vo->PreCallValidateGetShaderBinaryDataEXT(device, shader, pDataSize, pData, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -903,12 +954,14 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkGetShaderBinaryDataEXT, vo->container_type);
             vo->PreCallRecordGetShaderBinaryDataEXT(device, shader, pDataSize, pData, record_obj, chassis_state);
         }
     }
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_vkGetShaderBinaryDataEXT");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkGetShaderBinaryDataEXT, LayerObjectTypeMaxEnum);
         result = device_dispatch->GetShaderBinaryDataEXT(device, chassis_state.modified_shader_handle, pDataSize, pData);
     }
     record_obj.result = result;
@@ -919,6 +972,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderE
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkGetShaderBinaryDataEXT, vo->container_type);
             vo->PostCallRecordGetShaderBinaryDataEXT(device, shader, pDataSize, pData, record_obj);
         }
     }
@@ -941,6 +995,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateShaderModule, vo->container_type);
             skip |= vo->PreCallValidateCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -956,6 +1011,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateShaderModule, vo->container_type);
             vo->PreCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
         }
     }
@@ -965,6 +1021,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateShaderModule");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateShaderModule, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule);
     }
     record_obj.result = result;
@@ -975,6 +1032,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShade
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateShaderModule, vo->container_type);
             vo->PostCallRecordCreateShaderModule(device, pCreateInfo, pAllocator, pShaderModule, record_obj, chassis_state);
         }
     }
@@ -999,6 +1057,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateShadersEXT, vo->container_type);
             skip |= vo->PreCallValidateCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -1012,6 +1071,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateShadersEXT, vo->container_type);
             vo->PreCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                               chassis_state);
         }
@@ -1023,6 +1083,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateShadersEXT");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateShadersEXT, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateShadersEXT(device, createInfoCount, chassis_state.pCreateInfos, pAllocator, pShaders);
 
         // If we have modified the pCreateInfos caused things to fail, revert to allow the app to continue
@@ -1040,6 +1101,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t create
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateShadersEXT, vo->container_type);
             vo->PostCallRecordCreateShadersEXT(device, createInfoCount, pCreateInfos, pAllocator, pShaders, record_obj,
                                                chassis_state);
         }
@@ -1067,6 +1129,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkAllocateDescriptorSets, vo->container_type);
             skip |= vo->PreCallValidateAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, error_obj, ads_state);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -1080,6 +1143,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkAllocateDescriptorSets, vo->container_type);
             vo->PreCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj);
         }
     }
@@ -1087,6 +1151,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_AllocateDescriptorSets");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkAllocateDescriptorSets, LayerObjectTypeMaxEnum);
         result = device_dispatch->AllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets);
     }
     record_obj.result = result;
@@ -1098,6 +1163,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkD
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkAllocateDescriptorSets, vo->container_type);
             vo->PostCallRecordAllocateDescriptorSets(device, pAllocateInfo, pDescriptorSets, record_obj, ads_state);
         }
     }
@@ -1120,6 +1186,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCreateBuffer, vo->container_type);
             skip |= vo->PreCallValidateCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -1136,6 +1203,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCreateBuffer, vo->container_type);
             vo->PreCallRecordCreateBuffer(device, pCreateInfo, pAllocator, pBuffer, record_obj, chassis_state);
         }
     }
@@ -1143,6 +1211,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_CreateBuffer");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCreateBuffer, LayerObjectTypeMaxEnum);
         result = device_dispatch->CreateBuffer(device, chassis_state.create_info_copy, pAllocator, pBuffer);
     }
     record_obj.result = result;
@@ -1155,6 +1224,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBufferCreat
             }
             auto lock = vo->WriteLock();
             // If we don't pass into PostCallRecord, CoreCheck may give false positives when using GPU-AV
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCreateBuffer, vo->container_type);
             vo->PostCallRecordCreateBuffer(device, chassis_state.create_info_copy, pAllocator, pBuffer, record_obj);
         }
     }
@@ -1175,6 +1245,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkQueuePresentKHR, vo->container_type);
             skip |= vo->PreCallValidateQueuePresentKHR(queue, pPresentInfo, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -1187,6 +1258,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkQueuePresentKHR, vo->container_type);
             vo->PreCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
         }
     }
@@ -1204,8 +1276,15 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_QueuePresentKHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkQueuePresentKHR, LayerObjectTypeMaxEnum);
         result = device_dispatch->QueuePresentKHR(queue, pPresentInfo);
     }
+    if (device_dispatch->validation_sampling_period > 1) {
+        device_dispatch->SampleFrame();
+    }
+    if (device_dispatch->settings.global_settings.memory_report_frames != 0) {
+        device_dispatch->CountMemoryReportFrame(error_obj.location);
+    }
     VVL_TracyCFrameMark;
 #if defined(VVL_TRACY_GPU)
     TracyVkCollector::GetTracyVkCollector(queue).Collect();
@@ -1222,6 +1301,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInf
             if (result == VK_ERROR_DEVICE_LOST) {
                 vo->is_device_lost = true;
             }
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkQueuePresentKHR, vo->container_type);
             vo->PostCallRecordQueuePresentKHR(queue, pPresentInfo, record_obj);
         }
     }
@@ -1238,13 +1318,19 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
     ErrorObject error_obj(vvl::Func::vkBeginCommandBuffer, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer),
                           &handle_data);
     handle_data.command_buffer.is_secondary = device_dispatch->IsSecondary(commandBuffer);
+    // Decides if the commands of this recording are validated, the begin itself is validated with them
+    if (device_dispatch->validation_sampling_period > 1) {
+        device_dispatch->SampleRecording(commandBuffer);
+    }
     {
         VVL_ZoneScopedN("PreCallValidate_BeginCommandBuffer");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateBeginCommandBuffer]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkBeginCommandBuffer, vo->container_type);
             skip |= vo->PreCallValidateBeginCommandBuffer(commandBuffer, pBeginInfo, error_obj);
             if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
         }
@@ -1258,6 +1344,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkBeginCommandBuffer, vo->container_type);
             vo->PreCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
         }
     }
@@ -1265,6 +1352,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
     VkResult result;
     {
         VVL_ZoneScopedN("Dispatch_BeginCommandBuffer");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkBeginCommandBuffer, LayerObjectTypeMaxEnum);
         result = device_dispatch->BeginCommandBuffer(commandBuffer, pBeginInfo);
     }
     record_obj.result = result;
@@ -1276,6 +1364,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkBeginCommandBuffer, vo->container_type);
             vo->PostCallRecordBeginCommandBuffer(commandBuffer, pBeginInfo, record_obj);
         }
     }
@@ -1318,6 +1407,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(VkPhysicalDevi
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT, vo->container_type);
         skip |= vo->PreCallValidateGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, error_obj);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
@@ -1327,6 +1417,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(VkPhysicalDevi
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT, vo->container_type);
         vo->PreCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
     }
 
@@ -1343,6 +1434,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolPropertiesEXT(VkPhysicalDevi
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkGetPhysicalDeviceToolPropertiesEXT, vo->container_type);
         vo->PostCallRecordGetPhysicalDeviceToolPropertiesEXT(physicalDevice, pToolCount, pToolProperties, record_obj);
     }
     return result;
@@ -1367,6 +1459,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolProperties(VkPhysicalDevice
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkGetPhysicalDeviceToolProperties, vo->container_type);
         skip |= vo->PreCallValidateGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, error_obj);
         if (skip) return VK_ERROR_VALIDATION_FAILED_EXT;
     }
@@ -1376,6 +1469,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolProperties(VkPhysicalDevice
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkGetPhysicalDeviceToolProperties, vo->container_type);
         vo->PreCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
     }
 
@@ -1392,6 +1486,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceToolProperties(VkPhysicalDevice
         if (!vo) {
             continue;
         }
+        vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkGetPhysicalDeviceToolProperties, vo->container_type);
         vo->PostCallRecordGetPhysicalDeviceToolProperties(physicalDevice, pToolCount, pToolProperties, record_obj);
     }
     return result;
@@ -1407,11 +1502,13 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdBindDescriptorBuffersEXT");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdBindDescriptorBuffersEXT]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdBindDescriptorBuffersEXT, vo->container_type);
             skip |= vo->PreCallValidateCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, error_obj);
             if (skip) {
                 return;
@@ -1429,6 +1526,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdBindDescriptorBuffersEXT, vo->container_type);
             vo->PreCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos, record_obj, chassis_state);
         }
     }
@@ -1437,6 +1535,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
     const uint32_t modified_count = (uint32_t)chassis_state.modified_binding_infos.size();
     {
         VVL_ZoneScopedN("Dispatch_vkCmdBindDescriptorBuffersEXT");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdBindDescriptorBuffersEXT, LayerObjectTypeMaxEnum);
         device_dispatch->CmdBindDescriptorBuffersEXT(commandBuffer, modified_count, chassis_state.pBindInfos);
     }
     {
@@ -1446,6 +1545,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBu
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdBindDescriptorBuffersEXT, vo->container_type);
             vo->PostCallRecordCmdBindDescriptorBuffersEXT(commandBuffer, modified_count, chassis_state.pBindInfos, record_obj);
         }
     }
@@ -1501,11 +1601,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect2KHR(VkCommandBuffer commandBuffer
     ErrorObject error_obj(vvl::Func::vkCmdDispatchIndirect2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDispatchIndirect2KHR");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDispatchIndirect2KHR]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDispatchIndirect2KHR, vo->container_type);
             skip |= vo->PreCallValidateCmdDispatchIndirect2KHR(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1522,11 +1624,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect2KHR(VkCommandBuffer commandBuffer
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDispatchIndirect2KHR, vo->container_type);
             vo->PreCallRecordCmdDispatchIndirect2KHR(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDispatchIndirect2KHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDispatchIndirect2KHR, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDispatchIndirect2KHR(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1536,6 +1640,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect2KHR(VkCommandBuffer commandBuffer
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDispatchIndirect2KHR, vo->container_type);
             vo->PostCallRecordCmdDispatchIndirect2KHR(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1550,11 +1655,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirect2EXT(VkCommandBuffer commandB
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDrawMeshTasksIndirect2EXT");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirect2EXT]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDrawMeshTasksIndirect2EXT, vo->container_type);
             skip |= vo->PreCallValidateCmdDrawMeshTasksIndirect2EXT(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1571,11 +1678,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirect2EXT(VkCommandBuffer commandB
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDrawMeshTasksIndirect2EXT, vo->container_type);
             vo->PreCallRecordCmdDrawMeshTasksIndirect2EXT(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDrawMeshTasksIndirect2EXT");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDrawMeshTasksIndirect2EXT, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDrawMeshTasksIndirect2EXT(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1585,6 +1694,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirect2EXT(VkCommandBuffer commandB
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDrawMeshTasksIndirect2EXT, vo->container_type);
             vo->PostCallRecordCmdDrawMeshTasksIndirect2EXT(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1600,11 +1710,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCount2EXT(VkCommandBuffer com
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDrawMeshTasksIndirectCount2EXT");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDrawMeshTasksIndirectCount2EXT]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDrawMeshTasksIndirectCount2EXT, vo->container_type);
             skip |= vo->PreCallValidateCmdDrawMeshTasksIndirectCount2EXT(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1621,11 +1733,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCount2EXT(VkCommandBuffer com
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDrawMeshTasksIndirectCount2EXT, vo->container_type);
             vo->PreCallRecordCmdDrawMeshTasksIndirectCount2EXT(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDrawMeshTasksIndirectCount2EXT");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDrawMeshTasksIndirectCount2EXT, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDrawMeshTasksIndirectCount2EXT(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1635,6 +1749,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawMeshTasksIndirectCount2EXT(VkCommandBuffer com
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDrawMeshTasksIndirectCount2EXT, vo->container_type);
             vo->PostCallRecordCmdDrawMeshTasksIndirectCount2EXT(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1648,11 +1763,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect2KHR(VkCommandBuffer commandBuffer, co
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirect2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDrawIndirect2KHR");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirect2KHR]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDrawIndirect2KHR, vo->container_type);
             skip |= vo->PreCallValidateCmdDrawIndirect2KHR(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1669,11 +1786,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect2KHR(VkCommandBuffer commandBuffer, co
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDrawIndirect2KHR, vo->container_type);
             vo->PreCallRecordCmdDrawIndirect2KHR(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDrawIndirect2KHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDrawIndirect2KHR, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDrawIndirect2KHR(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1683,6 +1802,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirect2KHR(VkCommandBuffer commandBuffer, co
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDrawIndirect2KHR, vo->container_type);
             vo->PostCallRecordCmdDrawIndirect2KHR(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1697,11 +1817,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect2KHR(VkCommandBuffer commandBuf
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDrawIndexedIndirect2KHR");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirect2KHR]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDrawIndexedIndirect2KHR, vo->container_type);
             skip |= vo->PreCallValidateCmdDrawIndexedIndirect2KHR(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1718,11 +1840,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect2KHR(VkCommandBuffer commandBuf
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDrawIndexedIndirect2KHR, vo->container_type);
             vo->PreCallRecordCmdDrawIndexedIndirect2KHR(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDrawIndexedIndirect2KHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDrawIndexedIndirect2KHR, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDrawIndexedIndirect2KHR(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1732,6 +1856,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirect2KHR(VkCommandBuffer commandBuf
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDrawIndexedIndirect2KHR, vo->container_type);
             vo->PostCallRecordCmdDrawIndexedIndirect2KHR(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1745,11 +1870,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount2KHR(VkCommandBuffer commandBuffe
     ErrorObject error_obj(vvl::Func::vkCmdDrawIndirectCount2KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDrawIndirectCount2KHR");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndirectCount2KHR]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDrawIndirectCount2KHR, vo->container_type);
             skip |= vo->PreCallValidateCmdDrawIndirectCount2KHR(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1766,11 +1893,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount2KHR(VkCommandBuffer commandBuffe
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDrawIndirectCount2KHR, vo->container_type);
             vo->PreCallRecordCmdDrawIndirectCount2KHR(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDrawIndirectCount2KHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDrawIndirectCount2KHR, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDrawIndirectCount2KHR(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1780,6 +1909,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndirectCount2KHR(VkCommandBuffer commandBuffe
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDrawIndirectCount2KHR, vo->container_type);
             vo->PostCallRecordCmdDrawIndirectCount2KHR(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1795,11 +1925,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount2KHR(VkCommandBuffer comma
                           VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdDrawIndexedIndirectCount2KHR");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdDrawIndexedIndirectCount2KHR]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdDrawIndexedIndirectCount2KHR, vo->container_type);
             skip |= vo->PreCallValidateCmdDrawIndexedIndirectCount2KHR(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1816,11 +1948,13 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount2KHR(VkCommandBuffer comma
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdDrawIndexedIndirectCount2KHR, vo->container_type);
             vo->PreCallRecordCmdDrawIndexedIndirectCount2KHR(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdDrawIndexedIndirectCount2KHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdDrawIndexedIndirectCount2KHR, LayerObjectTypeMaxEnum);
         device_dispatch->CmdDrawIndexedIndirectCount2KHR(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1830,6 +1964,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCount2KHR(VkCommandBuffer comma
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdDrawIndexedIndirectCount2KHR, vo->container_type);
             vo->PostCallRecordCmdDrawIndexedIndirectCount2KHR(commandBuffer, pInfo, record_obj);
         }
     }
@@ -1843,11 +1978,13 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer3KHR(VkCommandBuffer commandBuffer,
     ErrorObject error_obj(vvl::Func::vkCmdBindIndexBuffer3KHR, VulkanTypedHandle(commandBuffer, kVulkanObjectTypeCommandBuffer));
     {
         VVL_ZoneScopedN("PreCallValidate_vkCmdBindIndexBuffer3KHR");
+        const bool sampled = device_dispatch->IsValidationSampled(commandBuffer);
         for (const auto& vo : device_dispatch->intercept_vectors[InterceptIdPreCallValidateCmdBindIndexBuffer3KHR]) {
-            if (!vo) {
+            if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {
                 continue;
             }
             auto lock = vo->ReadLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::vkCmdBindIndexBuffer3KHR, vo->container_type);
             skip |= vo->PreCallValidateCmdBindIndexBuffer3KHR(commandBuffer, pInfo, error_obj);
             if (skip) return;
         }
@@ -1864,11 +2001,13 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer3KHR(VkCommandBuffer commandBuffer,
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::vkCmdBindIndexBuffer3KHR, vo->container_type);
             vo->PreCallRecordCmdBindIndexBuffer3KHR(commandBuffer, pInfo, record_obj, chassis_modified_info);
         }
     }
     {
         VVL_ZoneScopedN("Dispatch_vkCmdBindIndexBuffer3KHR");
+        vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::vkCmdBindIndexBuffer3KHR, LayerObjectTypeMaxEnum);
         device_dispatch->CmdBindIndexBuffer3KHR(commandBuffer, &chassis_modified_info);
     }
     {
@@ -1878,6 +2017,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer3KHR(VkCommandBuffer commandBuffer,
                 continue;
             }
             auto lock = vo->WriteLock();
+            vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::vkCmdBindIndexBuffer3KHR, vo->container_type);
             vo->PostCallRecordCmdBindIndexBuffer3KHR(commandBuffer, pInfo, record_obj);
         }
     }
@@ -23,6 +23,8 @@
 
 #pragma once
 #include <atomic>
+#include <functional>
+#include <memory>
 #include <vector>
 
 #include <vulkan/vulkan.h>
@@ -61,6 +63,7 @@ class BaseInstance;
 class BaseDevice;
 class DispatchInstance;
 class DispatchDevice;
+class ThreadPool;
 
 // Device extension properties -- storing properties gathered from VkPhysicalDeviceProperties2::pNext chain
 // TODO: this could be defined and initialized via generated code
@@ -328,6 +331,29 @@ class DispatchDevice : public HandleWrapper {
 
     bool IsSecondary(VkCommandBuffer cb) const;
 
+    // Calls validate(vo) for each validation object of a PreCallValidate intercept vector, on submit_validation_pool
+    bool ValidateInParallel(const std::vector<BaseDevice*>& objects, const std::function<bool(BaseDevice&)>& validate) const;
+    // Objects changing their state while validating a submit, they are not validated in parallel with the others
+    bool ValidatesSubmitSerially(const BaseDevice& vo) const;
+
+    // With validation_sampling_period, the PreCallValidate of the sampled validation objects for the commands recorded in a command
+    // buffer are only called if its current recording was sampled at vkBeginCommandBuffer. The other validation objects, and the
+    // PreCallRecord and PostCallRecord, are always called.
+    bool IsValidationSampled(VkCommandBuffer cb) const { return validation_sampling_period <= 1 || IsRecordingSampled(cb); }
+    bool IsRecordingSampled(VkCommandBuffer cb) const;
+    // The expensive validation objects, the cheap ones (handles, parameters, threading) validate every recording
+    static bool IsSampledValidationObject(const BaseDevice& vo);
+    void SampleRecording(VkCommandBuffer cb);
+    void SampleFrame() { sampling_frame_index.fetch_add(1, std::memory_order_relaxed); }
+    void AddSampledCommandBuffers(const VkCommandBufferAllocateInfo& allocate_info, const VkCommandBuffer* command_buffers);
+    void RemoveSampledCommandBuffers(uint32_t command_buffer_count, const VkCommandBuffer* command_buffers);
+    void RemoveSampledCommandPool(VkCommandPool command_pool);
+    void ReportValidationSamplingCoverage() const;
+    // Logs the memory used by each validation object, and updates the Tracy plots, see vvl::MemoryReport
+    void ReportMemoryUsage(const Location& loc) const;
+    // Reports the memory usage every memory_report_frames presents
+    void CountMemoryReportFrame(const Location& loc);
+
     Settings& settings;
     DispatchInstance* dispatch_instance;
 
@@ -356,6 +382,8 @@ class DispatchDevice : public HandleWrapper {
     mutable std::vector<std::unique_ptr<BaseDevice>> object_dispatch;
     mutable std::vector<std::unique_ptr<BaseDevice>> aborted_object_dispatch;
     mutable std::vector<std::vector<BaseDevice*>> intercept_vectors;
+    // Only created when parallel_submit_validation is enabled, see ValidateInParallel
+    std::unique_ptr<ThreadPool> submit_validation_pool;
     // Handle Wrapping Data
     // Wrapping Descriptor Template Update structures requires access to the template createinfo structs
     vvl::unordered_map<uint64_t, std::unique_ptr<TemplateState>> desc_template_createinfo_map;
@@ -380,6 +408,29 @@ class DispatchDevice : public HandleWrapper {
     vvl::unordered_map<VkCommandBuffer, VkCommandPool> secondary_cb_map{};
     mutable std::shared_mutex secondary_cb_map_mutex;
 
+    // Validation sampling state, only used when validation_sampling_period is more than 1
+    const uint32_t validation_sampling_period;
+    struct SampledCommandBuffer {
+        VkCommandPool command_pool;
+        // Offsets the sampled recordings of each command buffer, so command buffers recorded once are not all validated
+        uint32_t phase;
+        uint64_t recording_count = 0;
+        // Read without sampled_command_buffers_mutex by the commands recorded, see IsRecordingSampled
+        std::atomic<bool> validate{true};
+        bool validated_once = false;
+    };
+    // Boxed so the flag of the command buffer last recorded on each thread can be read without looking it up
+    vvl::unordered_map<VkCommandBuffer, std::unique_ptr<SampledCommandBuffer>> sampled_command_buffers;
+    mutable std::shared_mutex sampled_command_buffers_mutex;
+    uint32_t sampled_command_buffer_allocations = 0;
+    std::atomic<uint64_t> sampling_frame_index{0};
+    std::atomic<uint64_t> memory_report_frame_count{0};
+    // Coverage, kept when the command buffers are freed
+    uint64_t sampled_recordings = 0;
+    uint64_t validated_recordings = 0;
+    uint64_t sampled_command_buffer_count = 0;
+    uint64_t validated_command_buffer_count = 0;
+
 #include "generated/dispatch_object_device_methods.h"
 };
 }  // namespace vvl
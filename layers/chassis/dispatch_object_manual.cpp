@@ -29,8 +29,13 @@
 #include "generated/dispatch_functions.h"
 #include "utils/dispatch_utils.h"
 #include "utils/descriptor_utils.h"
+#include "utils/thread_pool.h"
+#include "error_message/log_capture.h"
+#include "profiling/memory_report.h"
+#include "profiling/profiling.h"
 
 #include <atomic>
+#include <cinttypes>
 
 #define OBJECT_LAYER_DESCRIPTION "khronos_validation"
 
@@ -910,13 +915,18 @@ DispatchDevice::DispatchDevice(DispatchInstance* instance, VkPhysicalDevice gpu,
       host_image_copy_props_copy_src_layouts(stateless_device_data.host_image_copy_props_copy_src_layouts),
       host_imape_copy_props_copy_dst_layouts(stateless_device_data.host_image_copy_props_copy_dst_layouts),
       phys_dev_ext_props(stateless_device_data.phys_dev_ext_props),
-      physical_device(gpu) {
+      physical_device(gpu),
+      validation_sampling_period(instance->settings.global_settings.validation_sampling_period) {
     InitValidationObjects();
     InitObjectDispatchVectors();
     for (auto& vo : object_dispatch) {
         vo->dispatch_device_ = this;
         vo->CopyDispatchState();
     }
+    // The calling thread validates too, so one worker less than the number of objects is enough
+    if (settings.global_settings.parallel_submit_validation && object_dispatch.size() > 1) {
+        submit_validation_pool = std::make_unique<ThreadPool>(static_cast<uint32_t>(object_dispatch.size() - 1));
+    }
 }
 
 DispatchDevice::~DispatchDevice() {
@@ -939,6 +949,66 @@ BaseDevice* DispatchDevice::GetValidationObject(LayerObjectTypeId object_type) c
     return nullptr;
 }
 
+// With parallel_submit_validation, each validation object validates a vkQueueSubmit* call on its own thread and the submit only
+// waits for the slowest one instead of all of them in turn. Each object logs into its own LogCapture and the captures are flushed
+// in object order. The serial loop returns at the first object that skips, so the messages of the objects after it are dropped
+// to report the same messages.
+//
+// Sync validation with syncval_submit_time_validation updates its queue state while validating a submit, it must not run when
+// an object before it skipped the submit. It is run on its own once the objects before it are done, the objects after it are
+// validated in parallel again.
+bool DispatchDevice::ValidateInParallel(const std::vector<BaseDevice*>& objects,
+                                        const std::function<bool(BaseDevice&)>& validate) const {
+    bool skip = false;
+    small_vector<BaseDevice*, 16> active_objects;
+    for (BaseDevice* vo : objects) {
+        if (vo) {
+            active_objects.emplace_back(vo);
+        }
+    }
+    if (!submit_validation_pool || active_objects.size() < 2) {
+        for (BaseDevice* vo : active_objects) {
+            skip |= validate(*vo);
+            if (skip) break;
+        }
+        return skip;
+    }
+
+    const uint32_t count = static_cast<uint32_t>(active_objects.size());
+    std::vector<LogCapture> captures(count);
+    // Not std::vector<bool>, each task writes its own element
+    std::vector<uint8_t> results(count, 0);
+    uint32_t begin = 0;
+    while (begin < count && !skip) {
+        uint32_t end = begin;
+        while (end < count && !ValidatesSubmitSerially(*active_objects[end])) {
+            end++;
+        }
+        if (end - begin == 1) {
+            skip |= validate(*active_objects[begin]);
+        } else if (end > begin) {
+            submit_validation_pool->ParallelFor(end - begin, [&](uint32_t i) {
+                LogCapture::Scope capture_scope(captures[begin + i]);
+                results[begin + i] = validate(*active_objects[begin + i]) ? 1 : 0;
+            });
+            for (uint32_t i = begin; i < end && !skip; i++) {
+                skip |= captures[i].Flush(*debug_report);
+                skip |= results[i] != 0;
+            }
+        }
+        if (end < count && !skip) {
+            skip |= validate(*active_objects[end]);
+            end++;
+        }
+        begin = end;
+    }
+    return skip;
+}
+
+bool DispatchDevice::ValidatesSubmitSerially(const BaseDevice& vo) const {
+    return vo.container_type == LayerObjectTypeSyncValidation && settings.syncval_settings.legacy_submit_time_validation;
+}
+
 void DispatchDevice::DestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator) {
     device_dispatch_table.DestroyDevice(device, pAllocator);
 }
@@ -1943,6 +2013,149 @@ bool DispatchDevice::IsSecondary(VkCommandBuffer commandBuffer) const {
     return secondary_cb_map.find(commandBuffer) != secondary_cb_map.end();
 }
 
+bool DispatchDevice::IsSampledValidationObject(const BaseDevice& vo) {
+    return vo.container_type == LayerObjectTypeCoreValidation || vo.container_type == LayerObjectTypeSyncValidation ||
+           vo.container_type == LayerObjectTypeBestPractices;
+}
+
+// One in every |period| indices is sampled. The sampled index in each run of |period| indices moves by one from run to run, so
+// that work repeating with the same period (a command buffer recorded differently every other frame) is still fully covered.
+static bool IsSampledIndex(uint64_t index, uint64_t offset, uint32_t period) {
+    return index % period == (index / period + offset) % period;
+}
+
+// Bumped whenever command buffers are added or removed, which invalidates the flags cached by IsRecordingSampled
+static std::atomic<uint64_t> sampled_command_buffers_generation{0};
+
+bool DispatchDevice::IsRecordingSampled(VkCommandBuffer commandBuffer) const {
+    // Every command recorded asks for the flag of its command buffer. A thread records one command buffer at a time, so the flag
+    // of the command buffer it last recorded is kept instead of locking and looking it up for each command.
+    struct LastRecorded {
+        const DispatchDevice* device = nullptr;
+        VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+        uint64_t generation = 0;
+        const std::atomic<bool>* validate = nullptr;
+    };
+    static thread_local LastRecorded last_recorded;
+
+    const uint64_t generation = sampled_command_buffers_generation.load(std::memory_order_acquire);
+    if (last_recorded.device == this && last_recorded.command_buffer == commandBuffer && last_recorded.generation == generation) {
+        return last_recorded.validate->load(std::memory_order_relaxed);
+    }
+
+    auto lock = ReadLockGuard(sampled_command_buffers_mutex);
+    auto it = sampled_command_buffers.find(commandBuffer);
+    if (it == sampled_command_buffers.end()) {
+        return true;
+    }
+    last_recorded = LastRecorded{this, commandBuffer, generation, &it->second->validate};
+    return it->second->validate.load(std::memory_order_relaxed);
+}
+
+void DispatchDevice::SampleRecording(VkCommandBuffer commandBuffer) {
+    auto lock = WriteLockGuard(sampled_command_buffers_mutex);
+    auto it = sampled_command_buffers.find(commandBuffer);
+    if (it == sampled_command_buffers.end()) {
+        return;
+    }
+    SampledCommandBuffer& sampled = *it->second;
+    bool validate;
+    if (settings.global_settings.validation_sampling_frames) {
+        validate = IsSampledIndex(sampling_frame_index.load(std::memory_order_relaxed), 0, validation_sampling_period);
+    } else {
+        validate = IsSampledIndex(sampled.recording_count, sampled.phase, validation_sampling_period);
+    }
+    sampled.validate.store(validate, std::memory_order_relaxed);
+
+    if (sampled.recording_count == 0) {
+        sampled_command_buffer_count++;
+    }
+    sampled.recording_count++;
+    sampled_recordings++;
+    if (validate) {
+        validated_recordings++;
+        if (!sampled.validated_once) {
+            sampled.validated_once = true;
+            validated_command_buffer_count++;
+        }
+    }
+    VVL_TracyPlot("Validation sampling recordings coverage", double(validated_recordings) / double(sampled_recordings));
+    VVL_TracyPlot("Validation sampling command buffers coverage",
+                  double(validated_command_buffer_count) / double(sampled_command_buffer_count));
+}
+
+void DispatchDevice::AddSampledCommandBuffers(const VkCommandBufferAllocateInfo& allocate_info,
+                                              const VkCommandBuffer* command_buffers) {
+    auto lock = WriteLockGuard(sampled_command_buffers_mutex);
+    for (uint32_t cb_index = 0; cb_index < allocate_info.commandBufferCount; cb_index++) {
+        auto sampled = std::make_unique<SampledCommandBuffer>();
+        sampled->command_pool = allocate_info.commandPool;
+        sampled->phase = sampled_command_buffer_allocations++ % validation_sampling_period;
+        sampled_command_buffers[command_buffers[cb_index]] = std::move(sampled);
+    }
+    sampled_command_buffers_generation.fetch_add(1, std::memory_order_release);
+}
+
+void DispatchDevice::RemoveSampledCommandBuffers(uint32_t command_buffer_count, const VkCommandBuffer* command_buffers) {
+    auto lock = WriteLockGuard(sampled_command_buffers_mutex);
+    for (uint32_t cb_index = 0; cb_index < command_buffer_count; cb_index++) {
+        sampled_command_buffers.erase(command_buffers[cb_index]);
+    }
+    sampled_command_buffers_generation.fetch_add(1, std::memory_order_release);
+}
+
+void DispatchDevice::RemoveSampledCommandPool(VkCommandPool command_pool) {
+    auto lock = WriteLockGuard(sampled_command_buffers_mutex);
+    for (auto item = sampled_command_buffers.begin(); item != sampled_command_buffers.end();) {
+        if (item->second->command_pool == command_pool) {
+            item = sampled_command_buffers.erase(item);
+        } else {
+            ++item;
+        }
+    }
+    sampled_command_buffers_generation.fetch_add(1, std::memory_order_release);
+}
+
+void DispatchDevice::ReportValidationSamplingCoverage() const {
+    if (validation_sampling_period <= 1) {
+        return;
+    }
+    auto lock = ReadLockGuard(sampled_command_buffers_mutex);
+    const auto percent = [](uint64_t part, uint64_t total) { return total ? 100.0 * double(part) / double(total) : 100.0; };
+    LogInfo("VALIDATION-SAMPLING-COVERAGE", device, Location(vvl::Func::vkDestroyDevice),
+            "Validation sampling (one in every %" PRIu32 " %s) validated %" PRIu64 " of %" PRIu64
+            " command buffer recordings (%.1f%%), and %" PRIu64 " of %" PRIu64
+            " recorded command buffers at least once (%.1f%%).",
+            validation_sampling_period, settings.global_settings.validation_sampling_frames ? "frames" : "recordings",
+            validated_recordings, sampled_recordings, percent(validated_recordings, sampled_recordings),
+            validated_command_buffer_count, sampled_command_buffer_count,
+            percent(validated_command_buffer_count, sampled_command_buffer_count));
+}
+
+void DispatchDevice::ReportMemoryUsage(const Location& loc) const {
+    vvl::MemoryReport report;
+    for (const auto& vo : object_dispatch) {
+        if (!vo) {
+            continue;
+        }
+        auto lock = vo->ReadLock();
+        vo->ReportMemoryUsage(report);
+    }
+    // The object names are kept by the chassis for the messages of every validation object
+    report.Add("Chassis", "ObjectNames", debug_report->ObjectNameCount(), debug_report->ObjectNameMemoryUsage());
+
+    report.Plot();
+    LogInfo("MEMORY-REPORT", device, loc, "Estimated memory used by the validation state of the device. %s",
+            report.ToString().c_str());
+}
+
+void DispatchDevice::CountMemoryReportFrame(const Location& loc) {
+    const uint64_t frame = memory_report_frame_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (frame % settings.global_settings.memory_report_frames == 0) {
+        ReportMemoryUsage(loc);
+    }
+}
+
 VkResult DispatchDevice::BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo) {
     if (!wrap_handles || !IsSecondary(commandBuffer)) return device_dispatch_table.BeginCommandBuffer(commandBuffer, pBeginInfo);
     vku::safe_VkCommandBufferBeginInfo local_pBeginInfo;
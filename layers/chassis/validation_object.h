@@ -62,6 +62,7 @@ struct CmdBindDescriptorBuffers;
 
 namespace vvl {
 struct AllocateDescriptorSetsData;
+class MemoryReport;
 class Pipeline;
 }  // namespace vvl
 
@@ -266,6 +267,9 @@ class BaseDevice : public Logger {
     // called after vkCreateDevice() completes successfully
     virtual void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) {}
 
+    // Adds the memory used by the state of this object, when the memory_report_frames setting is set
+    virtual void ReportMemoryUsage(MemoryReport& report) {}
+
     // Allow additional state parameter for CreateGraphicsPipelines
     virtual bool PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
                                                         const VkGraphicsPipelineCreateInfo* pCreateInfos,
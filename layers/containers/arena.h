@@ -0,0 +1,260 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Blocks given back by arenas on reset, handed out again to the next arena needing one.
+//
+// Shared by the arenas of objects that are reset over and over (the command buffers of a pool), so once the first recordings
+// have grown the cache no memory is taken from the heap anymore. The blocks are |min_block_size| times a power of two, up to
+// |max_block_size|, and at most |max_cached_bytes| of them are kept, the others go back to the heap. Thread safe.
+class ArenaBlockCache {
+  public:
+    ArenaBlockCache(size_t min_block_size, size_t max_block_size, size_t max_cached_bytes)
+        : min_block_size_(min_block_size), max_block_size_(max_block_size), max_cached_bytes_(max_cached_bytes) {
+        assert(min_block_size != 0 && min_block_size <= max_block_size);
+        for (size_t size = min_block_size; size <= max_block_size; size *= 2) {
+            blocks_.emplace_back();
+        }
+    }
+    ArenaBlockCache(const ArenaBlockCache &) = delete;
+    ArenaBlockCache &operator=(const ArenaBlockCache &) = delete;
+
+    size_t MinBlockSize() const { return min_block_size_; }
+    size_t MaxBlockSize() const { return max_block_size_; }
+
+    // |size| must be one of the block sizes
+    std::unique_ptr<std::byte[]> Acquire(size_t size) {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            auto &blocks = blocks_[SizeClass(size)];
+            if (!blocks.empty()) {
+                std::unique_ptr<std::byte[]> block = std::move(blocks.back());
+                blocks.pop_back();
+                cached_bytes_ -= size;
+                return block;
+            }
+        }
+        return std::unique_ptr<std::byte[]>(new std::byte[size]);
+    }
+
+    void Release(std::unique_ptr<std::byte[]> block, size_t size) {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (cached_bytes_ + size <= max_cached_bytes_) {
+            blocks_[SizeClass(size)].emplace_back(std::move(block));
+            cached_bytes_ += size;
+        }
+    }
+
+    // Gives all the cached blocks back to the heap
+    void Trim() {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (auto &blocks : blocks_) {
+            blocks.clear();
+        }
+        cached_bytes_ = 0;
+    }
+
+    size_t CachedBytes() const {
+        std::lock_guard<std::mutex> guard(lock_);
+        return cached_bytes_;
+    }
+
+  private:
+    size_t SizeClass(size_t size) const {
+        size_t size_class = 0;
+        for (size_t class_size = min_block_size_; class_size < size; class_size *= 2) {
+            size_class++;
+        }
+        assert(size_class < blocks_.size() && (min_block_size_ << size_class) == size);
+        return size_class;
+    }
+
+    const size_t min_block_size_;
+    const size_t max_block_size_;
+    const size_t max_cached_bytes_;
+    mutable std::mutex lock_;
+    // One list per block size, smallest first
+    std::vector<std::vector<std::unique_ptr<std::byte[]>>> blocks_;
+    size_t cached_bytes_ = 0;
+};
+
+// Bump allocator for many small objects that all die together.
+//
+// Allocations are carved out of large blocks and there is no per allocation free, all the memory is released at once when the
+// arena is reset or destroyed. This replaces one heap allocation per object with one per block, and keeps objects created one
+// after the other next to each other in memory.
+//
+// With a block cache, the first block is the smallest size of the cache and each new block doubles the previous one up to the
+// largest, so an arena holding little only takes a small block.
+//
+// The arena never calls destructors, owners of objects holding memory of their own (a heap allocated small_vector) must destroy
+// them before the arena goes away. Not thread safe.
+class Arena {
+  public:
+    static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+    explicit Arena(size_t block_size = kDefaultBlockSize)
+        : min_block_size_(block_size), max_block_size_(block_size), next_block_size_(block_size) {}
+    // Blocks come from |block_cache| and go back to it when the arena is reset
+    explicit Arena(std::shared_ptr<ArenaBlockCache> block_cache)
+        : min_block_size_(block_cache->MinBlockSize()),
+          max_block_size_(block_cache->MaxBlockSize()),
+          next_block_size_(min_block_size_),
+          block_cache_(std::move(block_cache)) {}
+    ~Arena() { Reset(); }
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    void *Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+        size_t padding = Padding(alignment);
+        if (padding + size > remaining_) {
+            NewBlock(size + alignment);
+            padding = Padding(alignment);
+        }
+        std::byte *ptr = current_ + padding;
+        current_ += padding + size;
+        remaining_ -= padding + size;
+        allocated_bytes_ += size;
+        return ptr;
+    }
+
+    template <typename T, typename... Args>
+    T *New(Args &&...args) {
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // Releases all the memory, every pointer returned so far is dangling
+    void Reset() {
+        if (block_cache_) {
+            for (Block &block : blocks_) {
+                if (block.cached) {
+                    block_cache_->Release(std::move(block.data), block.size);
+                }
+            }
+        }
+        blocks_.clear();
+        current_ = nullptr;
+        remaining_ = 0;
+        allocated_bytes_ = 0;
+        reserved_bytes_ = 0;
+        next_block_size_ = min_block_size_;
+    }
+
+    // Bytes handed out, and bytes taken from the heap for them
+    size_t AllocatedBytes() const { return allocated_bytes_; }
+    size_t ReservedBytes() const { return reserved_bytes_; }
+
+  private:
+    size_t Padding(size_t alignment) const {
+        return (alignment - (reinterpret_cast<uintptr_t>(current_) & (alignment - 1))) & (alignment - 1);
+    }
+
+    void NewBlock(size_t min_size) {
+        size_t size = next_block_size_;
+        while (size < min_size && size < max_block_size_) {
+            size *= 2;
+        }
+        if (size < min_size) {
+            // Allocations larger than the largest block get a block of their own
+            blocks_.emplace_back(Block{std::unique_ptr<std::byte[]>(new std::byte[min_size]), min_size, false});
+        } else {
+            if (block_cache_) {
+                blocks_.emplace_back(Block{block_cache_->Acquire(size), size, true});
+            } else {
+                blocks_.emplace_back(Block{std::unique_ptr<std::byte[]>(new std::byte[size]), size, false});
+            }
+            next_block_size_ = std::min(size * 2, max_block_size_);
+        }
+        current_ = blocks_.back().data.get();
+        remaining_ = blocks_.back().size;
+        reserved_bytes_ += blocks_.back().size;
+    }
+
+    struct Block {
+        std::unique_ptr<std::byte[]> data;
+        size_t size;
+        // Comes from the block cache and goes back to it
+        bool cached;
+    };
+
+    const size_t min_block_size_;
+    const size_t max_block_size_;
+    size_t next_block_size_;
+    std::shared_ptr<ArenaBlockCache> block_cache_;
+    std::vector<Block> blocks_;
+    std::byte *current_ = nullptr;
+    size_t remaining_ = 0;
+    size_t allocated_bytes_ = 0;
+    size_t reserved_bytes_ = 0;
+};
+
+// Standard allocator handing out memory of an Arena, for containers and std::allocate_shared.
+// Deallocating does nothing, the memory is only reclaimed when the arena is reset: everything allocated with it must have been
+// destroyed by then.
+template <typename T>
+class ArenaAllocator {
+  public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena &arena) : arena_(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena_(other.arena_) {}
+
+    T *allocate(size_t count) { return static_cast<T *>(arena_->Allocate(count * sizeof(T), alignof(T))); }
+    void deallocate(T *, size_t) {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const {
+        return arena_ == other.arena_;
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const {
+        return arena_ != other.arena_;
+    }
+
+  private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    Arena *arena_;
+};
+
+// Vector allocating from an arena, growing it leaves the previous storage in the arena until it is reset.
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+// Destroys the elements and gives up the storage, for vectors that stay around after the arena they allocate from is reset.
+// The next elements are allocated from the same arena.
+template <typename T>
+void ReleaseArenaVector(ArenaVector<T> &vector) {
+    ArenaVector<T>(vector.get_allocator()).swap(vector);
+}
+
+}  // namespace vvl
@@ -0,0 +1,158 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace vvl {
+
+// Ordered map stored in a flat array, for keys that are mostly inserted in increasing order and
+// erased from the front (queue-like usage, e.g. semaphore timelines).
+//
+// The elements live in a vector where [head_, size) is the live range. Erasing from the front only
+// advances head_; the dead prefix is dropped once it dominates the storage (or the map gets empty),
+// so appending a key larger than the last one and erasing from the front are O(1) amortized and
+// do not allocate once the storage has grown to the working set size.
+// Out-of-order insertions and erasure from the middle are O(n).
+//
+// NOTE: unlike std::map, insertion and erasure invalidate iterators and references.
+template <typename Key, typename T>
+class flat_queue_map {
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using size_type = size_t;
+
+  private:
+    using Storage = std::vector<value_type>;
+
+  public:
+    using iterator = typename Storage::iterator;
+    using const_iterator = typename Storage::const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    bool empty() const { return head_ == storage_.size(); }
+    size_type size() const { return storage_.size() - head_; }
+    void clear() {
+        storage_.clear();
+        head_ = 0;
+    }
+
+    iterator begin() { return storage_.begin() + head_; }
+    const_iterator begin() const { return storage_.cbegin() + head_; }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return storage_.end(); }
+    const_iterator end() const { return storage_.cend(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    iterator lower_bound(const Key &key) {
+        // Fast path for appending and for lookups of the most recent key
+        if (empty() || storage_.back().first < key) {
+            return end();
+        }
+        return std::lower_bound(begin(), end(), key, [](const value_type &v, const Key &k) { return v.first < k; });
+    }
+    const_iterator lower_bound(const Key &key) const {
+        if (empty() || storage_.back().first < key) {
+            return end();
+        }
+        return std::lower_bound(begin(), end(), key, [](const value_type &v, const Key &k) { return v.first < k; });
+    }
+
+    iterator find(const Key &key) {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it : end();
+    }
+    const_iterator find(const Key &key) const {
+        auto it = lower_bound(key);
+        return (it != end() && it->first == key) ? it : end();
+    }
+
+    std::pair<iterator, bool> insert(value_type &&value) {
+        auto it = lower_bound(value.first);
+        if (it != end() && it->first == value.first) {
+            return {it, false};
+        }
+        if (it == end()) {
+            storage_.emplace_back(std::move(value));
+            return {std::prev(storage_.end()), true};
+        }
+        if (it == begin() && head_ > 0) {
+            // Reuse the dead prefix slot in front of the first element
+            --head_;
+            storage_[head_] = std::move(value);
+            return {begin(), true};
+        }
+        return {storage_.insert(it, std::move(value)), true};
+    }
+
+    T &operator[](const Key &key) {
+        auto it = lower_bound(key);
+        if (it != end() && it->first == key) {
+            return it->second;
+        }
+        return insert(value_type(key, T{})).first->second;
+    }
+
+    // Returns the iterator following the last erased element
+    iterator erase(iterator first, iterator last) {
+        if (first == last) {
+            return last;
+        }
+        if (first != begin()) {
+            return storage_.erase(first, last);
+        }
+        // Erase from the front. Release the resources of the dead elements right away,
+        // the slots themselves are reused or compacted later.
+        const size_t count = static_cast<size_t>(std::distance(first, last));
+        for (auto it = first; it != last; ++it) {
+            *it = value_type{};
+        }
+        head_ += count;
+        if (empty()) {
+            clear();
+        } else if (head_ >= kMinCompactSize && head_ >= size()) {
+            storage_.erase(storage_.begin(), storage_.begin() + head_);
+            head_ = 0;
+        }
+        return begin();
+    }
+    iterator erase(iterator pos) {
+        assert(pos != end());
+        return erase(pos, std::next(pos));
+    }
+
+  private:
+    // Don't move the live elements around for a few dead slots
+    static constexpr size_t kMinCompactSize = 32;
+
+    Storage storage_;
+    size_t head_ = 0;
+};
+
+}  // namespace vvl
@@ -0,0 +1,162 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vvl {
+
+// A value per page, for page indices in [0, page_count).
+//
+// Radix indexed on two levels: the high bits of the page index select a leaf of kLeafSize pages, the low bits the page in the
+// leaf. Setting or getting a page is O(1), unlike a range_map where each update searches and splits the ranges around it.
+// A leaf whose pages all have the same value is stored as that single value, so binding a large range only touches the leaves
+// at its two ends and a never bound resource costs nothing.
+//
+// Value must be cheap to copy and compare (an index into another table), Value{} is the value of pages never set.
+template <typename Value>
+class PageTable {
+  public:
+    static constexpr uint32_t kLeafBits = 9;
+    static constexpr uint64_t kLeafSize = uint64_t(1) << kLeafBits;
+    static constexpr uint64_t kLeafMask = kLeafSize - 1;
+
+    explicit PageTable(uint64_t page_count = 0) : page_count_(page_count) {}
+
+    uint64_t PageCount() const { return page_count_; }
+
+    Value Get(uint64_t page) const {
+        const uint64_t leaf_index = page >> kLeafBits;
+        if (leaf_index >= directory_.size()) {
+            return Value{};
+        }
+        const Node &node = directory_[leaf_index];
+        return node.leaf ? node.leaf[page & kLeafMask] : node.uniform;
+    }
+
+    // Sets the pages in [begin, end) to |value|. |replaced(old_value, page_count)| is called for the pages whose value is
+    // overwritten, grouped by runs of equal values, so the caller can keep counts of what is referenced by the table.
+    template <typename Replaced>
+    void Set(uint64_t begin, uint64_t end, const Value &value, Replaced &&replaced) {
+        end = std::min(end, page_count_);
+        if (begin >= end) {
+            return;
+        }
+        const uint64_t last_leaf = (end - 1) >> kLeafBits;
+        if (last_leaf >= directory_.size()) {
+            directory_.resize(static_cast<size_t>(last_leaf + 1));
+        }
+
+        for (uint64_t leaf_index = begin >> kLeafBits; leaf_index <= last_leaf; ++leaf_index) {
+            Node &node = directory_[leaf_index];
+            const uint64_t leaf_begin = leaf_index << kLeafBits;
+            const uint64_t first = std::max(begin, leaf_begin) - leaf_begin;
+            const uint64_t last = std::min(end, leaf_begin + kLeafSize) - leaf_begin;
+
+            if (!node.leaf) {
+                if (node.uniform == value) {
+                    continue;
+                }
+                if (last - first == kLeafSize) {
+                    replaced(node.uniform, kLeafSize);
+                    node.uniform = value;
+                    continue;
+                }
+                // Only part of a uniform leaf changes, it needs its pages
+                node.leaf = std::make_unique<Value[]>(kLeafSize);
+                std::fill(node.leaf.get(), node.leaf.get() + kLeafSize, node.uniform);
+            }
+
+            ForEachRunInLeaf(node.leaf.get(), first, last, [&](uint64_t run_begin, uint64_t run_end, const Value &old_value) {
+                if (!(old_value == value)) {
+                    replaced(old_value, run_end - run_begin);
+                }
+            });
+            if (last - first == kLeafSize) {
+                node.leaf.reset();
+                node.uniform = value;
+            } else {
+                std::fill(node.leaf.get() + first, node.leaf.get() + last, value);
+            }
+        }
+    }
+
+    // Calls |func(run_begin, run_end, value)| for each run of pages with an equal value in [begin, end), in increasing order.
+    // Runs are clipped to [begin, end) and runs continuing across leaves are reported once.
+    template <typename Func>
+    void ForEachRun(uint64_t begin, uint64_t end, Func &&func) const {
+        end = std::min(end, page_count_);
+        if (begin >= end) {
+            return;
+        }
+
+        uint64_t run_begin = begin;
+        Value run_value = Get(begin);
+        auto add_run = [&](uint64_t sub_begin, const Value &value) {
+            if (!(value == run_value)) {
+                func(run_begin, sub_begin, run_value);
+                run_begin = sub_begin;
+                run_value = value;
+            }
+        };
+
+        const uint64_t last_leaf = (end - 1) >> kLeafBits;
+        for (uint64_t leaf_index = begin >> kLeafBits; leaf_index <= last_leaf; ++leaf_index) {
+            const uint64_t leaf_begin = leaf_index << kLeafBits;
+            const uint64_t first = std::max(begin, leaf_begin) - leaf_begin;
+            const uint64_t last = std::min(end, leaf_begin + kLeafSize) - leaf_begin;
+            const Node *node = leaf_index < directory_.size() ? &directory_[leaf_index] : nullptr;
+
+            if (node && node->leaf) {
+                ForEachRunInLeaf(node->leaf.get(), first, last,
+                                 [&](uint64_t sub_begin, uint64_t, const Value &value) { add_run(leaf_begin + sub_begin, value); });
+            } else {
+                add_run(leaf_begin + first, node ? node->uniform : Value{});
+            }
+        }
+        func(run_begin, end, run_value);
+    }
+
+    void Clear() { directory_.clear(); }
+
+  private:
+    struct Node {
+        Value uniform{};
+        std::unique_ptr<Value[]> leaf;
+    };
+
+    template <typename Func>
+    static void ForEachRunInLeaf(const Value *leaf, uint64_t first, uint64_t last, Func &&func) {
+        uint64_t run_begin = first;
+        for (uint64_t page = first + 1; page < last; ++page) {
+            if (!(leaf[page] == leaf[run_begin])) {
+                func(run_begin, page, leaf[run_begin]);
+                run_begin = page;
+            }
+        }
+        func(run_begin, last, leaf[run_begin]);
+    }
+
+    uint64_t page_count_;
+    // Leaves past the end of the directory have never been set
+    std::vector<Node> directory_;
+};
+
+}  // namespace vvl
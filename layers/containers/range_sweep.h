@@ -0,0 +1,153 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "containers/range.h"
+
+// Finding which ranges of a list intersect, without comparing every pair.
+//
+// The ranges are sorted on their begin and swept once, keeping the ranges that have not ended yet in a min heap on their end.
+// The cost is O(n log n) plus the number of intersecting pairs, instead of O(n^2).
+//
+// For overlapping boxes (copy regions, blit regions, ...) the ranges are the boxes extent on one of their axes: the sweep
+// finds the candidate pairs and the callback checks the other dimensions.
+namespace vvl {
+namespace range_sweep {
+
+template <typename Index>
+struct SweepRange {
+    range<Index> r;
+    uint32_t index;
+    uint32_t set;
+};
+
+template <typename Index>
+struct EndsLater {
+    bool operator()(const SweepRange<Index> &a, const SweepRange<Index> &b) const { return a.r.end > b.r.end; }
+};
+
+// |func| is called with ranges from two different sets, or from the same set when |single_set| is true
+template <typename Index, typename Func>
+void Sweep(std::vector<SweepRange<Index>> &sweep_ranges, bool single_set, Func &func) {
+    std::sort(sweep_ranges.begin(), sweep_ranges.end(),
+              [](const SweepRange<Index> &a, const SweepRange<Index> &b) { return a.r.begin < b.r.begin; });
+
+    std::vector<SweepRange<Index>> active[2];
+    for (const SweepRange<Index> &current : sweep_ranges) {
+        std::vector<SweepRange<Index>> &other_active = active[single_set ? 0 : 1 - current.set];
+
+        // Ranges ending before the current one begins can't intersect it, nor any of the ranges after it
+        while (!other_active.empty() && other_active.front().r.end <= current.r.begin) {
+            std::pop_heap(other_active.begin(), other_active.end(), EndsLater<Index>());
+            other_active.pop_back();
+        }
+
+        // All remaining active ranges begin before the current one and end after its begin
+        for (const SweepRange<Index> &other : other_active) {
+            func(other, current);
+        }
+
+        std::vector<SweepRange<Index>> &current_active = active[single_set ? 0 : current.set];
+        current_active.push_back(current);
+        std::push_heap(current_active.begin(), current_active.end(), EndsLater<Index>());
+    }
+}
+
+}  // namespace range_sweep
+
+// Calls func(a_index, b_index) for each range of |ranges_a| that intersects a range of |ranges_b|.
+// Pairs are not found in any particular order. Empty ranges never intersect.
+template <typename Index, typename Func>
+void ForEachIntersectingRangePair(const std::vector<range<Index>> &ranges_a, const std::vector<range<Index>> &ranges_b,
+                                  Func &&func) {
+    using range_sweep::SweepRange;
+    std::vector<SweepRange<Index>> sweep_ranges;
+    sweep_ranges.reserve(ranges_a.size() + ranges_b.size());
+    for (uint32_t i = 0; i < static_cast<uint32_t>(ranges_a.size()); ++i) {
+        if (ranges_a[i].non_empty()) {
+            sweep_ranges.emplace_back(SweepRange<Index>{ranges_a[i], i, 0});
+        }
+    }
+    for (uint32_t i = 0; i < static_cast<uint32_t>(ranges_b.size()); ++i) {
+        if (ranges_b[i].non_empty()) {
+            sweep_ranges.emplace_back(SweepRange<Index>{ranges_b[i], i, 1});
+        }
+    }
+
+    auto pair_func = [&func](const SweepRange<Index> &x, const SweepRange<Index> &y) {
+        if (x.set == 0) {
+            func(x.index, y.index);
+        } else {
+            func(y.index, x.index);
+        }
+    };
+    range_sweep::Sweep(sweep_ranges, false, pair_func);
+}
+
+// Calls func(i, j), with i < j, for each pair of intersecting ranges in |ranges|.
+// Pairs are not found in any particular order. Empty ranges never intersect.
+template <typename Index, typename Func>
+void ForEachIntersectingRangePair(const std::vector<range<Index>> &ranges, Func &&func) {
+    using range_sweep::SweepRange;
+    std::vector<SweepRange<Index>> sweep_ranges;
+    sweep_ranges.reserve(ranges.size());
+    for (uint32_t i = 0; i < static_cast<uint32_t>(ranges.size()); ++i) {
+        if (ranges[i].non_empty()) {
+            sweep_ranges.emplace_back(SweepRange<Index>{ranges[i], i, 0});
+        }
+    }
+
+    auto pair_func = [&func](const SweepRange<Index> &x, const SweepRange<Index> &y) {
+        func(std::min(x.index, y.index), std::max(x.index, y.index));
+    };
+    range_sweep::Sweep(sweep_ranges, true, pair_func);
+}
+
+// Same as above, but returns the pairs sorted, for callers reporting them in a deterministic order.
+// |filter| is called on each candidate pair and decides if it is kept.
+template <typename Index, typename Filter>
+std::vector<std::pair<uint32_t, uint32_t>> GetIntersectingRangePairs(const std::vector<range<Index>> &ranges_a,
+                                                                     const std::vector<range<Index>> &ranges_b,
+                                                                     Filter &&filter) {
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    ForEachIntersectingRangePair(ranges_a, ranges_b, [&pairs, &filter](uint32_t a, uint32_t b) {
+        if (filter(a, b)) {
+            pairs.emplace_back(a, b);
+        }
+    });
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+template <typename Index, typename Filter>
+std::vector<std::pair<uint32_t, uint32_t>> GetIntersectingRangePairs(const std::vector<range<Index>> &ranges, Filter &&filter) {
+    std::vector<std::pair<uint32_t, uint32_t>> pairs;
+    ForEachIntersectingRangePair(ranges, [&pairs, &filter](uint32_t i, uint32_t j) {
+        if (filter(i, j)) {
+            pairs.emplace_back(i, j);
+        }
+    });
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+}
+
+}  // namespace vvl
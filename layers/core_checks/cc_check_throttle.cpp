@@ -0,0 +1,115 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core_checks/cc_check_throttle.h"
+
+#include "error_message/error_location.h"
+#include "profiling/memory_report.h"
+
+namespace core {
+
+size_t CheckThrottle::ObjectCount() const {
+    size_t count = 0;
+    for (const Family &family_state : families_) {
+        std::lock_guard<std::mutex> guard(family_state.lock);
+        count += family_state.passes.size();
+    }
+    return count;
+}
+
+size_t CheckThrottle::HeapMemoryUsage() const {
+    size_t bytes = 0;
+    for (const Family &family_state : families_) {
+        std::lock_guard<std::mutex> guard(family_state.lock);
+        bytes += vvl::MemoryReport::MapBytes(family_state.passes);
+    }
+    return bytes;
+}
+
+bool CheckThrottle::IsThrottled(vvl::CheckFamily family, uint64_t object, uint64_t version) {
+    if (!Enabled()) {
+        return false;
+    }
+    Family &family_state = GetFamily(family);
+    const uint64_t run_count = family_state.run_count.load(std::memory_order_relaxed);
+    if (run_count == 0 || family_state.total_ns.load(std::memory_order_relaxed) / run_count <= budget_ns_) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> guard(family_state.lock);
+        auto it = family_state.passes.find(object);
+        if (it == family_state.passes.end() || it->second.version != version || it->second.count < passes_) {
+            return false;
+        }
+    }
+    family_state.throttled_count.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void CheckThrottle::Add(vvl::CheckFamily family, uint64_t object, uint64_t version, uint64_t ns, bool failed) {
+    Family &family_state = GetFamily(family);
+    family_state.run_count.fetch_add(1, std::memory_order_relaxed);
+    family_state.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    if (!Enabled()) {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(family_state.lock);
+    if (failed) {
+        family_state.passes.erase(object);
+        return;
+    }
+    auto it = family_state.passes.find(object);
+    if (it == family_state.passes.end()) {
+        if (family_state.passes.size() >= kMaxObjects) {
+            family_state.passes.clear();
+        }
+        family_state.passes.emplace(object, Family::Passes{version, 1});
+    } else if (it->second.version != version) {
+        it->second = Family::Passes{version, 1};
+    } else if (it->second.count < passes_) {
+        it->second.count++;
+    }
+}
+
+CheckScope::CheckScope(CheckThrottle &throttle, vvl::CheckFamily family, const Location &loc, uint64_t object, uint64_t version,
+                       const bool &skip)
+    : throttle_(throttle), family_(family), function_(loc.function), object_(object), version_(version), skip_(skip) {
+    if (throttle_.IsThrottled(family_, object_, version_)) {
+        throttled_ = true;
+        if (vvl::ApiTimer::Enabled()) {
+            vvl::ApiTimer::AddCheck(family_, function_, LayerObjectTypeCoreValidation, std::chrono::steady_clock::duration::zero(),
+                                    true);
+        }
+    } else if (throttle_.Enabled() || vvl::ApiTimer::Enabled()) {
+        timed_ = true;
+        start_ = std::chrono::steady_clock::now();
+    }
+}
+
+CheckScope::~CheckScope() {
+    if (!timed_) {
+        return;
+    }
+    const auto duration = std::chrono::steady_clock::now() - start_;
+    throttle_.Add(family_, object_, version_,
+                  static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()), skip_);
+    if (vvl::ApiTimer::Enabled()) {
+        vvl::ApiTimer::AddCheck(family_, function_, LayerObjectTypeCoreValidation, duration, false);
+    }
+}
+
+}  // namespace core
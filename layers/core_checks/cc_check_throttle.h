@@ -0,0 +1,109 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include "containers/custom_containers.h"
+#include "profiling/api_timing.h"
+
+struct Location;
+
+namespace core {
+
+// A few families of checks dominate the validation time of some applications (the image layouts of large command buffers at
+// submit time, the descriptors of sets with many bindings at draw time), and the only knobs are the coarse check_* disables.
+//
+// With check_throttle_budget_ns, a family of checks costing more than the budget on average stops being run on an object once
+// it passed check_throttle_passes times in a row on that object. Errors appearing on a throttled object later on are missed,
+// so this trades coverage for speed and is off by default.
+//
+// The passes are counted for a |version| of the object, covering all the state the checks depend on (a recording of a command
+// buffer, the writes of a descriptor set with the pipeline and command buffer state using it), including the state object ids
+// so a reused handle is a new object. Another version starts counting from zero.
+class CheckThrottle {
+  public:
+    CheckThrottle(uint32_t budget_ns, uint32_t passes) : budget_ns_(budget_ns), passes_(passes) {}
+
+    bool Enabled() const { return budget_ns_ != 0; }
+    // Counts a throttled run when returning true
+    bool IsThrottled(vvl::CheckFamily family, uint64_t object, uint64_t version);
+    void Add(vvl::CheckFamily family, uint64_t object, uint64_t version, uint64_t ns, bool failed);
+
+    uint64_t RunCount(vvl::CheckFamily family) const { return GetFamily(family).run_count.load(std::memory_order_relaxed); }
+    uint64_t ThrottledCount(vvl::CheckFamily family) const {
+        return GetFamily(family).throttled_count.load(std::memory_order_relaxed);
+    }
+    // Objects with passes counted in all the families, and the memory used by their counts
+    size_t ObjectCount() const;
+    size_t HeapMemoryUsage() const;
+
+  private:
+    // Past this the pass counts of a family are reset, objects are only throttled again after passing again
+    static constexpr size_t kMaxObjects = 65536;
+
+    struct Family {
+        std::atomic<uint64_t> run_count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> throttled_count{0};
+        mutable std::mutex lock;
+        struct Passes {
+            uint64_t version;
+            uint32_t count;
+        };
+        // Passes in a row of the last version of each object
+        vvl::unordered_map<uint64_t, Passes> passes;
+    };
+    Family &GetFamily(vvl::CheckFamily family) { return families_[static_cast<uint32_t>(family)]; }
+    const Family &GetFamily(vvl::CheckFamily family) const { return families_[static_cast<uint32_t>(family)]; }
+
+    const uint64_t budget_ns_;
+    const uint32_t passes_;
+    std::array<Family, static_cast<uint32_t>(vvl::CheckFamily::Count)> families_;
+};
+
+// Times one run of a family of checks on an object, for the api_timing_file report and the throttling.
+// |skip| is read when the scope ends, so it must hold the result of the check by then.
+class CheckScope {
+  public:
+    CheckScope(CheckThrottle &throttle, vvl::CheckFamily family, const Location &loc, uint64_t object, uint64_t version,
+               const bool &skip);
+    ~CheckScope();
+    CheckScope(const CheckScope &) = delete;
+    CheckScope &operator=(const CheckScope &) = delete;
+
+    // The check must not run
+    bool Throttled() const { return throttled_; }
+
+  private:
+    CheckThrottle &throttle_;
+    const vvl::CheckFamily family_;
+    const vvl::Func function_;
+    const uint64_t object_;
+    const uint64_t version_;
+    const bool &skip_;
+    bool timed_ = false;
+    bool throttled_ = false;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace core
@@ -39,6 +39,7 @@
 #include "utils/math_utils.h"
 #include "utils/image_utils.h"
 #include "containers/container_utils.h"
+#include "containers/range_sweep.h"
 
 struct ImageRegionIntersection {
     VkImageSubresourceLayers subresource = {};
@@ -157,6 +158,26 @@ static bool RegionIntersectsBlit(const RegionType* region0, const RegionType* re
     return result;
 }
 
+// For every pair of regions (i, j) where the source of pRegions[i] overlaps the destination of pRegions[j] in the same image.
+// Regions are swept along x, which all image types have, and the candidates are checked with |intersects|.
+template <typename RegionType, typename IntersectFunc>
+static std::vector<std::pair<uint32_t, uint32_t>> GetSrcDstRegionOverlaps(uint32_t region_count, const RegionType* regions,
+                                                                          IntersectFunc&& intersects) {
+    std::vector<vvl::range<int64_t>> src_ranges(region_count);
+    std::vector<vvl::range<int64_t>> dst_ranges(region_count);
+    for (uint32_t i = 0; i < region_count; i++) {
+        if constexpr (std::is_same_v<RegionType, VkImageBlit> || std::is_same_v<RegionType, VkImageBlit2>) {
+            // Flipped blit regions have an empty range, like in RegionIntersectsBlit()
+            src_ranges[i] = vvl::range<int64_t>(regions[i].srcOffsets[0].x, regions[i].srcOffsets[1].x);
+            dst_ranges[i] = vvl::range<int64_t>(regions[i].dstOffsets[0].x, regions[i].dstOffsets[1].x);
+        } else {
+            src_ranges[i] = vvl::range<int64_t>(regions[i].srcOffset.x, int64_t(regions[i].srcOffset.x) + regions[i].extent.width);
+            dst_ranges[i] = vvl::range<int64_t>(regions[i].dstOffset.x, int64_t(regions[i].dstOffset.x) + regions[i].extent.width);
+        }
+    }
+    return vvl::GetIntersectingRangePairs(src_ranges, dst_ranges, intersects);
+}
+
 static inline bool IsExtentEqual(const VkExtent3D& extent, const VkExtent3D& other_extent) {
     return (extent.width == other_extent.width) && (extent.height == other_extent.height) && (extent.depth == other_extent.depth);
 }
@@ -806,6 +827,18 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer commandBuffer, cons
         dst_memory_ranges.reserve(regionCount);
     }
 
+    // Dst vs Dst overlaps, found up front to not compare every pair of regions
+    std::vector<std::pair<uint32_t, uint32_t>> dst_overlaps;
+    if (dst_binding) {
+        std::vector<MemoryRange> dst_ranges(regionCount);
+        for (uint32_t i = 0; i < regionCount; i++) {
+            dst_ranges[i] = MemoryRange(dst_binding->memory_offset + pRegions[i].dstOffset,
+                                        dst_binding->memory_offset + pRegions[i].dstOffset + pRegions[i].size);
+        }
+        dst_overlaps = vvl::GetIntersectingRangePairs(dst_ranges, [](uint32_t, uint32_t) { return true; });
+    }
+    auto dst_overlaps_it = dst_overlaps.cbegin();
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const RegionType& region = pRegions[i];
@@ -851,44 +884,34 @@ bool CoreChecks::ValidateCmdCopyBufferBounds(VkCommandBuffer commandBuffer, cons
         }
 
         // Validate Dst vs Dst overlap
-        if (dst_binding) {
+        for (; dst_overlaps_it != dst_overlaps.cend() && dst_overlaps_it->first == i; ++dst_overlaps_it) {
+            const uint32_t j = dst_overlaps_it->second;
+            const auto& other_region = pRegions[j];
             MemoryRange dst_buffer_memory_range(dst_binding->memory_offset + region.dstOffset,
                                                 dst_binding->memory_offset + region.dstOffset + region.size);
-            for (uint32_t j = i + 1; j < regionCount; ++j) {
-                const auto& other_region = pRegions[j];
-                MemoryRange other_region_range(dst_binding->memory_offset + other_region.dstOffset,
-                                               dst_binding->memory_offset + other_region.dstOffset + other_region.size);
-                if (dst_buffer_memory_range.intersects(other_region_range)) {
-                    const LogObjectList objlist(commandBuffer, dst_binding->memory_state->Handle(), dst_buffer_state.Handle());
-                    const char* vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-12482" : "VUID-vkCmdCopyBuffer-pRegions-12482";
-                    skip |= LogError(vuid, objlist, region_loc,
-                                     "destination buffer range %s overlaps with pRegions[%" PRIu32
-                                     "] destination buffer range %s\nThis will cause a write-after-write memory hazard.",
-                                     vvl::string_range(dst_buffer_memory_range).c_str(), j,
-                                     vvl::string_range(other_region_range).c_str());
-                }
-            }
+            MemoryRange other_region_range(dst_binding->memory_offset + other_region.dstOffset,
+                                           dst_binding->memory_offset + other_region.dstOffset + other_region.size);
+            const LogObjectList objlist(commandBuffer, dst_binding->memory_state->Handle(), dst_buffer_state.Handle());
+            const char* vuid = is_2 ? "VUID-VkCopyBufferInfo2-pRegions-12482" : "VUID-vkCmdCopyBuffer-pRegions-12482";
+            skip |= LogError(vuid, objlist, region_loc,
+                             "destination buffer range %s overlaps with pRegions[%" PRIu32
+                             "] destination buffer range %s\nThis will cause a write-after-write memory hazard.",
+                             vvl::string_range(dst_buffer_memory_range).c_str(), j, vvl::string_range(other_region_range).c_str());
         }
 
-        // Sort copy ranges to validate src vs dst overlap
+        // Gather copy ranges to validate src vs dst overlap
         if (validate_src_dst_overlaps) {
-            {
-                MemoryRange src_buffer_memory_range(src_binding->memory_offset + region.srcOffset,
-                                                    src_binding->memory_offset + region.srcOffset + region.size);
-                auto insert_pos = std::lower_bound(src_memory_ranges.begin(), src_memory_ranges.end(), src_buffer_memory_range);
-                src_memory_ranges.insert(insert_pos, src_buffer_memory_range);
-            }
-
-            {
-                MemoryRange dst_buffer_memory_range(dst_binding->memory_offset + region.dstOffset,
-                                                    dst_binding->memory_offset + region.dstOffset + region.size);
-                auto insert_pos = std::lower_bound(dst_memory_ranges.begin(), dst_memory_ranges.end(), dst_buffer_memory_range);
-                dst_memory_ranges.insert(insert_pos, dst_buffer_memory_range);
-            }
+            src_memory_ranges.emplace_back(src_binding->memory_offset + region.srcOffset,
+                                           src_binding->memory_offset + region.srcOffset + region.size);
+            dst_memory_ranges.emplace_back(dst_binding->memory_offset + region.dstOffset,
+                                           dst_binding->memory_offset + region.dstOffset + region.size);
         }
     }
 
     if (validate_src_dst_overlaps) {
+        std::sort(src_memory_ranges.begin(), src_memory_ranges.end());
+        std::sort(dst_memory_ranges.begin(), dst_memory_ranges.end());
+
         // Memory ranges are sorted, so looking for overlaps can be done in linear time
         auto src_ranges_it = src_memory_ranges.cbegin();
         auto dst_ranges_it = dst_memory_ranges.cbegin();
@@ -1536,6 +1559,16 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
     bool has_stencil_aspect = false;
     bool has_non_stencil_aspect = false;
     const bool same_image = (src_image_state == dst_image_state);
+
+    std::vector<std::pair<uint32_t, uint32_t>> src_dst_overlaps;
+    if (srcImage == dstImage) {
+        const bool is_src_multiplane = vkuFormatIsMultiplane(src_format);
+        src_dst_overlaps = GetSrcDstRegionOverlaps(regionCount, pRegions, [&](uint32_t i, uint32_t j) {
+            return GetRegionIntersection(pRegions[i], pRegions[j], src_image_type, is_src_multiplane).has_intersection;
+        });
+    }
+    auto src_dst_overlaps_it = src_dst_overlaps.cbegin();
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const Location src_subresource_loc = region_loc.dot(Field::srcSubresource);
@@ -1779,17 +1812,14 @@ bool CoreChecks::ValidateCmdCopyImage(VkCommandBuffer commandBuffer, VkImage src
         // Validation is only performed when source image is the same as destination image.
         // In the general case, the mapping between an image and its underlying memory is undefined,
         // so checking for memory overlaps is not possible.
-        if (srcImage == dstImage) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (auto intersection = GetRegionIntersection(pRegions[i], pRegions[j], src_image_type, is_src_multiplane);
-                    intersection.has_intersection) {
-                    vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
-                    skip |= LogError(vuid, all_objlist, loc,
-                                     "pRegion[%" PRIu32 "] copy source overlaps with pRegions[%" PRIu32
-                                     "] copy destination. Overlap info, with respect to image (%s):%s",
-                                     i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
-                }
-            }
+        for (; src_dst_overlaps_it != src_dst_overlaps.cend() && src_dst_overlaps_it->first == i; ++src_dst_overlaps_it) {
+            const uint32_t j = src_dst_overlaps_it->second;
+            const auto intersection = GetRegionIntersection(pRegions[i], pRegions[j], src_image_type, is_src_multiplane);
+            vuid = is_2 ? "VUID-VkCopyImageInfo2-pRegions-00124" : "VUID-vkCmdCopyImage-pRegions-00124";
+            skip |= LogError(vuid, all_objlist, loc,
+                             "pRegion[%" PRIu32 "] copy source overlaps with pRegions[%" PRIu32
+                             "] copy destination. Overlap info, with respect to image (%s):%s",
+                             i, j, FormatHandle(srcImage).c_str(), intersection.String().c_str());
         }
 
         // track aspect mask in loop through regions
@@ -3210,6 +3240,16 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
     }
 
     const bool same_image = (src_image_state == dst_image_state);
+
+    std::vector<std::pair<uint32_t, uint32_t>> src_dst_overlaps;
+    if (srcImage == dstImage) {
+        const bool is_src_multiplane = vkuFormatIsMultiplane(src_format);
+        src_dst_overlaps = GetSrcDstRegionOverlaps(regionCount, pRegions, [&](uint32_t i, uint32_t j) {
+            return RegionIntersectsBlit(&pRegions[i], &pRegions[j], src_type, is_src_multiplane);
+        });
+    }
+    auto src_dst_overlaps_it = src_dst_overlaps.cbegin();
+
     for (uint32_t i = 0; i < regionCount; i++) {
         const Location region_loc = loc.dot(Field::pRegions, i);
         const Location src_subresource_loc = region_loc.dot(Field::srcSubresource);
@@ -3495,15 +3535,10 @@ bool CoreChecks::ValidateCmdBlitImage(VkCommandBuffer commandBuffer, VkImage src
 
         // The union of all source regions, and the union of all destination regions, specified by the elements of regions,
         // must not overlap in memory
-        if (srcImage == dstImage) {
-            for (uint32_t j = 0; j < regionCount; j++) {
-                if (RegionIntersectsBlit(&region, &pRegions[j], src_image_state->GetImageType(),
-                                         vkuFormatIsMultiplane(src_format))) {
-                    vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
-                    skip |=
-                        LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i, j);
-                }
-            }
+        for (; src_dst_overlaps_it != src_dst_overlaps.cend() && src_dst_overlaps_it->first == i; ++src_dst_overlaps_it) {
+            vuid = is_2 ? "VUID-VkBlitImageInfo2-pRegions-00217" : "VUID-vkCmdBlitImage-pRegions-00217";
+            skip |= LogError(vuid, all_objlist, loc, "pRegion[%" PRIu32 "] src overlaps with pRegions[%" PRIu32 "] dst.", i,
+                             src_dst_overlaps_it->second);
         }
     }
     return skip;
@@ -4311,6 +4346,18 @@ bool CoreChecks::ValidateCmdCopyMemoryToImage(VkCommandBuffer command_buffer,
     skip |= ValidateImageSampleCount(command_buffer, *image_state, VK_SAMPLE_COUNT_1_BIT, image_loc,
                                      "VUID-VkCopyDeviceMemoryImageInfoKHR-image-07973");
 
+    // only the dst can't overlap, the src can (no such thing as a read-after-read hazard)
+    std::vector<std::pair<uint32_t, uint32_t>> dst_overlaps;
+    if (!is_memory_to_image) {
+        std::vector<vvl::range<VkDeviceAddress>> dst_ranges(copy_memory_info.regionCount);
+        for (uint32_t i = 0; i < copy_memory_info.regionCount; ++i) {
+            const auto& address_range = copy_memory_info.pRegions[i].addressRange;
+            dst_ranges[i] = vvl::range<VkDeviceAddress>(address_range.address, address_range.address + address_range.size);
+        }
+        dst_overlaps = vvl::GetIntersectingRangePairs(dst_ranges, [](uint32_t, uint32_t) { return true; });
+    }
+    auto dst_overlaps_it = dst_overlaps.cbegin();
+
     for (uint32_t i = 0; i < copy_memory_info.regionCount; ++i) {
         const VkDeviceMemoryImageCopyKHR& region = copy_memory_info.pRegions[i];
         const Location region_loc = info_loc.dot(Field::pRegions, i);
@@ -4437,24 +4484,19 @@ bool CoreChecks::ValidateCmdCopyMemoryToImage(VkCommandBuffer command_buffer,
                                                region.imageExtent.depth, region.imageLayout, region_loc.dot(Field::imageLayout),
                                                "VUID-VkCopyDeviceMemoryImageInfoKHR-imageLayout-13028");
 
-        // only the dst can't overlap, the src can (no such thing as a read-after-read hazard)
         // the image as a dst is a TODO tracked in https://github.com/KhronosGroup/Vulkan-ValidationLayers/issues/10125
-        if (!is_memory_to_image) {
+        for (; dst_overlaps_it != dst_overlaps.cend() && dst_overlaps_it->first == i; ++dst_overlaps_it) {
+            const uint32_t j = dst_overlaps_it->second;
+            const VkDeviceMemoryImageCopyKHR& other_region = copy_memory_info.pRegions[j];
             vvl::range<VkDeviceAddress> region_range{region.addressRange.address,
                                                      region.addressRange.address + region.addressRange.size};
-            for (uint32_t j = i + 1; j < copy_memory_info.regionCount; ++j) {
-                const VkDeviceMemoryImageCopyKHR& other_region = copy_memory_info.pRegions[j];
-                vvl::range<VkDeviceAddress> other_region_range{other_region.addressRange.address,
-                                                               other_region.addressRange.address + other_region.addressRange.size};
-                if (region_range.intersects(other_region_range)) {
-                    skip |=
-                        LogError("VUID-VkCopyDeviceMemoryImageInfoKHR-pRegions-12473", objlist, region_loc.dot(Field::addressRange),
-                                 "%s overlaps with pRegions[%" PRIu32
-                                 "].addressRange %s\nThis will cause a write-after-write memory hazard for buffers:\n%s",
-                                 string_range_hex(region_range).c_str(), j, string_range_hex(other_region_range).c_str(),
-                                 string_BuffersFromAddress(*device_state, region.addressRange.address).c_str());
-                }
-            }
+            vvl::range<VkDeviceAddress> other_region_range{other_region.addressRange.address,
+                                                           other_region.addressRange.address + other_region.addressRange.size};
+            skip |= LogError("VUID-VkCopyDeviceMemoryImageInfoKHR-pRegions-12473", objlist, region_loc.dot(Field::addressRange),
+                             "%s overlaps with pRegions[%" PRIu32
+                             "].addressRange %s\nThis will cause a write-after-write memory hazard for buffers:\n%s",
+                             string_range_hex(region_range).c_str(), j, string_range_hex(other_region_range).c_str(),
+                             string_BuffersFromAddress(*device_state, region.addressRange.address).c_str());
         }
 
         skip |= ValidateDeviceAddressCommands(command_buffer, region.addressRange.address, region.addressRange.size,
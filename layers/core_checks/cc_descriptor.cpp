@@ -47,6 +47,7 @@
 #include "drawdispatch/descriptor_validator.h"
 #include "drawdispatch/drawdispatch_vuids.h"
 #include "utils/assert_utils.h"
+#include "utils/hash_util.h"
 #include "utils/image_utils.h"
 #include "utils/math_utils.h"
 #include "utils/descriptor_utils.h"
@@ -866,9 +867,24 @@ bool CoreChecks::PreCallValidateGetDescriptorSetLayoutSupportKHR(VkDevice device
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
 // Return true if state is acceptable, or false and write an error message into error string
 bool CoreChecks::ValidateDrawState(const vvl::DescriptorSet& descriptor_set, uint32_t set_index,
-                                   const BindingVariableMap& binding_req_map, const vvl::CommandBuffer& cb_state,
-                                   const Location& loc, const LogObjectList& objlist) const {
+                                   const BindingVariableMap& binding_req_map, const vvl::StateObject& shader_state,
+                                   const vvl::CommandBuffer& cb_state, const Location& loc, const LogObjectList& objlist) const {
     bool result = false;
+    // The passes are counted per set and command buffer. The result also depends on the descriptors of the set (its change
+    // count is bumped when a view or buffer it uses is destroyed), on what the shaders use of it, and on the image layouts and
+    // attachments of the command buffer at this point of the recording: any of them changing is a new version, checked again.
+    hash_util::HashCombiner set_object;
+    set_object << descriptor_set.Handle().handle << cb_state.Handle().handle;
+    hash_util::HashCombiner set_version;
+    set_version << descriptor_set.GetId() << descriptor_set.GetChangeCount() << shader_state.GetId() << set_index;
+    set_version << cb_state.GetId() << cb_state.recording_count << cb_state.image_layout_change_count;
+    set_version << (cb_state.active_render_pass ? cb_state.active_render_pass->GetId() : 0u)
+                << (cb_state.active_framebuffer ? cb_state.active_framebuffer->GetId() : 0u);
+    core::CheckScope check_scope(check_throttle, vvl::CheckFamily::DescriptorSet, loc, set_object.Value(), set_version.Value(),
+                                 result);
+    if (check_scope.Throttled()) {
+        return result;
+    }
     const VkFramebuffer framebuffer = cb_state.active_framebuffer ? cb_state.active_framebuffer->VkHandle() : VK_NULL_HANDLE;
     // NOTE: GPU-AV needs non-const state objects to do lazy updates of descriptor state of only the dynamically used
     // descriptors, via the non-const version of ValidateBindingDynamic(), this code uses the const path only even it gives up
@@ -20,6 +20,7 @@
  */
 
 #include <fstream>
+#include <sstream>
 #include <vector>
 #include "utils/assert_utils.h"
 
@@ -29,6 +30,7 @@
 
 #include <vulkan/vk_enum_string_helper.h>
 #include "core_validation.h"
+#include "core_checks/cc_state_tracker.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/image_state.h"
 #include "state_tracker/device_state.h"
@@ -44,6 +46,7 @@
 #include "utils/file_system_utils.h"
 #include "utils/spirv_tools_utils.h"
 #include "containers/container_utils.h"
+#include "profiling/memory_report.h"
 #include "generated/extended_flags_helper_generator.h"
 
 bool CoreChecks::ValidateDeviceQueueFamily(uint32_t queue_family, const Location& loc, const char* vuid,
@@ -445,6 +448,26 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
 
     vvl::DeviceProxy::PreCallRecordDestroyDevice(device, pAllocator, record_obj);
 
+    if (check_throttle.Enabled()) {
+        std::ostringstream summary;
+        // Other is only timed, it is never throttled
+        for (uint32_t i = 0; i < static_cast<uint32_t>(vvl::CheckFamily::Other); ++i) {
+            const auto family = static_cast<vvl::CheckFamily>(i);
+            summary << "\n" << vvl::String(family) << ": " << check_throttle.RunCount(family) << " runs, "
+                    << check_throttle.ThrottledCount(family) << " throttled";
+        }
+        LogInfo("WARNING-check-throttle", device, record_obj.location,
+                "Checks costing more than %" PRIu32 " ns on average were skipped on objects they kept passing on:%s",
+                global_settings.check_throttle_budget_ns, summary.str().c_str());
+    }
+
+    // Only the stages with specialization constants go through the cache
+    if (specialized_shader_cache.HitCount() + specialized_shader_cache.MissCount() > 0) {
+        LogInfo("WARNING-specialized-shader-cache", device, record_obj.location,
+                "Specialized shader cache: %" PRIu64 " stages reused an already specialized module, %" PRIu64 " were specialized.",
+                specialized_shader_cache.HitCount(), specialized_shader_cache.MissCount());
+    }
+
     if (core_validation_cache) {
         Location loc(Func::vkDestroyDevice);
         size_t validation_cache_size = 0;
@@ -482,6 +505,36 @@ void CoreChecks::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationC
     }
 }
 
+void CoreChecks::ReportMemoryUsage(vvl::MemoryReport& report) {
+    using vvl::MemoryReport;
+    const char* owner = vvl::String(container_type);
+
+    uint64_t cb_count = 0;
+    uint64_t cb_bytes = 0;
+    device_state->ForEachShared<vvl::CommandBuffer>([&cb_count, &cb_bytes](const std::shared_ptr<vvl::CommandBuffer>& cb) {
+        auto guard = cb->ReadLock();
+        cb_bytes += core::SubState(*cb).HeapMemoryUsage();
+        cb_count++;
+    });
+    report.Add(owner, "CommandBuffer", cb_count, cb_bytes);
+
+    report.Add(owner, "SpecializedShaderCache", specialized_shader_cache.EntryCount(), specialized_shader_cache.HeapMemoryUsage());
+    report.Add(owner, "CheckThrottle", check_throttle.ObjectCount(), check_throttle.HeapMemoryUsage());
+
+    // Release barriers waiting for their acquire, per buffer and image
+    uint64_t barrier_count = 0;
+    uint64_t barrier_bytes = 0;
+    for (const auto& [handle, barriers] : qfo_release_buffer_barrier_map.snapshot()) {
+        barrier_count += barriers.size();
+        barrier_bytes += sizeof(handle) + sizeof(barriers) + MemoryReport::kNodeOverhead + MemoryReport::MapBytes(barriers);
+    }
+    for (const auto& [handle, barriers] : qfo_release_image_barrier_map.snapshot()) {
+        barrier_count += barriers.size();
+        barrier_bytes += sizeof(handle) + sizeof(barriers) + MemoryReport::kNodeOverhead + MemoryReport::MapBytes(barriers);
+    }
+    report.Add(owner, "QueueFamilyReleaseBarriers", barrier_count, barrier_bytes);
+}
+
 bool CoreChecks::PreCallValidateGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue,
                                                const ErrorObject& error_obj) const {
     bool skip = false;
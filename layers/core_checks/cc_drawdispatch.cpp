@@ -1959,7 +1959,7 @@ bool CoreChecks::ValidateActionStateDescriptorsPipeline(const LastBound& last_bo
                 const bool need_validate =
                     NeedDrawStateValidated(cb_state, descriptor_set, ds_slot, disabled[image_layout_validation]);
                 if (need_validate) {
-                    skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, cb_state, loc,
+                    skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, pipeline, cb_state, loc,
                                               LogObjectList(pipeline.Handle()));
                 }
             }
@@ -2223,7 +2223,7 @@ bool CoreChecks::ValidateActionStateDescriptorsShaderObject(const LastBound& las
                     const bool need_validate =
                         NeedDrawStateValidated(cb_state, descriptor_set, ds_slot, disabled[image_layout_validation]);
                     if (need_validate) {
-                        skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, cb_state, loc,
+                        skip |= ValidateDrawState(*descriptor_set, set_index, binding_req_map, shader_object, cb_state, loc,
                                                   LogObjectList(shader_object.Handle()));
                     }
                 }
@@ -240,6 +240,9 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location& loc, const vvl::Comm
         return false;
     }
     bool skip = false;
+    // A new recording, or a new command buffer with the same handle, is checked again
+    const uint64_t cb_version = (uint64_t(cb_state.GetId()) << 32) | uint32_t(cb_state.recording_count);
+    core::CheckScope check_scope(check_throttle, vvl::CheckFamily::ImageLayout, loc, cb_state.Handle().handle, cb_version, skip);
     // Iterate over the layout maps for each referenced image
     for (const auto& [image, cb_layout_map] : cb_state.image_layout_registry) {
         if (!cb_layout_map || cb_layout_map->empty()) {
@@ -260,6 +263,11 @@ bool CoreChecks::ValidateCmdBufImageLayouts(const Location& loc, const vvl::Comm
         const auto subresource_count = image_state->subresource_encoder.SubresourceCount();
         auto it = local_image_layout_state.try_emplace(image_state.get(), subresource_count).first;
         ImageLayoutMap& local_layout_map = it->second;
+        if (check_scope.Throttled()) {
+            // The next command buffers of the submission are still validated against the layouts set by this one
+            sparse_container::splice(local_layout_map, *cb_layout_map, GlobalLayoutUpdater());
+            continue;
+        }
 
         const auto* global_layout_map = image_state->layout_map.get();
         ASSERT_AND_CONTINUE(global_layout_map);
@@ -29,6 +29,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/cmd_buffer_state.h"
 #include "generated/dispatch_functions.h"
+#include "error_message/log_capture.h"
 
 bool CoreChecks::IsBeforeCtsVersion(uint32_t major, uint32_t minor, uint32_t subminor) const {
     // If VK_KHR_driver_properties is not enabled then conformance version will not be set
@@ -44,6 +45,33 @@ bool CoreChecks::IsBeforeCtsVersion(uint32_t major, uint32_t minor, uint32_t sub
     return phys_dev_props_core12.conformanceVersion.subminor < subminor;
 }
 
+// Runs validate_create_info(i) for each create info of a vkCreate*Pipelines call.
+// With parallel_pipeline_validation the create infos are validated on the worker pool. Each create info logs into its own
+// LogCapture and the captures are flushed in create info order, so the messages come out the same as with serial validation.
+bool CoreChecks::ValidatePipelineCreateInfos(uint32_t count, const std::function<bool(uint32_t)>& validate_create_info) const {
+    bool skip = false;
+    if (!pipeline_validation_pool || count < 2) {
+        for (uint32_t i = 0; i < count; i++) {
+            skip |= validate_create_info(i);
+        }
+        return skip;
+    }
+
+    std::vector<LogCapture> captures(count);
+    // Not std::vector<bool>, each task writes its own element
+    std::vector<uint8_t> results(count, 0);
+    pipeline_validation_pool->ParallelFor(count, [&](uint32_t i) {
+        LogCapture::Scope capture_scope(captures[i]);
+        results[i] = validate_create_info(i) ? 1 : 0;
+    });
+
+    for (uint32_t i = 0; i < count; i++) {
+        skip |= results[i] != 0;
+        skip |= captures[i].Flush(*debug_report);
+    }
+    return skip;
+}
+
 // This can be chained in the vkCreate*Pipelines() function or the VkPipelineShaderStageCreateInfo
 bool CoreChecks::ValidatePipelineRobustnessCreateInfo(const vvl::Pipeline& pipeline,
                                                       const VkPipelineRobustnessCreateInfo& pipeline_robustness_info,
@@ -28,12 +28,11 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                                                        const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                        const ErrorObject& error_obj, PipelineStates& pipeline_states,
                                                        chassis::CreateComputePipelines& chassis_state) const {
-    bool skip = false;
-
-    skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    // Create infos are validated independently of each other, see ValidatePipelineCreateInfos
+    auto validate_create_info = [&](uint32_t i) {
+        bool skip = false;
         const vvl::Pipeline* pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        ASSERT_AND_RETURN_SKIP(pipeline);
 
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const Location stage_info = create_info_loc.dot(Field::stage);
@@ -69,7 +68,13 @@ bool CoreChecks::PreCallValidateCreateComputePipelines(VkDevice device, VkPipeli
                              "was created with VK_PIPELINE_LAYOUT_CREATE_INDEPENDENT_SETS_BIT_EXT (which is only designed for "
                              "graphics pipeline Libraries).");
         }
-    }
+        return skip;
+    };
+
+    bool skip = false;
+
+    skip |= ValidateDeviceQueueSupport(error_obj.location);
+    skip |= ValidatePipelineCreateInfos(count, validate_create_info);
     return skip;
 }
 
@@ -52,10 +52,9 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                                                         const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                         const ErrorObject& error_obj, PipelineStates& pipeline_states,
                                                         chassis::CreateGraphicsPipelines& chassis_state) const {
-    bool skip = false;
-
-    skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    // Create infos are validated independently of each other, see ValidatePipelineCreateInfos
+    auto validate_create_info = [&](uint32_t i) {
+        bool skip = false;
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         skip |= ValidateGraphicsPipeline(*pipeline_states[i].get(), pCreateInfos[i].pNext, create_info_loc);
         skip |= ValidateGraphicsPipelineDerivatives(pipeline_states, i, create_info_loc);
@@ -73,7 +72,13 @@ bool CoreChecks::PreCallValidateCreateGraphicsPipelines(VkDevice device, VkPipel
                 }
             }
         }
-    }
+        return skip;
+    };
+
+    bool skip = false;
+
+    skip |= ValidateDeviceQueueSupport(error_obj.location);
+    skip |= ValidatePipelineCreateInfos(count, validate_create_info);
     return skip;
 }
 
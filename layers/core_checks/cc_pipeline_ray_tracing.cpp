@@ -165,12 +165,11 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                                                             const VkRayTracingPipelineCreateInfoNV* pCreateInfos,
                                                             const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                             const ErrorObject& error_obj, PipelineStates& pipeline_states) const {
-    bool skip = false;
-
-    skip |= ValidateDeviceQueueSupport(error_obj.location);
-    for (uint32_t i = 0; i < count; i++) {
+    // Create infos are validated independently of each other, see ValidatePipelineCreateInfos
+    auto validate_create_info = [&](uint32_t i) {
+        bool skip = false;
         const vvl::Pipeline* pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        ASSERT_AND_RETURN_SKIP(pipeline);
 
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const auto& create_info = pipeline->RayTracingCreateInfo();
@@ -210,7 +209,13 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesNV(VkDevice device, VkP
                              "maxRecursionDepth (%" PRIu32 ")",
                              create_info.maxRecursionDepth, phys_dev_ext_props.ray_tracing_props_nv.maxRecursionDepth);
         }
-    }
+        return skip;
+    };
+
+    bool skip = false;
+
+    skip |= ValidateDeviceQueueSupport(error_obj.location);
+    skip |= ValidatePipelineCreateInfos(count, validate_create_info);
     return skip;
 }
 
@@ -220,15 +225,11 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
                                                              const VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines,
                                                              const ErrorObject& error_obj, PipelineStates& pipeline_states,
                                                              chassis::CreateRayTracingPipelinesKHR& chassis_state) const {
-    bool skip = false;
-
-    skip |= ValidateDeviceQueueSupport(error_obj.location);
-    skip |= ValidateDeferredOperation(device, deferredOperation, error_obj.location.dot(Field::deferredOperation),
-                                      "VUID-vkCreateRayTracingPipelinesKHR-deferredOperation-03678");
-
-    for (uint32_t i = 0; i < count; i++) {
+    // Create infos are validated independently of each other, see ValidatePipelineCreateInfos
+    auto validate_create_info = [&](uint32_t i) {
+        bool skip = false;
         const vvl::Pipeline* pipeline = pipeline_states[i].get();
-        ASSERT_AND_CONTINUE(pipeline);
+        ASSERT_AND_RETURN_SKIP(pipeline);
 
         const Location create_info_loc = error_obj.location.dot(Field::pCreateInfos, i);
         const auto& create_info = pipeline->RayTracingCreateInfo();
@@ -287,7 +288,15 @@ bool CoreChecks::PreCallValidateCreateRayTracingPipelinesKHR(VkDevice device, Vk
             skip |=
                 ValidateRayTracingPipelineLibrary(*pipeline, pCreateInfos[i], *create_info.pLibraryInfo->ptr(), create_info_loc);
         }
-    }
+        return skip;
+    };
+
+    bool skip = false;
+
+    skip |= ValidateDeviceQueueSupport(error_obj.location);
+    skip |= ValidateDeferredOperation(device, deferredOperation, error_obj.location.dot(Field::deferredOperation),
+                                      "VUID-vkCreateRayTracingPipelinesKHR-deferredOperation-03678");
+    skip |= ValidatePipelineCreateInfos(count, validate_create_info);
 
     return skip;
 }
@@ -19,13 +19,16 @@
 
 #include <algorithm>
 #include <assert.h>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <vulkan/vk_enum_string_helper.h>
 #include <vulkan/utility/vk_format_utils.h>
 #include <vulkan/vulkan_core.h>
 #include "containers/limits.h"
 #include "containers/range.h"
+#include "containers/range_sweep.h"
 #include "core_validation.h"
 #include "cc_vuid_maps.h"
 #include "core_checks/cc_state_tracker.h"
@@ -146,70 +149,94 @@ bool CoreChecks::PreCallValidateGetAccelerationStructureBuildSizesKHR(
 
 bool CoreChecks::ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t infoCount,
                                                                const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
-                                                               uint32_t info_i, const ErrorObject& error_obj) const {
-    using vvl::range;
-
+                                                               const ErrorObject& error_obj) const {
     bool skip = false;
-    const VkAccelerationStructureBuildGeometryInfoKHR& info = pInfos[info_i];
-    const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
-    const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
-    const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
-
-    const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
-
-    if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state && dst_as_state) {
-        const char* vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
-                           : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                               ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
-                               : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
-        skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
-                                                       info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
-                                                       info_i_loc.dot(Field::dstAccelerationStructure), vuid);
-    }
-
-    // Loop on other acceleration structure builds info.
-    // Given that comparisons are commutative, only need to consider elements after info_i
-    assert(infoCount > info_i);
-    for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-        // Validate that scratch buffer's memory does not overlap destination acceleration structure's memory, or source
-        // acceleration structure's memory if build mode is update, or other scratch buffers' memory.
-        // Here validation is pessimistic: if one buffer associated to pInfos[other_info_j].scratchData.deviceAddress has an
-        // overlap, an error will be logged.
-
-        const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j);
-
-        const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(other_info.dstAccelerationStructure);
-        const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(other_info.srcAccelerationStructure);
-
-        // Validate destination acceleration structure's memory is not overlapped by another source acceleration structure's
-        // memory that is going to be updated by this cmd
-        if (dst_as_state && other_src_as_state) {
-            if (other_info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
-                const char* vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
-                                   : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                       ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
-                                       : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
-
-                skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                               info_i_loc.dot(Field::dstAccelerationStructure), *other_src_as_state,
-                                                               other_info_j_loc.dot(Field::srcAccelerationStructure), vuid);
-            }
+    const Func function = error_obj.location.function;
+    const char* vuid_03668 = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresKHR-pInfos-03668"
+                             : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-pInfos-03668"
+                                 : "VUID-vkBuildAccelerationStructuresKHR-pInfos-03668";
+    const char* vuid_03701 = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701"
+                             : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03701"
+                                 : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701";
+    const char* vuid_03702 = function == Func::vkCmdBuildAccelerationStructuresKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
+                             : function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
+                                 ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
+                                 : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
+
+    // Memory of the destination acceleration structures, and of the source ones in update mode.
+    // Comparing every pair of infos is too slow for batches of thousands of builds, instead each acceleration structure gets the
+    // range it covers in the fake address space of the device memories (where two ranges intersect only if they share memory), and
+    // only the intersecting pairs found by a sweep over those ranges are checked.
+    struct AccelStructMemory {
+        std::shared_ptr<const vvl::AccelerationStructureKHR> as_state;
+        uint32_t info_i;
+        bool is_src;
+    };
+    std::vector<AccelStructMemory> as_memories;
+    std::vector<vvl::range<VkDeviceSize>> memory_ranges;
+    as_memories.reserve(2 * infoCount);
+    memory_ranges.reserve(2 * infoCount);
+
+    const auto add_as_memory = [this, &as_memories, &memory_ranges](std::shared_ptr<const vvl::AccelerationStructureKHR> as_state,
+                                                                     uint32_t info_i, bool is_src) {
+        const vvl::BufferAndOffset buffer = as_state->GetFirstValidBuffer(*device_state);
+        if (!buffer) {
+            return;
+        }
+        vvl::range<VkDeviceSize> memory_range;
+        if (buffer.state->sparse) {
+            // Sparse memory has no single fake address, compare it with everything
+            memory_range = {0, vvl::kU64Max};
+        } else if (buffer.state->Binding()) {
+            const VkDeviceSize begin = buffer.state->GetFakeBaseAddress() + buffer.offset;
+            memory_range = {begin, begin + as_state->GetSize()};
+        } else {
+            return;  // No memory bound, nothing can overlap
+        }
+        as_memories.emplace_back(AccelStructMemory{std::move(as_state), info_i, is_src});
+        memory_ranges.emplace_back(memory_range);
+    };
+
+    for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
+        const Location info_i_loc = error_obj.location.dot(Field::pInfos, info_i);
+        const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
+        const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+        const bool info_in_mode_update = info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR;
+
+        if (info_in_mode_update && info.srcAccelerationStructure != info.dstAccelerationStructure && src_as_state &&
+            dst_as_state) {
+            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *src_as_state,
+                                                           info_i_loc.dot(Field::srcAccelerationStructure), *dst_as_state,
+                                                           info_i_loc.dot(Field::dstAccelerationStructure), vuid_03668);
         }
 
-        // Validate that there is no destination acceleration structures' memory overlaps
-        if (dst_as_state && other_dst_as_state) {
-            const char* vuid = error_obj.location.function == Func::vkCmdBuildAccelerationStructuresKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702"
-                               : error_obj.location.function == Func::vkCmdBuildAccelerationStructuresIndirectKHR
-                                   ? "VUID-vkCmdBuildAccelerationStructuresIndirectKHR-dstAccelerationStructure-03702"
-                                   : "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702";
-
-            skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *dst_as_state,
-                                                           info_i_loc.dot(Field::dstAccelerationStructure), *other_dst_as_state,
-                                                           other_info_j_loc.dot(Field::dstAccelerationStructure), vuid);
+        if (dst_as_state) {
+            add_as_memory(dst_as_state, info_i, false);
         }
+        if (src_as_state && info_in_mode_update) {
+            add_as_memory(src_as_state, info_i, true);
+        }
+    }
+
+    // Source acceleration structures are only read, and the source and destination of the same info were checked above
+    const auto candidate_pairs = vvl::GetIntersectingRangePairs(memory_ranges, [&as_memories](uint32_t a, uint32_t b) {
+        return as_memories[a].info_i != as_memories[b].info_i && !(as_memories[a].is_src && as_memories[b].is_src);
+    });
+    for (const auto& [a, b] : candidate_pairs) {
+        // Report from the destination, and from the first info when both are destinations
+        const bool swap = as_memories[a].is_src;
+        const AccelStructMemory& as_memory_a = swap ? as_memories[b] : as_memories[a];
+        const AccelStructMemory& as_memory_b = swap ? as_memories[a] : as_memories[b];
+        const Location a_loc = error_obj.location.dot(Field::pInfos, as_memory_a.info_i).dot(Field::dstAccelerationStructure);
+        const Location b_loc = error_obj.location.dot(Field::pInfos, as_memory_b.info_i)
+                                   .dot(as_memory_b.is_src ? Field::srcAccelerationStructure : Field::dstAccelerationStructure);
+        skip |= ValidateAccelStructsMemoryDoNotOverlap(error_obj.location, objlist, *as_memory_a.as_state, a_loc,
+                                                       *as_memory_b.as_state, b_loc, as_memory_b.is_src ? vuid_03701 : vuid_03702);
     }
 
     return skip;
@@ -228,45 +255,22 @@ bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAliasing
         uint32_t info_i = 0;
         AddressRangeOrigin origin = AddressRangeOrigin::Undefined;
     };
-    // Gather all address ranges  from source acceleration structtures, destination acceleration structures
-    // and scratch buffers in a single sorted vector, to more rapidly lookup overlaps
+    // Gather all address ranges from source acceleration structures, destination acceleration structures and scratch buffers
+    // once, the overlapping ones are then found with a sweep over the ranges instead of comparing every pair
     std::vector<AddressRange> address_ranges;
     address_ranges.reserve(3 * info_count);
-
-    const auto insert_address = [](std::vector<AddressRange>& address_ranges, const AddressRange address_range) {
-        std::optional<AddressRange> overlapped_range = std::nullopt;
-        auto insert_pos =
-            std::lower_bound(address_ranges.begin(), address_ranges.end(), address_range,
-                             [&overlapped_range](const AddressRange iter, const AddressRange new_elt) -> bool {
-                                 const vvl::range<VkDeviceAddress> intersection = iter.range & new_elt.range;
-                                 if (intersection.non_empty()) {
-                                     const bool both_src_as_ranges = iter.origin == AddressRangeOrigin::SrcAccelStruct &&
-                                                                     new_elt.origin == AddressRangeOrigin::SrcAccelStruct;
-                                     const bool as_update =
-                                         iter.info_i == new_elt.info_i && ((iter.origin == AddressRangeOrigin::SrcAccelStruct &&
-                                                                            new_elt.origin == AddressRangeOrigin::DstAccelStruct) ||
-                                                                           (new_elt.origin == AddressRangeOrigin::SrcAccelStruct &&
-                                                                            iter.origin == AddressRangeOrigin::DstAccelStruct));
-
-                                     if (!both_src_as_ranges && !as_update) {
-                                         overlapped_range = iter;
-                                     }
-                                 }
-
-                                 return iter.range < new_elt.range;
-                             });
-
-        address_ranges.insert(insert_pos, address_range);
-        return overlapped_range;
-    };
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> src_as_states(info_count);
+    std::vector<std::shared_ptr<const vvl::AccelerationStructureKHR>> dst_as_states(info_count);
 
     for (const auto [info_i, info] : vvl::enumerate(p_infos, info_count)) {
         const Location info_i_loc = loc.dot(Field::pInfos, info_i);
 
         const auto dst_as_state = Get<vvl::AccelerationStructureKHR>(info.dstAccelerationStructure);
+        dst_as_states[info_i] = dst_as_state;
 
         if (const auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
             src_as_state && info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
+            src_as_states[info_i] = src_as_state;
             if (const vvl::range<VkDeviceAddress> src_as_range = src_as_state->GetVvlEffectiveDeviceAddressRange();
                 !src_as_range.empty()) {
                 if (dst_as_state && dst_as_state->VkHandle() != src_as_state->VkHandle()) {
@@ -282,104 +286,14 @@ bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAliasing
                                      string_range_hex(dst_as_src_as_intersection).c_str());
                     }
                 }
-
-                const AddressRange src_as_address_range = {src_as_range, info_i, AddressRangeOrigin::SrcAccelStruct};
-                const std::optional<AddressRange> overlapped_address_range = insert_address(address_ranges, src_as_address_range);
-                if (overlapped_address_range.has_value()) {
-                    switch (overlapped_address_range->origin) {
-                        case AddressRangeOrigin::SrcAccelStruct: {
-                            // Valid overlap, source acceleration structures being read only
-                            break;
-                        }
-                        case AddressRangeOrigin::DstAccelStruct: {
-                            if (const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(
-                                    p_infos[overlapped_address_range->info_i].dstAccelerationStructure)) {
-                                const vvl::range<VkDeviceAddress> src_as_other_dst_as_intersection =
-                                    src_as_address_range.range & overlapped_address_range->range;
-
-                                skip |= LogError(
-                                    "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701",
-                                    LogObjectList(cmd_buffer, src_as_state->VkHandle(), other_dst_as_state->VkHandle()),
-                                    info_i_loc.dot(Field::srcAccelerationStructure),
-                                    "is in update mode, but overlaps with dstAccelerationStructure of pInfos[%" PRIu32
-                                    "] on device address range %s.",
-                                    overlapped_address_range->info_i, string_range_hex(src_as_other_dst_as_intersection).c_str());
-                            }
-                            break;
-                        }
-                        case AddressRangeOrigin::Scratch: {
-                            const vvl::range<VkDeviceAddress> src_as_other_scratch_intersection =
-                                src_as_address_range.range & overlapped_address_range->range;
-                            skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-scratchData-03705",
-                                             LogObjectList(cmd_buffer, src_as_state->VkHandle()),
-                                             info_i_loc.dot(Field::srcAccelerationStructure),
-                                             "overlaps with scratch buffer of pInfos[%" PRIu32 "] on device address range %s.",
-                                             overlapped_address_range->info_i,
-                                             string_range_hex(src_as_other_scratch_intersection).c_str());
-                            break;
-                        }
-                        case AddressRangeOrigin::Undefined:
-                            assert(false);
-                            break;
-                    }
-                }
+                address_ranges.emplace_back(AddressRange{src_as_range, info_i, AddressRangeOrigin::SrcAccelStruct});
             }
         }
 
         if (dst_as_state) {
             if (const vvl::range<VkDeviceAddress> dst_as_range = dst_as_state->GetVvlEffectiveDeviceAddressRange();
                 !dst_as_range.empty()) {
-                const AddressRange dst_as_address_range = {dst_as_range, info_i, AddressRangeOrigin::DstAccelStruct};
-                const std::optional<AddressRange> overlapped_address_range = insert_address(address_ranges, dst_as_address_range);
-                if (overlapped_address_range.has_value()) {
-                    switch (overlapped_address_range->origin) {
-                        case AddressRangeOrigin::SrcAccelStruct: {
-                            if (const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(
-                                    p_infos[overlapped_address_range->info_i].srcAccelerationStructure)) {
-                                const vvl::range<VkDeviceAddress> dst_as_other_src_as_intersection =
-                                    dst_as_address_range.range & overlapped_address_range->range;
-
-                                skip |= LogError(
-                                    "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701",
-                                    LogObjectList(cmd_buffer, dst_as_state->VkHandle(), other_src_as_state->VkHandle()),
-                                    info_i_loc.dot(Field::dstAccelerationStructure),
-                                    "overlaps with srcAccelerationStructure of pInfos[%" PRIu32
-                                    "], which is in update mode, on device address range %s.",
-                                    overlapped_address_range->info_i, string_range_hex(dst_as_other_src_as_intersection).c_str());
-                            }
-                            break;
-                        }
-                        case AddressRangeOrigin::DstAccelStruct: {
-                            if (const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(
-                                    p_infos[overlapped_address_range->info_i].dstAccelerationStructure)) {
-                                const vvl::range<VkDeviceAddress> dst_as_other_dst_as_intersection =
-                                    dst_as_address_range.range & overlapped_address_range->range;
-
-                                skip |= LogError(
-                                    "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702",
-                                    LogObjectList(cmd_buffer, dst_as_state->VkHandle(), other_dst_as_state->VkHandle()),
-                                    info_i_loc.dot(Field::dstAccelerationStructure),
-                                    "overlaps with dstAccelerationStructure of pInfos[%" PRIu32 "], on device address range %s.",
-                                    overlapped_address_range->info_i, string_range_hex(dst_as_other_dst_as_intersection).c_str());
-                            }
-                            break;
-                        }
-                        case AddressRangeOrigin::Scratch: {
-                            const vvl::range<VkDeviceAddress> src_as_other_scratch_intersection =
-                                dst_as_address_range.range & overlapped_address_range->range;
-                            skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03703",
-                                             LogObjectList(cmd_buffer, dst_as_state->VkHandle()),
-                                             info_i_loc.dot(Field::dstAccelerationStructure),
-                                             "overlaps with scratch buffer of pInfos[%" PRIu32 "] on device address range %s.",
-                                             overlapped_address_range->info_i,
-                                             string_range_hex(src_as_other_scratch_intersection).c_str());
-                            break;
-                        }
-                        case AddressRangeOrigin::Undefined:
-                            assert(false);
-                            break;
-                    }
-                }
+                address_ranges.emplace_back(AddressRange{dst_as_range, info_i, AddressRangeOrigin::DstAccelStruct});
             }
         }
 
@@ -393,55 +307,154 @@ bool CoreChecks::ValidateAccelerationStructuresDeviceScratchBufferMemoryAliasing
 
             const vvl::range<VkDeviceAddress> scratch_range = {info.scratchData.deviceAddress,
                                                                info.scratchData.deviceAddress + assumed_scratch_size};
+            address_ranges.emplace_back(AddressRange{scratch_range, info_i, AddressRangeOrigin::Scratch});
+        }
+    }
 
-            const AddressRange scratch_address_range = {scratch_range, info_i, AddressRangeOrigin::Scratch};
-            const std::optional<AddressRange> overlapped_address_range = insert_address(address_ranges, scratch_address_range);
-            if (overlapped_address_range.has_value()) {
-                switch (overlapped_address_range->origin) {
-                    case AddressRangeOrigin::SrcAccelStruct: {
-                        if (const auto other_src_as_state = Get<vvl::AccelerationStructureKHR>(
-                                p_infos[overlapped_address_range->info_i].srcAccelerationStructure)) {
-                            const vvl::range<VkDeviceAddress> scratch_other_src_as_intersection =
-                                scratch_address_range.range & overlapped_address_range->range;
+    // Each range reports its first overlap with a range gathered before it
+    std::vector<vvl::range<VkDeviceAddress>> ranges;
+    ranges.reserve(address_ranges.size());
+    for (const AddressRange& address_range : address_ranges) {
+        ranges.emplace_back(address_range.range);
+    }
+    std::vector<uint32_t> first_overlaps(address_ranges.size(), vvl::kNoIndex32);
+    vvl::ForEachIntersectingRangePair(ranges, [&address_ranges, &first_overlaps](uint32_t i, uint32_t j) {
+        const AddressRange& a = address_ranges[i];
+        const AddressRange& b = address_ranges[j];
+        // Source acceleration structures are read only, and an update can be done in place
+        const bool both_src_as_ranges =
+            a.origin == AddressRangeOrigin::SrcAccelStruct && b.origin == AddressRangeOrigin::SrcAccelStruct;
+        const bool as_update = a.info_i == b.info_i && ((a.origin == AddressRangeOrigin::SrcAccelStruct &&
+                                                          b.origin == AddressRangeOrigin::DstAccelStruct) ||
+                                                         (b.origin == AddressRangeOrigin::SrcAccelStruct &&
+                                                          a.origin == AddressRangeOrigin::DstAccelStruct));
+        if (!both_src_as_ranges && !as_update) {
+            first_overlaps[j] = std::min(first_overlaps[j], i);
+        }
+    });
 
+    for (uint32_t range_i = 0; range_i < static_cast<uint32_t>(address_ranges.size()); ++range_i) {
+        if (first_overlaps[range_i] == vvl::kNoIndex32) {
+            continue;
+        }
+        const AddressRange& address_range = address_ranges[range_i];
+        const AddressRange& overlapped_address_range = address_ranges[first_overlaps[range_i]];
+        const vvl::range<VkDeviceAddress> intersection = address_range.range & overlapped_address_range.range;
+        const Location info_i_loc = loc.dot(Field::pInfos, address_range.info_i);
+
+        switch (address_range.origin) {
+            case AddressRangeOrigin::SrcAccelStruct: {
+                const auto& src_as_state = src_as_states[address_range.info_i];
+                switch (overlapped_address_range.origin) {
+                    case AddressRangeOrigin::SrcAccelStruct: {
+                        // Valid overlap, source acceleration structures being read only
+                        break;
+                    }
+                    case AddressRangeOrigin::DstAccelStruct: {
+                        if (const auto& other_dst_as_state = dst_as_states[overlapped_address_range.info_i]) {
+                            skip |= LogError(
+                                "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701",
+                                LogObjectList(cmd_buffer, src_as_state->VkHandle(), other_dst_as_state->VkHandle()),
+                                info_i_loc.dot(Field::srcAccelerationStructure),
+                                "is in update mode, but overlaps with dstAccelerationStructure of pInfos[%" PRIu32
+                                "] on device address range %s.",
+                                overlapped_address_range.info_i, string_range_hex(intersection).c_str());
+                        }
+                        break;
+                    }
+                    case AddressRangeOrigin::Scratch: {
+                        skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-scratchData-03705",
+                                         LogObjectList(cmd_buffer, src_as_state->VkHandle()),
+                                         info_i_loc.dot(Field::srcAccelerationStructure),
+                                         "overlaps with scratch buffer of pInfos[%" PRIu32 "] on device address range %s.",
+                                         overlapped_address_range.info_i, string_range_hex(intersection).c_str());
+                        break;
+                    }
+                    case AddressRangeOrigin::Undefined:
+                        assert(false);
+                        break;
+                }
+                break;
+            }
+            case AddressRangeOrigin::DstAccelStruct: {
+                const auto& dst_as_state = dst_as_states[address_range.info_i];
+                switch (overlapped_address_range.origin) {
+                    case AddressRangeOrigin::SrcAccelStruct: {
+                        if (const auto& other_src_as_state = src_as_states[overlapped_address_range.info_i]) {
+                            skip |= LogError(
+                                "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03701",
+                                LogObjectList(cmd_buffer, dst_as_state->VkHandle(), other_src_as_state->VkHandle()),
+                                info_i_loc.dot(Field::dstAccelerationStructure),
+                                "overlaps with srcAccelerationStructure of pInfos[%" PRIu32
+                                "], which is in update mode, on device address range %s.",
+                                overlapped_address_range.info_i, string_range_hex(intersection).c_str());
+                        }
+                        break;
+                    }
+                    case AddressRangeOrigin::DstAccelStruct: {
+                        if (const auto& other_dst_as_state = dst_as_states[overlapped_address_range.info_i]) {
+                            skip |= LogError(
+                                "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03702",
+                                LogObjectList(cmd_buffer, dst_as_state->VkHandle(), other_dst_as_state->VkHandle()),
+                                info_i_loc.dot(Field::dstAccelerationStructure),
+                                "overlaps with dstAccelerationStructure of pInfos[%" PRIu32 "], on device address range %s.",
+                                overlapped_address_range.info_i, string_range_hex(intersection).c_str());
+                        }
+                        break;
+                    }
+                    case AddressRangeOrigin::Scratch: {
+                        skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03703",
+                                         LogObjectList(cmd_buffer, dst_as_state->VkHandle()),
+                                         info_i_loc.dot(Field::dstAccelerationStructure),
+                                         "overlaps with scratch buffer of pInfos[%" PRIu32 "] on device address range %s.",
+                                         overlapped_address_range.info_i, string_range_hex(intersection).c_str());
+                        break;
+                    }
+                    case AddressRangeOrigin::Undefined:
+                        assert(false);
+                        break;
+                }
+                break;
+            }
+            case AddressRangeOrigin::Scratch: {
+                switch (overlapped_address_range.origin) {
+                    case AddressRangeOrigin::SrcAccelStruct: {
+                        if (const auto& other_src_as_state = src_as_states[overlapped_address_range.info_i]) {
                             skip |= LogError(
                                 "VUID-vkCmdBuildAccelerationStructuresKHR-scratchData-03705",
                                 LogObjectList(cmd_buffer, other_src_as_state->VkHandle()), info_i_loc.dot(Field::scratchData),
                                 "overlaps with srcAccelerationStructure of pInfos[%" PRIu32
                                 "], which is in update mode, on device address range %s.",
-                                overlapped_address_range->info_i, string_range_hex(scratch_other_src_as_intersection).c_str());
+                                overlapped_address_range.info_i, string_range_hex(intersection).c_str());
                         }
                         break;
                     }
                     case AddressRangeOrigin::DstAccelStruct: {
-                        if (const auto other_dst_as_state = Get<vvl::AccelerationStructureKHR>(
-                                p_infos[overlapped_address_range->info_i].dstAccelerationStructure)) {
-                            const vvl::range<VkDeviceAddress> dst_as_other_dst_as_intersection =
-                                scratch_address_range.range & overlapped_address_range->range;
-
+                        if (const auto& other_dst_as_state = dst_as_states[overlapped_address_range.info_i]) {
                             skip |= LogError(
                                 "VUID-vkCmdBuildAccelerationStructuresKHR-dstAccelerationStructure-03703",
                                 LogObjectList(cmd_buffer, other_dst_as_state->VkHandle()), info_i_loc.dot(Field::scratchData),
                                 "overlaps with dstAccelerationStructure of pInfos[%" PRIu32 "], on device address range %s.",
-                                overlapped_address_range->info_i, string_range_hex(dst_as_other_dst_as_intersection).c_str());
+                                overlapped_address_range.info_i, string_range_hex(intersection).c_str());
                         }
                         break;
                     }
                     case AddressRangeOrigin::Scratch: {
-                        const vvl::range<VkDeviceAddress> src_as_other_scratch_intersection =
-                            scratch_address_range.range & overlapped_address_range->range;
-                        skip |=
-                            LogError("VUID-vkCmdBuildAccelerationStructuresKHR-scratchData-03704", LogObjectList(cmd_buffer),
-                                     info_i_loc.dot(Field::scratchData),
-                                     "overlaps with scratch buffer of pInfos[%" PRIu32 "] on device address range %s.",
-                                     overlapped_address_range->info_i, string_range_hex(src_as_other_scratch_intersection).c_str());
+                        skip |= LogError("VUID-vkCmdBuildAccelerationStructuresKHR-scratchData-03704", LogObjectList(cmd_buffer),
+                                         info_i_loc.dot(Field::scratchData),
+                                         "overlaps with scratch buffer of pInfos[%" PRIu32 "] on device address range %s.",
+                                         overlapped_address_range.info_i, string_range_hex(intersection).c_str());
                         break;
                     }
                     case AddressRangeOrigin::Undefined:
                         assert(false);
                         break;
                 }
+                break;
             }
+            case AddressRangeOrigin::Undefined:
+                assert(false);
+                break;
         }
     }
 
@@ -1172,6 +1185,8 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
     skip |= ValidateDeferredOperation(device, deferredOperation, error_obj.location.dot(Field::deferredOperation),
                                       "VUID-vkBuildAccelerationStructuresKHR-deferredOperation-03678");
 
+    // Overlaps are looked for once all the scratch ranges are known, see below
+    std::vector<vvl::range<uint64_t>> scratch_addr_ranges(infoCount);
     for (const auto [info_i, info] : vvl::enumerate(pInfos, infoCount)) {
         const Location info_loc = error_obj.location.dot(Field::pInfos, info_i);
         auto src_as_state = Get<vvl::AccelerationStructureKHR>(info.srcAccelerationStructure);
@@ -1252,34 +1267,9 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, info_i, error_obj);
         const VkDeviceSize scratch_i_size = rt::ComputeScratchSize(rt::BuildType::Host, device, info, ppBuildRangeInfos[info_i]);
         auto scratch_i_host_addr = reinterpret_cast<uint64_t>(info.scratchData.hostAddress);
-        const vvl::range<uint64_t> scratch_addr_range(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
-
-        assert(infoCount > info_i);
-        for (auto [other_info_j, other_info] : vvl::enumerate(pInfos + info_i + 1, infoCount - (info_i + 1))) {
-            const Location other_info_j_loc = error_obj.location.dot(Field::pInfos, other_info_j + info_i + 1);
-            const VkDeviceSize other_scratch_size =
-                rt::ComputeScratchSize(rt::BuildType::Host, device, other_info, ppBuildRangeInfos[other_info_j]);
-            auto other_scratch_host_addr = reinterpret_cast<uint64_t>(other_info.scratchData.hostAddress);
-            const vvl::range<uint64_t> other_scratch_addr_range(other_scratch_host_addr,
-                                                                other_scratch_host_addr + other_scratch_size);
-
-            if (scratch_addr_range.intersects(other_scratch_addr_range)) {
-                std::string info_i_scratch_str = info_loc.dot(Field::scratchData).Fields();
-                std::string other_info_j_scratch_str = other_info_j_loc.dot(Field::scratchData).Fields();
-                skip |= LogError(
-                    "VUID-vkBuildAccelerationStructuresKHR-scratchData-03704", device, info_loc.dot(Field::scratchData),
-                    "overlaps with %s on host address range %s.\n"
-                    "%s.hostAddress is %p and assumed scratch size is %" PRIu64
-                    ".\n"
-                    "%s.hostAddress is %p and assumed scratch size is %" PRIu64 ".",
-                    other_info_j_scratch_str.c_str(), string_range_hex(scratch_addr_range & other_scratch_addr_range).c_str(),
-                    info_i_scratch_str.c_str(), info.scratchData.hostAddress, scratch_i_size, other_info_j_scratch_str.c_str(),
-                    other_info.scratchData.hostAddress, other_scratch_size);
-            }
-        }
+        scratch_addr_ranges[info_i] = vvl::range<uint64_t>(scratch_i_host_addr, scratch_i_host_addr + scratch_i_size);
 
         if (src_as_state && src_as_state->UsesCreateInfo2()) {
             if (info.mode == VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR) {
@@ -1372,6 +1362,27 @@ bool CoreChecks::PreCallValidateBuildAccelerationStructuresKHR(
             }
         }
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(LogObjectList(), infoCount, pInfos, error_obj);
+
+    const auto scratch_overlaps = vvl::GetIntersectingRangePairs(scratch_addr_ranges, [](uint32_t, uint32_t) { return true; });
+    for (const auto& [info_i, other_info_j] : scratch_overlaps) {
+        const vvl::range<uint64_t>& scratch_addr_range = scratch_addr_ranges[info_i];
+        const vvl::range<uint64_t>& other_scratch_addr_range = scratch_addr_ranges[other_info_j];
+        const Location info_scratch_loc = error_obj.location.dot(Field::pInfos, info_i).dot(Field::scratchData);
+        const std::string info_i_scratch_str = info_scratch_loc.Fields();
+        const std::string other_info_j_scratch_str =
+            error_obj.location.dot(Field::pInfos, other_info_j).dot(Field::scratchData).Fields();
+        skip |= LogError("VUID-vkBuildAccelerationStructuresKHR-scratchData-03704", device, info_scratch_loc,
+                         "overlaps with %s on host address range %s.\n"
+                         "%s.hostAddress is %p and assumed scratch size is %" PRIu64
+                         ".\n"
+                         "%s.hostAddress is %p and assumed scratch size is %" PRIu64 ".",
+                         other_info_j_scratch_str.c_str(), string_range_hex(scratch_addr_range & other_scratch_addr_range).c_str(),
+                         info_i_scratch_str.c_str(), pInfos[info_i].scratchData.hostAddress, scratch_addr_range.distance(),
+                         other_info_j_scratch_str.c_str(), pInfos[other_info_j].scratchData.hostAddress,
+                         other_scratch_addr_range.distance());
+    }
     return skip;
 }
 
@@ -1423,11 +1434,11 @@ bool CoreChecks::PreCallValidateCmdBuildAccelerationStructuresIndirectKHR(VkComm
             skip |= ValidateAccelerationStructureBuildDst(*dst_as_state, info, info_loc, error_obj.handle);
         }
 
-        skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, info_i, error_obj);
-
         skip |= ValidateAccelerationStructureBuildGeometryInfoDevice(commandBuffer, info_i, info, nullptr, info_loc);
         skip |= ValidateAccelerationStructureBuildScratch(commandBuffer, info, nullptr, info_loc);
     }
+
+    skip |= ValidateAccelerationStructuresMemoryAlisasing(commandBuffer, infoCount, pInfos, error_obj);
     return skip;
 }
 
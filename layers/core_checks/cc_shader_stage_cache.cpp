@@ -0,0 +1,114 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core_checks/cc_shader_stage_cache.h"
+
+#include "profiling/memory_report.h"
+#include "profiling/profiling.h"
+#include "state_tracker/shader_module.h"
+#include "utils/hash_util.h"
+
+namespace core {
+
+SpecializedShaderCache::Key::Key(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
+                                 const VkSpecializationInfo *specialization_info)
+    : module_hash(hash_util::Hash64(module_state.words_.data(), module_state.words_.size() * sizeof(uint32_t))),
+      module_word_count(module_state.words_.size()),
+      entry_point_name(entrypoint.name),
+      stage(entrypoint.stage) {
+    if (specialization_info && specialization_info->mapEntryCount > 0 && specialization_info->pMapEntries) {
+        map_entries.assign(specialization_info->pMapEntries, specialization_info->pMapEntries + specialization_info->mapEntryCount);
+        if (specialization_info->pData) {
+            const auto *bytes = static_cast<const uint8_t *>(specialization_info->pData);
+            data.assign(bytes, bytes + specialization_info->dataSize);
+        }
+    }
+
+    hash_util::HashCombiner hc(module_hash);
+    hc << module_word_count << entry_point_name << stage;
+    for (const VkSpecializationMapEntry &map_entry : map_entries) {
+        hc << map_entry.constantID << map_entry.offset << map_entry.size;
+    }
+    if (!data.empty()) {
+        hc << hash_util::Hash64(data.data(), data.size());
+    }
+    hash = hc.Value();
+}
+
+bool SpecializedShaderCache::Key::operator==(const Key &other) const {
+    if (hash != other.hash || module_hash != other.module_hash || module_word_count != other.module_word_count ||
+        stage != other.stage || entry_point_name != other.entry_point_name || data != other.data ||
+        map_entries.size() != other.map_entries.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < map_entries.size(); ++i) {
+        if (map_entries[i].constantID != other.map_entries[i].constantID || map_entries[i].offset != other.map_entries[i].offset ||
+            map_entries[i].size != other.map_entries[i].size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SpecializedShaderCache::Find(const Key &key, Entry &entry) {
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            entry = it->second;
+            found = true;
+        }
+    }
+    // VVL_TracyPlot compiles to nothing without Tracy, the counters must be updated outside of it
+    if (found) {
+        [[maybe_unused]] const uint64_t hit_count = hit_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+        VVL_TracyPlot("Specialized shader cache hits", hit_count);
+    } else {
+        [[maybe_unused]] const uint64_t miss_count = miss_count_.fetch_add(1, std::memory_order_relaxed) + 1;
+        VVL_TracyPlot("Specialized shader cache misses", miss_count);
+    }
+    return found;
+}
+
+void SpecializedShaderCache::Add(const Key &key, const Entry &entry) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (entries_.size() >= kMaxEntries) {
+        entries_.clear();
+    }
+    entries_.emplace(key, entry);
+    VVL_TracyPlot("Specialized shader cache entries", entries_.size());
+}
+
+size_t SpecializedShaderCache::EntryCount() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return entries_.size();
+}
+
+size_t SpecializedShaderCache::HeapMemoryUsage() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    size_t bytes = vvl::MemoryReport::MapBytes(entries_);
+    for (const auto &[key, entry] : entries_) {
+        bytes += vvl::MemoryReport::StringBytes(key.entry_point_name) + vvl::MemoryReport::VectorBytes(key.map_entries) +
+                 vvl::MemoryReport::VectorBytes(key.data);
+        // The entry point is one of the module, the module is in the control block of its shared_ptr
+        bytes += sizeof(spirv::Module) + 2 * sizeof(void *) + entry.module_state->HeapMemoryUsage();
+    }
+    return bytes;
+}
+
+}  // namespace core
@@ -0,0 +1,91 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vulkan/vulkan.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace spirv {
+struct Module;
+struct EntryPoint;
+}  // namespace spirv
+
+namespace core {
+
+// Applying the specialization constants of a shader stage (spirv-opt to freeze them, spirv-val on the result and parsing it into a
+// new spirv::Module) costs more than all the other checks of ValidateShaderStage. Apps creating thousands of pipelines usually
+// reuse a few modules with the same specialization, so the specialized module is cached per device and shared by all the
+// pipelines and shader objects.
+//
+// The key is the content of the module, not its handle, as the same SPIR-V is often passed inline or in several modules.
+// Only stages specialized without errors are added, a stage with errors must be reported every time it is used.
+class SpecializedShaderCache {
+  public:
+    struct Key {
+        uint64_t module_hash = 0;
+        size_t module_word_count = 0;
+        std::string entry_point_name;
+        VkShaderStageFlagBits stage = VK_SHADER_STAGE_FLAG_BITS_MAX_ENUM;
+        std::vector<VkSpecializationMapEntry> map_entries;
+        std::vector<uint8_t> data;
+        size_t hash = 0;
+
+        Key(const spirv::Module &module_state, const spirv::EntryPoint &entrypoint,
+            const VkSpecializationInfo *specialization_info);
+        bool operator==(const Key &other) const;
+    };
+
+    struct Entry {
+        std::shared_ptr<const spirv::Module> module_state;
+        std::shared_ptr<const spirv::EntryPoint> entrypoint;
+    };
+
+    // Returns false and counts a miss if the stage has not been specialized yet
+    bool Find(const Key &key, Entry &entry);
+    void Add(const Key &key, const Entry &entry);
+
+    // Reported when the device is destroyed
+    uint64_t HitCount() const { return hit_count_.load(std::memory_order_relaxed); }
+    uint64_t MissCount() const { return miss_count_.load(std::memory_order_relaxed); }
+
+    // The specialized modules are only referenced by the cache and the validation of the stage using them
+    size_t EntryCount() const;
+    size_t HeapMemoryUsage() const;
+
+  private:
+    // Past this the cache is emptied, the apps we care about have much fewer distinct stages than this
+    static constexpr size_t kMaxEntries = 4096;
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const { return key.hash; }
+    };
+
+    mutable std::mutex lock_;
+    vvl::unordered_map<Key, Entry, KeyHash> entries_;
+    std::atomic<uint64_t> hit_count_{0};
+    std::atomic<uint64_t> miss_count_{0};
+};
+
+}  // namespace core
@@ -22,6 +22,7 @@
 #include <cinttypes>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <spirv/unified1/spirv.hpp>
 #include <sstream>
 #include <string>
@@ -1155,7 +1156,24 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState& stage_state, const
 
     // If specialization-constant instructions are present in the shader, the specializations should be applied.
     // If spirv_const_fold is turned off, the default spec constants values are used
+    //
+    // The specialized module only depends on the SPIR-V, the entry point and the specialization info, so it is looked up first in
+    // the stages already specialized by other pipelines and shader objects
+    std::optional<core::SpecializedShaderCache::Key> specialization_key;
     if (module_state_ptr->static_data_.has_specialization_constants && global_settings.spirv_const_fold) {
+        specialization_key.emplace(*module_state_ptr, *entrypoint_ptr, stage_state.GetSpecializationInfo());
+        core::SpecializedShaderCache::Entry cached;
+        if (specialized_shader_cache.Find(*specialization_key, cached)) {
+            module_state_ptr = std::move(cached.module_state);
+            entrypoint_ptr = std::move(cached.entrypoint);
+            specialization_key.reset();
+            if (skip) {
+                return skip;
+            }
+        }
+    }
+
+    if (specialization_key) {
         // setup the call back if the optimizer fails
         spvtools::Optimizer optimizer(spirv_environment);
         spvtools::MessageConsumer consumer = [&skip, &module_state_ptr, &stage, loc, this](
@@ -1393,6 +1411,7 @@ bool CoreChecks::ValidateShaderStage(const ShaderStageState& stage_state, const
         if (skip) {
             return skip;  // if spec constants have errors, can produce false positives later
         }
+        specialized_shader_cache.Add(*specialization_key, {module_state_ptr, entrypoint_ptr});
     }
 
     const spirv::Module& module_state = *module_state_ptr;
@@ -25,6 +25,7 @@
 #include "containers/container_utils.h"
 #include "error_message/error_strings.h"
 #include "generated/error_location_helper.h"
+#include "profiling/memory_report.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/descriptor_sets.h"
 #include "state_tracker/image_state.h"
@@ -48,7 +49,14 @@ void CoreChecks::Created(vvl::Queue& queue) {
 namespace core {
 
 CommandBufferSubState::CommandBufferSubState(vvl::CommandBuffer& cb, CoreChecks& validator)
-    : vvl::CommandBufferSubState(cb), validator(validator) {
+    : vvl::CommandBufferSubState(cb),
+      validator(validator),
+      fragment_density_offsets(vvl::ArenaAllocator<VkOffset2D>(cb.arena)),
+      wait_event_submit_infos(vvl::ArenaAllocator<WaitEventSubmitInfo>(cb.arena)),
+      wait_event2_submit_infos(vvl::ArenaAllocator<WaitEvent2SubmitInfo>(cb.arena)),
+      queue_submit_functions(vvl::ArenaAllocator<QueueCallback>(cb.arena)),
+      cmd_execute_commands_functions(vvl::ArenaAllocator<ExecuteCommandsCallback>(cb.arena)),
+      query_updates(vvl::ArenaAllocator<QueryUpdateCallback>(cb.arena)) {
     ResetCBState();
 }
 
@@ -265,18 +273,17 @@ void CommandBufferSubState::RecordBeginRenderPass(const VkRenderPassBeginInfo& r
 void CommandBufferSubState::RecordEndRendering(const VkRenderingEndInfoEXT* pRenderingEndInfo) {
     // Only track the first call to vkCmdEndRendering2EXT for pFragmentDensityOffsets, because they must match due to VU 10730
     if (fragment_density_offsets.empty()) {
-        std::vector<VkOffset2D> new_offsets = {{0, 0}};
-        if (pRenderingEndInfo) {
-            const auto* fdm_offset_end_info =
-                vku::FindStructInPNextChain<VkRenderPassFragmentDensityMapOffsetEndInfoEXT>(pRenderingEndInfo->pNext);
-            if (fdm_offset_end_info) {
-                new_offsets.resize(fdm_offset_end_info->fragmentDensityOffsetCount);
-                for (uint32_t i = 0; i < fdm_offset_end_info->fragmentDensityOffsetCount; ++i) {
-                    new_offsets[i] = fdm_offset_end_info->pFragmentDensityOffsets[i];
-                }
-            }
+        const auto* fdm_offset_end_info =
+            pRenderingEndInfo
+                ? vku::FindStructInPNextChain<VkRenderPassFragmentDensityMapOffsetEndInfoEXT>(pRenderingEndInfo->pNext)
+                : nullptr;
+        if (fdm_offset_end_info) {
+            fragment_density_offsets.assign(
+                fdm_offset_end_info->pFragmentDensityOffsets,
+                fdm_offset_end_info->pFragmentDensityOffsets + fdm_offset_end_info->fragmentDensityOffsetCount);
+        } else {
+            fragment_density_offsets.push_back({0, 0});
         }
-        fragment_density_offsets = new_offsets;
     }
 }
 
@@ -1182,6 +1189,22 @@ void CommandBufferSubState::Reset(const Location& loc) { ResetCBState(); }
 
 void CommandBufferSubState::Destroy() { ResetCBState(); }
 
+size_t CommandBufferSubState::HeapMemoryUsage() const {
+    using vvl::MemoryReport;
+    size_t bytes = MemoryReport::MapBytes(qfo_transfer_buffer_barriers.release) +
+                   MemoryReport::MapBytes(qfo_transfer_buffer_barriers.acquire) +
+                   MemoryReport::MapBytes(qfo_transfer_image_barriers.release) +
+                   MemoryReport::MapBytes(qfo_transfer_image_barriers.acquire);
+    bytes += MemoryReport::MapBytes(event_signal_states) + MemoryReport::MapBytes(event_wait_barriers) +
+             MemoryReport::MapBytes(first_event_wait_commands);
+    // The vectors in the arena of the command buffer are counted with it, the captures of the callbacks are not counted
+    for (const WaitEventSubmitInfo& wait_info : wait_event_submit_infos) {
+        bytes += MemoryReport::VectorBytes(wait_info.wait_events) + MemoryReport::MapBytes(wait_info.signal_states);
+    }
+    bytes += MemoryReport::VectorBytes(custom_resolve.color_formats) + MemoryReport::VectorBytes(viewport.inherited_depths);
+    return bytes;
+}
+
 void CommandBufferSubState::ResetCBState() {
     // QFO Tranfser
     qfo_transfer_image_barriers.Reset();
@@ -1201,16 +1224,18 @@ void CommandBufferSubState::ResetCBState() {
 
     custom_primitive_restart_index = 0;
 
+    vvl::ReleaseArenaVector(fragment_density_offsets);
+
     event_signal_states.clear();
     event_wait_barriers.clear();
     first_event_wait_commands.clear();
 
     // Submit time validation
-    queue_submit_functions.clear();
-    wait_event_submit_infos.clear();
-    wait_event2_submit_infos.clear();
-    cmd_execute_commands_functions.clear();
-    query_updates.clear();
+    vvl::ReleaseArenaVector(queue_submit_functions);
+    vvl::ReleaseArenaVector(wait_event_submit_infos);
+    vvl::ReleaseArenaVector(wait_event2_submit_infos);
+    vvl::ReleaseArenaVector(cmd_execute_commands_functions);
+    vvl::ReleaseArenaVector(query_updates);
 
     // Inherited Viewport/Scissor
     used_viewport_scissor_count = 0;
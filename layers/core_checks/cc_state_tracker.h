@@ -133,6 +133,8 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
 
     void Reset(const Location &loc) final;
     void Destroy() final;
+    // For the memory_report_frames setting
+    size_t HeapMemoryUsage() const;
 
     void RecordExecuteCommand(vvl::CommandBuffer &secondary_command_buffer, uint32_t cmd_index, const Location &loc) final;
 
@@ -196,29 +198,33 @@ class CommandBufferSubState : public vvl::CommandBufferSubState {
         return qfo_transfer_buffer_barriers;
     }
 
+    // The containers filled while recording are in the arena of the command buffer, ResetCBState() releases them before it is
+    // reset. custom_resolve and viewport only get a few entries when inheriting and stay on the heap.
+
     // used for VK_EXT_fragment_density_map_offset
     // currently need to hold in Command buffer because it can be a suspended renderpass
-    std::vector<VkOffset2D> fragment_density_offsets;
+    vvl::ArenaVector<VkOffset2D> fragment_density_offsets;
 
     // Event state tracking
     EventSignalStateMap event_signal_states;
     EventWaitBarrierMap event_wait_barriers;
     EventWaitCommandMap first_event_wait_commands;
-    std::vector<WaitEventSubmitInfo> wait_event_submit_infos;
-    std::vector<WaitEvent2SubmitInfo> wait_event2_submit_infos;
+    vvl::ArenaVector<WaitEventSubmitInfo> wait_event_submit_infos;
+    vvl::ArenaVector<WaitEvent2SubmitInfo> wait_event2_submit_infos;
 
     // Validation functions run at primary CB queue submit time
     using QueueCallback = std::function<bool(const class vvl::Queue &queue_state, const vvl::CommandBuffer &cb_state)>;
-    std::vector<QueueCallback> queue_submit_functions;
+    vvl::ArenaVector<QueueCallback> queue_submit_functions;
 
     // Validation functions run when secondary CB is executed in primary
-    std::vector<
-        std::function<bool(const vvl::CommandBuffer &secondary, const vvl::CommandBuffer *primary, const vvl::Framebuffer *)>>
-        cmd_execute_commands_functions;
-
-    std::vector<std::function<bool(vvl::CommandBuffer &cb_state, bool do_validate, VkQueryPool &first_perf_query_pool,
-                                   uint32_t perf_query_pass, QueryMap *local_query_to_state_map)>>
-        query_updates;
+    using ExecuteCommandsCallback =
+        std::function<bool(const vvl::CommandBuffer &secondary, const vvl::CommandBuffer *primary, const vvl::Framebuffer *)>;
+    vvl::ArenaVector<ExecuteCommandsCallback> cmd_execute_commands_functions;
+
+    using QueryUpdateCallback =
+        std::function<bool(vvl::CommandBuffer &cb_state, bool do_validate, VkQueryPool &first_perf_query_pool,
+                           uint32_t perf_query_pass, QueryMap *local_query_to_state_map)>;
+    vvl::ArenaVector<QueryUpdateCallback> query_updates;
 
   private:
     void ResetCBState();
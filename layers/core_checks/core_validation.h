@@ -37,12 +37,15 @@
 #include "state_tracker/subresource_adapter.h"
 
 #include "containers/custom_containers.h"
+#include "core_checks/cc_check_throttle.h"
+#include "core_checks/cc_shader_stage_cache.h"
 
 #include "generated/dynamic_state_helper.h"
 #include "stateless/sl_spirv.h"
 #include <spirv-tools/libspirv.hpp>
 
 #include "utils/sync_utils.h"
+#include "utils/thread_pool.h"
 
 namespace vvl {
 class DescriptorBinding;
@@ -239,10 +242,24 @@ class CoreChecks : public vvl::DeviceProxy {
     // Tracks submission batches for submit time validation
     vvl::SubmitTimeTracker submit_time_tracker;
 
+    // Specialized modules shared by all the pipelines and shader objects, see ValidateShaderStage
+    mutable core::SpecializedShaderCache specialized_shader_cache;
+
+    // Times the image layout and descriptor set checks, and skips them when they go over check_throttle_budget_ns
+    mutable core::CheckThrottle check_throttle;
+
+    // Only created when parallel_pipeline_validation is enabled, see ValidatePipelineCreateInfos
+    std::unique_ptr<vvl::ThreadPool> pipeline_validation_pool;
+
     CoreChecks(vvl::DispatchDevice* dev, core::Instance* instance_vo)
         : vvl::DeviceProxy(dev, instance_vo, LayerObjectTypeCoreValidation),
           stateless_spirv_validator(dev->debug_report, dev->stateless_device_data, dev->settings.disabled[shader_validation]),
-          submit_time_tracker(*this) {}
+          submit_time_tracker(*this),
+          check_throttle(global_settings.check_throttle_budget_ns, global_settings.check_throttle_passes) {
+        if (global_settings.parallel_pipeline_validation) {
+            pipeline_validation_pool = std::make_unique<vvl::ThreadPool>();
+        }
+    }
 
     ReadLockGuard ReadLock() const override;
     WriteLockGuard WriteLock() override;
@@ -253,6 +270,7 @@ class CoreChecks : public vvl::DeviceProxy {
     bool ValidateSetMemBinding(const vvl::DeviceMemory& memory_state, const vvl::Bindable& mem_binding, const Location& loc) const;
     bool ValidateDeviceQueueFamily(uint32_t queue_family, const Location& loc, const char* vuid, bool optional) const;
     bool ValidateIdleDescriptorSet(VkDescriptorSet set, const Location& loc) const;
+    bool ValidatePipelineCreateInfos(uint32_t count, const std::function<bool(uint32_t)>& validate_create_info) const;
     bool ValidateGraphicsPipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
     bool ValidateComputePipelineDerivatives(PipelineStates& pipeline_states, uint32_t pipe_index, const Location& loc) const;
     bool ValidateMultiViewShaders(const vvl::Pipeline& pipeline, const Location& multiview_loc, uint32_t view_mask,
@@ -778,8 +796,10 @@ class CoreChecks : public vvl::DeviceProxy {
     VkResult CoreLayerGetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t* pDataSize,
                                                 void* pData) override;
     // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
+    // |shader_state| is the pipeline or shader object |binding_req_map| belongs to
     bool ValidateDrawState(const vvl::DescriptorSet& descriptor_set, uint32_t set_index, const BindingVariableMap& binding_req_map,
-                           const vvl::CommandBuffer& cb_state, const Location& loc, const LogObjectList& objlist) const;
+                           const vvl::StateObject& shader_state, const vvl::CommandBuffer& cb_state, const Location& loc,
+                           const LogObjectList& objlist) const;
 
     bool VerifyDescriptorSetLayoutIsCompatibile(const vvl::DescriptorSetLayout& reference_dsl,
                                                 const vvl::DescriptorSetLayout& to_bind_dsl, std::string& error_msg) const;
@@ -1567,6 +1587,7 @@ class CoreChecks : public vvl::DeviceProxy {
     bool ValidateDeferredOperation(VkDevice device, VkDeferredOperationKHR deferred_operation, const Location& loc,
                                    const char* vuid) const;
     void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    void ReportMemoryUsage(vvl::MemoryReport& report) override;
     bool PreCallValidateCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset,
                                         VkDeviceSize dataSize, const void* pData, const ErrorObject& error_obj) const override;
     bool PreCallValidateCmdUpdateMemoryKHR(VkCommandBuffer commandBuffer, const VkDeviceAddressRangeKHR* pDstRange,
@@ -1869,7 +1890,7 @@ class CoreChecks : public vvl::DeviceProxy {
                                                const VkAccelerationStructureBuildGeometryInfoKHR& info, const Location& info_loc,
                                                const VulkanTypedHandle& handle) const;
     bool ValidateAccelerationStructuresMemoryAlisasing(const LogObjectList& objlist, uint32_t infoCount,
-                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos, uint32_t info_i,
+                                                       const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
                                                        const ErrorObject& error_obj) const;
     bool ValidateAccelerationStructuresDeviceScratchBufferMemoryAliasing(
         VkCommandBuffer cmd_buffer, uint32_t info_count, const VkAccelerationStructureBuildGeometryInfoKHR* p_infos,
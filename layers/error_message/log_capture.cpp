@@ -0,0 +1,42 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "error_message/log_capture.h"
+
+static thread_local LogCapture *current_log_capture = nullptr;
+
+LogCapture::Scope::Scope(LogCapture &capture) : previous_(current_log_capture) { current_log_capture = &capture; }
+
+LogCapture::Scope::~Scope() { current_log_capture = previous_; }
+
+LogCapture *LogCapture::Current() { return current_log_capture; }
+
+void LogCapture::Record(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
+                        const std::string &main_message) {
+    messages_.emplace_back(Message{msg_flags, std::string(vuid_text), objects, LocationCapture(loc), main_message});
+}
+
+bool LogCapture::Flush(DebugReport &debug_report) {
+    std::vector<Message> messages = std::move(messages_);
+    messages_.clear();
+
+    bool skip = false;
+    for (const Message &message : messages) {
+        skip |= debug_report.LogMessage(message.msg_flags, message.vuid_text, message.objects, message.loc.Get(),
+                                        message.main_message);
+    }
+    return skip;
+}
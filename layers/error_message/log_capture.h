@@ -0,0 +1,71 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "error_message/error_location.h"
+#include "error_message/logging.h"
+
+// While a LogCapture is active on a thread, DebugReport::LogMessage records the messages logged from
+// that thread instead of calling the debug callbacks. Flush() reports them later, in logging order.
+//
+// This is how validation running on worker threads still reports its messages in a deterministic order:
+// each task logs into its own capture and the captures are flushed in task order.
+class LogCapture {
+  public:
+    LogCapture() = default;
+    LogCapture(const LogCapture &) = delete;
+    LogCapture &operator=(const LogCapture &) = delete;
+    LogCapture(LogCapture &&) = default;
+    LogCapture &operator=(LogCapture &&) = default;
+
+    // Makes the capture active on the current thread for the lifetime of the scope
+    class Scope {
+      public:
+        explicit Scope(LogCapture &capture);
+        ~Scope();
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      private:
+        LogCapture *previous_;
+    };
+
+    // Capture active on the current thread, if any
+    static LogCapture *Current();
+
+    void Record(VkFlags msg_flags, std::string_view vuid_text, const LogObjectList &objects, const Location &loc,
+                const std::string &main_message);
+
+    // Reports the recorded messages to debug_report and clears the capture.
+    // Returns true if any of the debug callbacks asked to skip the call.
+    bool Flush(DebugReport &debug_report);
+
+    bool Empty() const { return messages_.empty(); }
+
+  private:
+    struct Message {
+        VkFlags msg_flags;
+        std::string vuid_text;
+        LogObjectList objects;
+        LocationCapture loc;
+        std::string main_message;
+    };
+    std::vector<Message> messages_;
+};
@@ -31,9 +31,11 @@
 #include "generated/vk_object_types.h"
 #include "generated/vk_validation_error_messages.h"
 #include "error_location.h"
+#include "error_message/log_capture.h"
 #include "utils/hash_util.h"
 #include "utils/text_utils.h"
 #include "error_message/log_message_type.h"
+#include "profiling/memory_report.h"
 
 [[maybe_unused]] const char* kVUIDUndefined = "VUID_Undefined";
 
@@ -114,6 +116,12 @@ bool DebugReport::LogMessage(VkFlags msg_flags, std::string_view vuid_text, cons
         return false;
     }
 
+    // The message is reported when the capture is flushed, see LogCapture
+    if (LogCapture* capture = LogCapture::Current()) {
+        capture->Record(msg_flags, vuid_text, objects, loc, main_message);
+        return false;
+    }
+
     // We have a few speical VUID we never actually want to suppress.
     // If a new VUID is added here, make sure to add it in NegativeOther.VuidHashStability test as well.
     const bool skip_checking_limit =
@@ -484,6 +492,23 @@ void DebugReport::SetMarkerObjectName(const VkDebugMarkerObjectNameInfoEXT* pNam
     }
 }
 
+size_t DebugReport::ObjectNameCount() const {
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    return debug_object_name_map.size() + debug_utils_object_name_map.size();
+}
+
+size_t DebugReport::ObjectNameMemoryUsage() const {
+    std::unique_lock<std::mutex> lock(debug_output_mutex);
+    size_t bytes = 0;
+    for (const auto* name_map : {&debug_object_name_map, &debug_utils_object_name_map}) {
+        bytes += name_map->size() * (sizeof(*name_map->begin()) + vvl::MemoryReport::kNodeOverhead);
+        for (const auto& entry : *name_map) {
+            bytes += entry.second.size() + 1;
+        }
+    }
+    return bytes;
+}
+
 // NoLock suffix means that the function itself does not hold debug_output_mutex lock,
 // and it's **mandatory responsibility** of the caller to hold this lock.
 std::string DebugReport::GetUtilsObjectNameNoLock(const uint64_t object) const {
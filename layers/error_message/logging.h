@@ -254,6 +254,10 @@ class DebugReport {
 
     bool HasSeverityLevel(VkDebugUtilsMessageSeverityFlagBitsEXT level) const { return (active_msg_severities & level) != 0; }
 
+    // Number of object names set by the application, and the estimated memory they use
+    size_t ObjectNameCount() const;
+    size_t ObjectNameMemoryUsage() const;
+
   private:
     std::string CreateMessageText(const Location &loc, std::string_view vuid_text, const std::string &main_message,
                                   bool at_message_limit);
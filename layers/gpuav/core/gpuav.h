@@ -21,6 +21,7 @@
 #include "gpuav/descriptor_validation/gpuav_descriptor_set.h"
 #include "gpuav/resources/gpuav_vulkan_objects.h"
 #include "gpuav/instrumentation/gpuav_shader_instrumentor.h"
+#include "gpuav/shaders/gpuav_error_header.h"
 
 #include <memory>
 
@@ -73,7 +74,8 @@ class Validator : public GpuShaderInstrumentor {
     Validator(vvl::DispatchDevice* dev, Instance* instance_vo)
         : GpuShaderInstrumentor(dev, instance_vo, LayerObjectTypeGpuAssisted),
           global_indices_buffer_(*this),
-          gpu_resources_manager_(*this, true) {}
+          gpu_resources_manager_(*this, true),
+          error_buffer_pool_(gpu_resources_manager_, glsl::kErrorBufferByteSize) {}
     ~Validator();
 
     // gpuav_setup.cpp
@@ -93,6 +95,7 @@ class Validator : public GpuShaderInstrumentor {
     // --------------
   public:
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator, const RecordObject& record_obj) final;
+    void ReportMemoryUsage(vvl::MemoryReport& report) final;
     void PreCallRecordCreateBuffer(VkDevice device, const VkBufferCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
                                    VkBuffer* pBuffer, const RecordObject& record_obj, chassis::CreateBuffer& chassis_state) final;
     void PreCallRecordBeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo* pBeginInfo,
@@ -322,6 +325,10 @@ class Validator : public GpuShaderInstrumentor {
 
   public:
     vko::GpuResourcesManager gpu_resources_manager_;
+    // Error output buffers of command buffers, one range per command buffer (see "Error output buffer" in
+    // docs/gpu_av_shader_instrumentation.md). They are returned with an empty error stream, and only their header
+    // has to be written when a command buffer gets one.
+    vko::BufferRangePool error_buffer_pool_;
 };
 
 }  // namespace gpuav
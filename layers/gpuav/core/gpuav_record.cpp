@@ -33,6 +33,8 @@
 #include "gpuav/validation_cmd/gpuav_dispatch.h"
 #include "gpuav/validation_cmd/gpuav_draw.h"
 #include "gpuav/validation_cmd/gpuav_ray_tracing.h"
+#include "profiling/api_timing.h"
+#include "profiling/memory_report.h"
 #include "utils/math_utils.h"
 
 #include <cstdint>
@@ -296,6 +298,7 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
     DestroySubstate();
 
     shared_resources_cache.Clear();
+    error_buffer_pool_.Clear();
     gpu_resources_manager_.DestroyResources();
 
     global_indices_buffer_.Destroy();
@@ -310,6 +313,20 @@ void Validator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCa
     desc_set_manager_.reset();
 }
 
+void Validator::ReportMemoryUsage(vvl::MemoryReport& report) {
+    const char* owner = vvl::String(container_type);
+    report.Add(owner, "BufferCaches", 1, gpu_resources_manager_.BufferCacheByteSize(), vvl::MemoryReport::Device);
+
+    uint64_t cb_count = 0;
+    uint64_t cb_bytes = 0;
+    device_state->ForEachShared<vvl::CommandBuffer>([&cb_count, &cb_bytes](const std::shared_ptr<vvl::CommandBuffer>& cb) {
+        auto guard = cb->ReadLock();
+        cb_bytes += SubState(*cb).gpu_resources_manager.BufferCacheByteSize();
+        cb_count++;
+    });
+    report.Add(owner, "CommandBufferBufferCaches", cb_count, cb_bytes, vvl::MemoryReport::Device);
+}
+
 // Common logic before any draw/dispatch/traceRays
 void Validator::PreCallActionCommand(Validator& gpuav, CommandBufferSubState& cb_state, const LastBound& last_bound,
                                      const Location& loc) {
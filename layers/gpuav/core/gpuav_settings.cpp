@@ -125,6 +125,7 @@ void GpuAVSettings::TracyLogSettings() const {
     VVL_TracyMessageStream("GpuAVSettings:");
     VVL_TRACY_PRINT_GPUAV_SETTING(safe_mode);
     VVL_TRACY_PRINT_GPUAV_SETTING(force_on_robustness);
+    VVL_TRACY_PRINT_GPUAV_SETTING(parallel_shader_instrumentation);
     VVL_TRACY_PRINT_GPUAV_SETTING(select_instrumented_shaders);
     if (!shader_selection_regexes.empty()) {
         VVL_TracyMessageStream("  shader_selection_regexes:");
@@ -148,6 +149,7 @@ void GpuAVSettings::TracyLogSettings() const {
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_dump_instrumented_shaders);
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_max_instrumentations_count);
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_disable_dontinline);
+    VVL_TRACY_PRINT_GPUAV_SETTING(debug_disable_pass_manager);
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_print_instrumentation_info);
 #define VVL_TRACY_PRINT_INSTRUMENTATION_SETTING(setting) \
     VVL_TracyMessageStream("    " #setting ": " << shader_instrumentation.setting);
@@ -166,6 +168,7 @@ void GpuAVSettings::TracyLogSettings() const {
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_printf_to_stdout);
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_printf_verbose);
     VVL_TRACY_PRINT_GPUAV_SETTING(debug_printf_buffer_size);
+    VVL_TRACY_PRINT_GPUAV_SETTING(debug_printf_binary_log_file);
 #undef VVL_TRACY_PRINT_GPUAV_SETTING
 #undef VVL_TRACY_PRINT_INSTRUMENTATION_SETTING
 #endif
@@ -25,6 +25,8 @@ struct GpuAVSettings {
     bool safe_mode = false;
 
     bool force_on_robustness = false;
+    // Instrument the shader stages of a vkCreate*Pipelines call on a pool of worker threads
+    bool parallel_shader_instrumentation = false;
     bool select_instrumented_shaders = false;
     std::vector<std::string> shader_selection_regexes{};
 
@@ -47,6 +49,7 @@ struct GpuAVSettings {
     uint32_t debug_max_instrumentations_count = 0;  // zero is same as "unlimited"
     bool debug_print_instrumentation_info = false;
     bool debug_disable_dontinline = false;
+    bool debug_disable_pass_manager = false;
 
     // We create a buffer of N slots as [0, N-1],
     // but N-1 is used to signal the app everything after is garbage.
@@ -90,6 +93,8 @@ struct GpuAVSettings {
     bool debug_printf_to_stdout = false;
     bool debug_printf_verbose = false;
     uint32_t debug_printf_buffer_size = 1024;
+    // If not empty, raw printf records are written to this file for offline decoding instead of being formatted
+    std::string debug_printf_binary_log_file;
 
     void TracyLogSettings() const;
 };
@@ -24,6 +24,7 @@
 #include "chassis/dispatch_object.h"
 #include "gpuav/core/gpuav.h"
 #include "gpuav/core/gpuav_constants.h"
+#include "gpuav/debug_printf/debug_printf.h"
 #include "gpuav/instrumentation/descriptor_checks_classic.h"
 #include "gpuav/resources/gpuav_state_trackers.h"
 #include "gpuav/shaders/gpuav_error_header.h"
@@ -266,6 +267,7 @@ void Validator::FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const L
     }
 
     DescriptorChecksClassicOnFinishDeviceSetup(*this);
+    debug_printf::OnFinishDeviceSetup(*this, loc);
 
     // Create error logging buffer allocation pool
     {
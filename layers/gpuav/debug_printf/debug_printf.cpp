@@ -23,19 +23,18 @@
 #include "gpuav/resources/gpuav_state_trackers.h"
 #include "gpuav/core/gpuav.h"
 #include "error_message/spirv_logging.h"
+#include "utils/math_utils.h"
 
+#include <spirv/unified1/NonSemanticDebugPrintf.h>
+#include <spirv/unified1/spirv.hpp>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <mutex>
 
 namespace gpuav {
 namespace debug_printf {
 
-enum NumericType {
-    NumericTypeUnknown = 0,
-    NumericTypeFloat = 1,
-    NumericTypeSint = 2,
-    NumericTypeUint = 4,
-};
-
 static NumericType NumericTypeLookup(char specifier) {
     switch (specifier) {
         case 'd':
@@ -63,14 +62,6 @@ static NumericType NumericTypeLookup(char specifier) {
     }
 }
 
-struct Substring {
-    std::string string;
-    bool needs_value = false;  // if value from buffer needed to print arguments
-    NumericType type = NumericTypeUnknown;
-    bool is_64_bit = false;
-    bool is_pointer = false;
-};
-
 static std::vector<Substring> ParseFormatString(const std::string& format_string) {
     const char types[] = {'d', 'i', 'o', 'u', 'x', 'X', 'a', 'A', 'e', 'E', 'f', 'F', 'g', 'G', 'v', 'p', '\0'};
     std::vector<Substring> parsed_strings;
@@ -157,9 +148,79 @@ static std::vector<Substring> ParseFormatString(const std::string& format_string
             begin = pos + 1;
         }
     }
+
+    // snprintf needs the platform specific 64-bit specifier, swap it in now instead of every time a value is printed
+    for (Substring& substring : parsed_strings) {
+        if (!substring.needs_value || !substring.is_64_bit) {
+            continue;
+        }
+        if (substring.type == NumericTypeUint) {
+            std::array<std::string_view, 3> format_strings = {{"%ul", "%lu", "%lx"}};
+            for (const auto& ul_string : format_strings) {
+                size_t ul_pos = substring.string.find(ul_string);
+                if (ul_pos == std::string::npos) continue;
+                if (ul_string != "%lu") {
+                    substring.string.replace(ul_pos + 1, 2, PRIx64);
+                } else {
+                    substring.string.replace(ul_pos + 1, 2, PRIu64);
+                }
+                break;
+            }
+        } else if (substring.type == NumericTypeSint) {
+            size_t ld_pos = substring.string.find("%ld");
+            if (ld_pos != std::string::npos) {
+                substring.string.replace(ld_pos + 1, 2, PRId64);
+            } else {
+                substring.missing_64_bit_specifier = true;
+            }
+        }
+    }
     return parsed_strings;
 }
 
+std::shared_ptr<const FormatTable> BuildFormatTable(const std::vector<uint32_t>& spirv) {
+    const uint32_t kModuleStartingOffset = 5;  // first 5 words of module are the headers
+    uint32_t debug_printf_import_id = 0;
+    vvl::unordered_map<uint32_t, const char*> op_strings;
+    std::vector<uint32_t> format_string_ids;
+
+    uint32_t offset = kModuleStartingOffset;
+    while (offset < spirv.size()) {
+        const uint32_t length = spirv[offset] >> 16;
+        const uint32_t opcode = spirv[offset] & 0x0ffffu;
+        if (length == 0 || offset + length > spirv.size()) {
+            break;  // error should be caught in spirv-val, but don't crash here
+        }
+
+        if (opcode == spv::OpExtInstImport) {
+            if (strcmp(reinterpret_cast<const char*>(&spirv[offset + 2]), "NonSemantic.DebugPrintf") == 0) {
+                debug_printf_import_id = spirv[offset + 1];
+            }
+        } else if (opcode == spv::OpString) {
+            op_strings.emplace(spirv[offset + 1], reinterpret_cast<const char*>(&spirv[offset + 2]));
+        } else if (opcode == spv::OpExtInst && length >= 6 && debug_printf_import_id != 0 &&
+                   spirv[offset + 3] == debug_printf_import_id && spirv[offset + 4] == NonSemanticDebugPrintfDebugPrintf) {
+            format_string_ids.push_back(spirv[offset + 5]);
+        }
+        offset += length;
+    }
+
+    if (format_string_ids.empty()) {
+        return nullptr;
+    }
+
+    auto table = std::make_shared<FormatTable>();
+    for (const uint32_t string_id : format_string_ids) {
+        if (table->find(string_id) != table->end()) {
+            continue;
+        }
+        if (const char* const* op_string = vvl::Find(op_strings, string_id)) {
+            table->emplace(string_id, ParseFormatString(*op_string));
+        }
+    }
+    return table;
+}
+
 // GCC and clang don't like using variables as format strings in sprintf.
 // #pragma GCC is recognized by both compilers
 #if defined(__GNUC__) || defined(__clang__)
@@ -206,82 +267,180 @@ struct CbState {
     std::vector<debug_printf::BufferInfo> buffer_infos;
 };
 
-void AnalyzeAndGenerateMessage(Validator& gpuav, VkCommandBuffer command_buffer, debug_printf::BufferInfo& buffer_info,
-                               const uint32_t* debug_output_buffer, const Location& loc) {
-    uint32_t output_buffer_dwords_counts = debug_output_buffer[gpuav::kDebugPrintf_OutputBuffer_DWordsCount];
-    if (!output_buffer_dwords_counts) {
+// snprintf |format| with |args| at the end of |out|
+template <typename... Args>
+static void AppendFormatted(std::string& out, const char* format, Args... args) {
+    const int needed = std::snprintf(nullptr, 0, format, args...);
+    if (needed <= 0) {
         return;
     }
+    const size_t old_size = out.size();
+    out.resize(old_size + needed + 1);  // +1 for null terminator
+    std::snprintf(&out[old_size], needed + 1, format, args...);
+    out.resize(old_size + needed);
+}
+
+// For format strings that are not in the format table of the shader (the internal only ones injected while instrumenting)
+static std::string GetFormatString(const Validator& gpuav, const InstrumentedShader& instrumented_shader, uint32_t shader_id,
+                                   uint32_t format_string_id) {
+    if (const char* op_string = ::spirv::GetOpString(instrumented_shader.original_spirv, format_string_id)) {
+        return op_string;
+    }
+    // We have plumbed the OpString from the instrumented shader
+    std::lock_guard<std::mutex> guard(gpuav.internal_only_debug_printf_lock_);
+    for (const auto& debug_instrumented_info : gpuav.internal_only_debug_printf_) {
+        if ((debug_instrumented_info.unique_shader_id == shader_id) &&
+            (format_string_id == debug_instrumented_info.op_string_id)) {
+            return debug_instrumented_info.op_string_text;
+        }
+    }
+    return {};
+}
+
+// Length in dwords of the OutputRecords written to the buffer, the list is terminated by a zero size
+static uint32_t GetRecordsDwordCount(const uint32_t* debug_output_buffer, uint32_t buffer_dwords) {
+    uint32_t output_record_i = gpuav::kDebugPrintf_OutputBuffer_Data;
+    while (output_record_i < buffer_dwords && debug_output_buffer[output_record_i] &&
+           output_record_i + debug_output_buffer[output_record_i] <= buffer_dwords) {
+        output_record_i += debug_output_buffer[output_record_i];
+    }
+    return output_record_i - gpuav::kDebugPrintf_OutputBuffer_Data;
+}
+
+// Writes the printf records as they are in the output buffer, so reading them back is a copy instead of formatting each message.
+// Every format string is written once, before the first records using it.
+//
+// File layout, all integers are host endian uint32_t:
+//   kBinaryLogMagic, kBinaryLogVersion
+//   then any number of chunks:
+//     kChunkFormatString, shader_id, format_string_id, byte length, string bytes padded to a multiple of 4 bytes
+//     kChunkRecords, dword count, OutputRecords (same layout as in the output buffer)
+//
+// scripts/decode_printf_log.py turns the file into the text the layer would have printed
+class BinaryLog {
+  public:
+    static constexpr uint32_t kBinaryLogMagic = 0x504C5656;  // "VVLP"
+    static constexpr uint32_t kBinaryLogVersion = 1;
+    static constexpr uint32_t kChunkFormatString = 1;
+    static constexpr uint32_t kChunkRecords = 2;
+
+    explicit BinaryLog(FILE* file) : file_(file) {
+        const uint32_t header[2] = {kBinaryLogMagic, kBinaryLogVersion};
+        fwrite(header, sizeof(header), 1, file_);
+    }
+    ~BinaryLog() { fclose(file_); }
+    BinaryLog(const BinaryLog&) = delete;
+    BinaryLog& operator=(const BinaryLog&) = delete;
+
+    void Write(Validator& gpuav, const uint32_t* records, uint32_t dword_count) {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (uint32_t record_i = 0; record_i < dword_count; record_i += records[record_i]) {
+            const OutputRecord* debug_record = reinterpret_cast<const OutputRecord*>(&records[record_i]);
+            const uint64_t string_key = (uint64_t(debug_record->shader_id) << 32) | debug_record->format_string_id;
+            if (written_strings_.insert(string_key).second) {
+                WriteFormatString(gpuav, debug_record->shader_id, debug_record->format_string_id);
+            }
+        }
+        const uint32_t chunk_header[2] = {kChunkRecords, dword_count};
+        fwrite(chunk_header, sizeof(chunk_header), 1, file_);
+        fwrite(records, sizeof(uint32_t), dword_count, file_);
+        // The next submission might be the one that crashes the device, don't lose what was printed so far
+        fflush(file_);
+    }
+
+  private:
+    void WriteFormatString(Validator& gpuav, uint32_t shader_id, uint32_t format_string_id) {
+        std::string format_string;
+        auto it = gpuav.instrumented_shaders_map_.find(shader_id);
+        if (it != gpuav.instrumented_shaders_map_.end()) {
+            format_string = GetFormatString(gpuav, it->second, shader_id, format_string_id);
+        }
+        const uint32_t byte_length = static_cast<uint32_t>(format_string.size());
+        const uint32_t chunk_header[4] = {kChunkFormatString, shader_id, format_string_id, byte_length};
+        fwrite(chunk_header, sizeof(chunk_header), 1, file_);
+        format_string.resize(Align(byte_length, uint32_t(sizeof(uint32_t))), '\0');
+        fwrite(format_string.data(), 1, format_string.size(), file_);
+    }
+
+    std::mutex lock_;
+    FILE* file_;
+    // (shader_id << 32) | format_string_id
+    vvl::unordered_set<uint64_t> written_strings_;
+};
+
+void OnFinishDeviceSetup(Validator& gpuav, const Location& loc) {
+    const std::string& path = gpuav.gpuav_settings.debug_printf_binary_log_file;
+    if (!gpuav.gpuav_settings.debug_printf_enabled || path.empty()) {
+        return;
+    }
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) {
+        std::string message = "Could not open " + path + " to write the DebugPrintf binary log, printing messages instead.";
+        gpuav.InternalWarning(gpuav.device, loc, message.c_str());
+        return;
+    }
+    gpuav.shared_resources_cache.GetOrCreate<BinaryLog>(file);
+}
+
+// Formats and reports each OutputRecord, |output_record_i| is left after the last record.
+// Returns false if the records can't be understood
+static bool LogRecords(Validator& gpuav, VkCommandBuffer command_buffer, debug_printf::BufferInfo& buffer_info,
+                       const uint32_t* debug_output_buffer, const Location& loc, uint32_t& output_record_i) {
+    // The records of a buffer nearly always come from the same shader.
+    // Finding the shader copies its InstrumentedShader, only do it when the shader changes.
+    auto shader_it = gpuav.instrumented_shaders_map_.end();
+    const gpuav::InstrumentedShader* instrumented_shader = nullptr;
+    uint32_t instrumented_shader_id = 0;
+    std::string shader_message;
+    std::vector<Substring> parsed_substrings;
 
-    uint32_t output_record_i = gpuav::kDebugPrintf_OutputBuffer_Data;  // get first OutputRecord index
     while (debug_output_buffer[output_record_i]) {
-        std::ostringstream shader_message;
+        shader_message.clear();
 
         const OutputRecord* debug_record = reinterpret_cast<const OutputRecord*>(&debug_output_buffer[output_record_i]);
         // Lookup the VkShaderModule handle and SPIR-V code used to create the shader, using the unique shader ID value returned
         // by the instrumented shader.
-        const gpuav::InstrumentedShader* instrumented_shader = nullptr;
-        auto it = gpuav.instrumented_shaders_map_.find(debug_record->shader_id);
-        if (it != gpuav.instrumented_shaders_map_.end()) {
-            instrumented_shader = &it->second;
+        if (!instrumented_shader || instrumented_shader_id != debug_record->shader_id) {
+            instrumented_shader = nullptr;
+            instrumented_shader_id = debug_record->shader_id;
+            shader_it = gpuav.instrumented_shaders_map_.find(debug_record->shader_id);
+            if (shader_it != gpuav.instrumented_shaders_map_.end()) {
+                instrumented_shader = &shader_it->second;
+            }
         }
 
         // without the instrumented spirv, there is nothing valuable to print out
         if (!instrumented_shader || instrumented_shader->original_spirv.empty()) {
             gpuav.InternalWarning(buffer_info.objlist, loc, "Can't find instructions from any handles in shader_map");
-            return;
+            return false;
         }
 
-        // Search through the shader source for the printf format string for this invocation
-        std::string format_string;
-        const char* op_string = ::spirv::GetOpString(instrumented_shader->original_spirv, debug_record->format_string_id);
-        if (op_string) {
-            format_string = std::string(op_string);
-        } else {
-            // We have plumbed the OpString from the instrumented shader
-            for (auto debug_instrumented_info : gpuav.internal_only_debug_printf_) {
-                if ((debug_instrumented_info.unique_shader_id == debug_record->shader_id) &&
-                    (debug_record->format_string_id == debug_instrumented_info.op_string_id)) {
-                    format_string = debug_instrumented_info.op_string_text;
-                    break;
-                }
-            }
+        // Format strings from the original shader were parsed when instrumenting it
+        const std::vector<Substring>* format_substrings = nullptr;
+        if (instrumented_shader->debug_printf_format_table) {
+            format_substrings = vvl::Find(*instrumented_shader->debug_printf_format_table, debug_record->format_string_id);
+        }
+        if (!format_substrings) {
+            // Break the format string into strings with 1 or 0 value
+            parsed_substrings = ParseFormatString(
+                GetFormatString(gpuav, *instrumented_shader, debug_record->shader_id, debug_record->format_string_id));
+            format_substrings = &parsed_substrings;
         }
 
-        // Break the format string into strings with 1 or 0 value
-        auto format_substrings = ParseFormatString(format_string);
         const void* current_value = static_cast<const void*>(&debug_record->values);
-        // Sprintf each format substring into a temporary string then add that to the message
-        for (size_t substring_i = 0; substring_i < format_substrings.size(); substring_i++) {
-            auto& substring = format_substrings[substring_i];
-            std::string temp_string;
-            size_t needed = 0;
+        // Sprintf each format substring and add it to the message
+        for (size_t substring_i = 0; substring_i < format_substrings->size(); substring_i++) {
+            const Substring& substring = (*format_substrings)[substring_i];
+            const char* format = substring.string.c_str();
+            bool is_64_bit = substring.is_64_bit;
 
             if (substring.needs_value) {
                 if (substring.is_64_bit) {
                     if (substring.type == NumericTypeUint) {
-                        std::array<std::string_view, 3> format_strings = {{"%ul", "%lu", "%lx"}};
-                        for (const auto& ul_string : format_strings) {
-                            size_t ul_pos = substring.string.find(ul_string);
-                            if (ul_pos == std::string::npos) continue;
-                            if (ul_string != "%lu") {
-                                substring.string.replace(ul_pos + 1, 2, PRIx64);
-                            } else {
-                                substring.string.replace(ul_pos + 1, 2, PRIu64);
-                            }
-                            break;
-                        }
-
                         const uint64_t value = *static_cast<const uint64_t*>(current_value);
-                        // +1 for null terminator
-                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                        temp_string.resize(needed);
-                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                        AppendFormatted(shader_message, format, value);
                     } else if (substring.type == NumericTypeSint) {
-                        size_t ld_pos = substring.string.find("%ld");
-                        if (ld_pos != std::string::npos) {
-                            substring.string.replace(ld_pos + 1, 2, PRId64);
-                        } else {
+                        if (substring.missing_64_bit_specifier) {
                             gpuav.InternalWarning(buffer_info.objlist, loc,
                                                   "Trying to DebugPrintf a 64-bit signed int but not using \"%%ld\" to print it.");
                         }
@@ -289,38 +448,25 @@ void AnalyzeAndGenerateMessage(Validator& gpuav, VkCommandBuffer command_buffer,
                         const uint32_t* current_ptr = static_cast<const uint32_t*>(current_value);
                         const uint64_t value_unsigned = glsl::GetUint64(current_ptr);
                         const int64_t value = static_cast<int64_t>(value_unsigned);
-
-                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                        temp_string.resize(needed);
-                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                        AppendFormatted(shader_message, format, value);
                     } else {
                         assert(false);  // non-supported type
                     }
                 } else {
                     if (substring.type == NumericTypeUint) {
-                        // +1 for null terminator
                         const uint32_t value = *static_cast<const uint32_t*>(current_value);
-                        needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                        temp_string.resize(needed);
-                        std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
-
+                        AppendFormatted(shader_message, format, value);
                     } else if (substring.type == NumericTypeSint) {
                         // When dealing with signed int, we need to know which size the int was to print the correct value
                         if (debug_record->signed_8_bitmask & (1 << substring_i)) {
                             const int8_t value = *static_cast<const int8_t*>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                            AppendFormatted(shader_message, format, value);
                         } else if (debug_record->signed_16_bitmask & (1 << substring_i)) {
                             const int16_t value = *static_cast<const int16_t*>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                            AppendFormatted(shader_message, format, value);
                         } else {
                             const int32_t value = *static_cast<const int32_t*>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                            AppendFormatted(shader_message, format, value);
                         }
 
                     } else if (substring.type == NumericTypeFloat) {
@@ -329,31 +475,23 @@ void AnalyzeAndGenerateMessage(Validator& gpuav, VkCommandBuffer command_buffer,
                         // Using the bitmask, we know if the incoming float was 64-bit or not.
                         // This is much simpler than enforcing a %lf which doesn't line up with how the CPU side works
                         if (debug_record->double_bitmask & (1 << substring_i)) {
-                            substring.is_64_bit = true;
+                            is_64_bit = true;
                             const double value = *static_cast<const double*>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                            AppendFormatted(shader_message, format, value);
                         } else {
                             const float value = *static_cast<const float*>(current_value);
-                            needed = std::snprintf(nullptr, 0, substring.string.c_str(), value) + 1;
-                            temp_string.resize(needed);
-                            std::snprintf(&temp_string[0], needed, substring.string.c_str(), value);
+                            AppendFormatted(shader_message, format, value);
                         }
                     }
                 }
 
-                const uint32_t offset = substring.is_64_bit ? 2 : 1;
+                const uint32_t offset = is_64_bit ? 2 : 1;
                 current_value = static_cast<const uint32_t*>(current_value) + offset;
 
             } else {
                 // incase where someone just printing a string with no arguments to it
-                needed = std::snprintf(nullptr, 0, substring.string.c_str()) + 1;
-                temp_string.resize(needed);
-                std::snprintf(&temp_string[0], needed, substring.string.c_str());
+                AppendFormatted(shader_message, format);
             }
-
-            shader_message << temp_string.c_str();
         }
 
         const bool use_stdout = gpuav.gpuav_settings.debug_printf_to_stdout;
@@ -362,21 +500,41 @@ void AnalyzeAndGenerateMessage(Validator& gpuav, VkCommandBuffer command_buffer,
                 gpuav.GenerateDebugInfoMessage(command_buffer, (uint32_t*)debug_record, instrumented_shader,
                                                buffer_info.pipeline_bind_point, buffer_info.action_command_index);
             if (use_stdout) {
-                std::cout << "VVL-DEBUG-PRINTF " << shader_message.str() << '\n' << debug_info_message;
+                std::cout << "VVL-DEBUG-PRINTF " << shader_message << '\n' << debug_info_message;
             } else {
-                gpuav.LogInfo("VVL-DEBUG-PRINTF", buffer_info.objlist, loc, "DebugPrintf:\n%s\n%s", shader_message.str().c_str(),
+                gpuav.LogInfo("VVL-DEBUG-PRINTF", buffer_info.objlist, loc, "DebugPrintf:\n%s\n%s", shader_message.c_str(),
                               debug_info_message.c_str());
             }
 
         } else {
             if (use_stdout) {
-                std::cout << shader_message.str();
+                std::cout << shader_message;
             } else {
-                gpuav.LogInfo("VVL-DEBUG-PRINTF", buffer_info.objlist, loc, "DebugPrintf:\n%s", shader_message.str().c_str());
+                gpuav.LogInfo("VVL-DEBUG-PRINTF", buffer_info.objlist, loc, "DebugPrintf:\n%s", shader_message.c_str());
             }
         }
         output_record_i += debug_record->size;
     }
+    return true;
+}
+
+void AnalyzeAndGenerateMessage(Validator& gpuav, VkCommandBuffer command_buffer, debug_printf::BufferInfo& buffer_info,
+                               const uint32_t* debug_output_buffer, const Location& loc) {
+    uint32_t output_buffer_dwords_counts = debug_output_buffer[gpuav::kDebugPrintf_OutputBuffer_DWordsCount];
+    if (!output_buffer_dwords_counts) {
+        return;
+    }
+
+    uint32_t output_record_i = gpuav::kDebugPrintf_OutputBuffer_Data;  // get first OutputRecord index
+    if (BinaryLog* binary_log = gpuav.shared_resources_cache.TryGet<BinaryLog>()) {
+        const uint32_t buffer_dwords = gpuav.gpuav_settings.debug_printf_buffer_size / sizeof(uint32_t);
+        const uint32_t records_dword_count = GetRecordsDwordCount(debug_output_buffer, buffer_dwords);
+        binary_log->Write(gpuav, &debug_output_buffer[output_record_i], records_dword_count);
+        output_record_i += records_dword_count;
+    } else if (!LogRecords(gpuav, command_buffer, buffer_info, debug_output_buffer, loc, output_record_i)) {
+        return;
+    }
+
     if ((output_record_i - gpuav::kDebugPrintf_OutputBuffer_Data) < output_buffer_dwords_counts) {
         // Originally we had this to log a warning, but if using the default settings, warnings are hidden.
         // We report this information the same we report the "real" debug printf message so we know it is seen
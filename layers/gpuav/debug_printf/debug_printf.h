@@ -1,6 +1,6 @@
-/* Copyright (c) 2020-2025 The Khronos Group Inc.
- * Copyright (c) 2020-2025 Valve Corporation
- * Copyright (c) 2020-2025 LunarG, Inc.
+/* Copyright (c) 2020-2026 The Khronos Group Inc.
+ * Copyright (c) 2020-2026 Valve Corporation
+ * Copyright (c) 2020-2026 LunarG, Inc.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,12 +17,48 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+struct Location;
+
 namespace gpuav {
 class CommandBufferSubState;
 class Validator;
 
 namespace debug_printf {
+
+enum NumericType {
+    NumericTypeUnknown = 0,
+    NumericTypeFloat = 1,
+    NumericTypeSint = 2,
+    NumericTypeUint = 4,
+};
+
+// Piece of a format string that prints at most one value
+struct Substring {
+    std::string string;
+    bool needs_value = false;  // if value from buffer needed to print arguments
+    NumericType type = NumericTypeUnknown;
+    bool is_64_bit = false;
+    bool is_pointer = false;
+    // 64-bit signed int not printed with "%ld", the value is still printed, but not with a 64-bit specifier
+    bool missing_64_bit_specifier = false;
+};
+
+// Parsed format strings of a shader, keyed by OpString id.
+// Built once when the shader is instrumented so reading back printf records doesn't need to search the SPIR-V
+using FormatTable = vvl::unordered_map<uint32_t, std::vector<Substring>>;
+
+// Returns null if the shader has no DebugPrintf instructions
+std::shared_ptr<const FormatTable> BuildFormatTable(const std::vector<uint32_t>& spirv);
+
+void OnFinishDeviceSetup(Validator& gpuav, const Location& loc);
 void RegisterDebugPrintf(Validator& gpuav, CommandBufferSubState& cb_state);
-}  // namespace debug_printf
 
+}  // namespace debug_printf
 }  // namespace gpuav
@@ -18,6 +18,7 @@
 
 #include "gpuav/descriptor_validation/gpuav_descriptor_set.h"
 #include <vulkan/vulkan_core.h>
+#include <algorithm>
 #include <mutex>
 
 #include "generated/gpuav_offline_spirv.h"
@@ -36,11 +37,47 @@ using vvl::DescriptorClass;
 namespace gpuav {
 
 DescriptorSetSubState::DescriptorSetSubState(const vvl::DescriptorSet& set, Validator& state_data)
-    : vvl::DescriptorSetSubState(set), descriptor_encodings_(state_data) {
+    : vvl::DescriptorSetSubState(set) {
+    descriptor_encodings_.emplace_back(state_data);
     BuildBindingLayouts();
+    // Nothing has been encoded yet
+    dirty_host_encodings_.Add(0, encoding_count_);
 }
 
-DescriptorSetSubState::~DescriptorSetSubState() { descriptor_encodings_.Destroy(); }
+DescriptorSetSubState::~DescriptorSetSubState() {
+    for (EncodingsBuffer& encodings : descriptor_encodings_) {
+        encodings.buffer.Destroy();
+    }
+}
+
+void DirtyDescriptorRanges::Add(uint32_t begin, uint32_t end) {
+    if (begin >= end) {
+        return;
+    }
+    if (ranges_.size() >= kMaxRanges) {
+        Range& covering = ranges_.front();
+        for (const Range& range : ranges_) {
+            covering.begin = std::min(covering.begin, range.begin);
+            covering.end = std::max(covering.end, range.end);
+        }
+        ranges_.resize(1);
+    }
+    ranges_.emplace_back(Range{begin, end});
+}
+
+std::vector<DirtyDescriptorRanges::Range> DirtyDescriptorRanges::Take() {
+    std::vector<Range> merged;
+    std::sort(ranges_.begin(), ranges_.end(), [](const Range& a, const Range& b) { return a.begin < b.begin; });
+    for (const Range& range : ranges_) {
+        if (!merged.empty() && range.begin <= merged.back().end) {
+            merged.back().end = std::max(merged.back().end, range.end);
+        } else {
+            merged.emplace_back(range);
+        }
+    }
+    ranges_.clear();
+    return merged;
+}
 
 void DescriptorSetSubState::BuildBindingLayouts() {
     const uint32_t binding_count = (base.GetBindingCount() > 0) ? base.GetLayout()->GetMaxBinding() + 1 : 0;
@@ -56,9 +93,10 @@ void DescriptorSetSubState::BuildBindingLayouts() {
             start += binding->count;
         }
     }
+    encoding_count_ = start;
 }
 
-void DescriptorSetSubState::CreateDescriptorEncodingBuffer() {
+void DescriptorSetSubState::CreateDescriptorEncodingBuffer(EncodingsBuffer& encodings) {
     VkBufferCreateInfo buffer_info = vku::InitStruct<VkBufferCreateInfo>();
     buffer_info.size = base.GetNonInlineDescriptorCount() * sizeof(glsl::DescriptorEncoding);
     buffer_info.usage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
@@ -70,10 +108,12 @@ void DescriptorSetSubState::CreateDescriptorEncodingBuffer() {
     VmaAllocationCreateInfo alloc_info{};
     alloc_info.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
     alloc_info.preferredFlags = VK_MEMORY_PROPERTY_HOST_CACHED_BIT;
-    const VkResult result = descriptor_encodings_.Create(&buffer_info, &alloc_info);
+    const VkResult result = encodings.buffer.Create(&buffer_info, &alloc_info);
     if (result != VK_SUCCESS) {
         return;
     }
+    // A new buffer has to be filled entirely
+    encodings.dirty.Add(0, encoding_count_);
 }
 
 template <typename StateObject>
@@ -176,9 +216,11 @@ static glsl::DescriptorEncoding GetDescriptorEncoding(const vvl::MutableDescript
     return glsl::DescriptorEncoding(desc_class, glsl::kNullDescriptor, vvl::kNoIndex32);
 }
 
+// Encodes the descriptors [first, last) of the binding
 template <typename Binding>
-void GetBindingEncodings(const Binding& binding, glsl::DescriptorEncoding* descriptor_encodings, uint32_t& index) {
-    for (uint32_t di = 0; di < binding.count; di++) {
+void GetBindingEncodings(const Binding& binding, uint32_t first, uint32_t last, glsl::DescriptorEncoding* descriptor_encodings,
+                         uint32_t& index) {
+    for (uint32_t di = first; di < last; di++) {
         if (!binding.updated[di]) {
             descriptor_encodings[index++] = glsl::DescriptorEncoding();
         } else {
@@ -189,42 +231,43 @@ void GetBindingEncodings(const Binding& binding, glsl::DescriptorEncoding* descr
 
 // Inline Uniforms are currently treated as a single descriptor. Writes to any offsets cause the whole range to be valid.
 template <>
-void GetBindingEncodings(const vvl::InlineUniformBinding& binding, glsl::DescriptorEncoding* descriptor_encodings,
-                         uint32_t& index) {
+void GetBindingEncodings(const vvl::InlineUniformBinding& binding, uint32_t first, uint32_t last,
+                         glsl::DescriptorEncoding* descriptor_encodings, uint32_t& index) {
     // While not techincally a "null descriptor" we want to skip it as if it is one
     descriptor_encodings[index++] =
         glsl::DescriptorEncoding(DescriptorClass::InlineUniform, glsl::kNullDescriptor, vvl::kNoIndex32);
 }
 
-static void GetBindingEncodingsHelper(const vvl::DescriptorBinding* binding, glsl::DescriptorEncoding* descriptor_encodings,
-                                      uint32_t& index) {
+static void GetBindingEncodingsHelper(const vvl::DescriptorBinding* binding, uint32_t first, uint32_t last,
+                                      glsl::DescriptorEncoding* descriptor_encodings, uint32_t& index) {
     switch (binding->descriptor_class) {
         case DescriptorClass::InlineUniform:
-            GetBindingEncodings(static_cast<const vvl::InlineUniformBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::InlineUniformBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::GeneralBuffer:
-            GetBindingEncodings(static_cast<const vvl::BufferBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::BufferBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::TexelBuffer:
-            GetBindingEncodings(static_cast<const vvl::TexelBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::TexelBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::Mutable:
-            GetBindingEncodings(static_cast<const vvl::MutableBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::MutableBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::PlainSampler:
-            GetBindingEncodings(static_cast<const vvl::SamplerBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::SamplerBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::ImageSampler:
-            GetBindingEncodings(static_cast<const vvl::ImageSamplerBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::ImageSamplerBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::Image:
-            GetBindingEncodings(static_cast<const vvl::ImageBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::ImageBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::AccelerationStructure:
-            GetBindingEncodings(static_cast<const vvl::AccelerationStructureBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::AccelerationStructureBinding&>(*binding), first, last, descriptor_encodings,
+                                index);
             break;
         case DescriptorClass::Tensor:
-            GetBindingEncodings(static_cast<const vvl::TensorBinding&>(*binding), descriptor_encodings, index);
+            GetBindingEncodings(static_cast<const vvl::TensorBinding&>(*binding), first, last, descriptor_encodings, index);
             break;
         case DescriptorClass::Invalid:
             assert(false);
@@ -245,7 +288,7 @@ static std::tuple<uint32_t, uint32_t, vko::BufferRange> GetWriteDescriptorSetEnc
 
     auto desc_set_encodings_ptr = (glsl::DescriptorEncoding*)desc_set_encodings.offset_mapped_ptr;
     uint32_t index = 0;
-    GetBindingEncodingsHelper(binding, desc_set_encodings_ptr, index);
+    GetBindingEncodingsHelper(binding, 0, binding->count, desc_set_encodings_ptr, index);
 
     return {binding_layouts[write_desc.dstBinding].start, binding->count, desc_set_encodings};
 }
@@ -287,12 +330,15 @@ void DescriptorSetSubState::PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb,
         }
 
         DescriptorEncodingUpdateShader shader_resources;
+        // Push descriptor sets only have one buffer, they are updated in the command buffer
+        EncodingsBuffer& encodings = descriptor_encodings_[current_encodings_];
+        vko::Buffer& descriptor_encodings = encodings.buffer;
         // Create buffer just in time
-        if (descriptor_encodings_.IsDestroyed()) {
-            CreateDescriptorEncodingBuffer();
+        if (descriptor_encodings.IsDestroyed()) {
+            CreateDescriptorEncodingBuffer(encodings);
         }
-        assert(descriptor_encodings_.Address());
-        shader_resources.push_constants.cb_desc_encodings_ptr = descriptor_encodings_.Address();
+        assert(descriptor_encodings.Address());
+        shader_resources.push_constants.cb_desc_encodings_ptr = descriptor_encodings.Address();
         shader_resources.push_constants.staged_desc_encodings_ptr = desc_set_encodings.offset_address;
         shader_resources.push_constants.start_binding = start_binding;
 
@@ -304,7 +350,7 @@ void DescriptorSetSubState::PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb,
             VkBufferMemoryBarrier barrier_write_after_read = vku::InitStructHelper();
             barrier_write_after_read.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
             barrier_write_after_read.dstAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
-            barrier_write_after_read.buffer = descriptor_encodings_.VkHandle();
+            barrier_write_after_read.buffer = descriptor_encodings.VkHandle();
             barrier_write_after_read.offset = 0;
             barrier_write_after_read.size = VK_WHOLE_SIZE;
 
@@ -319,7 +365,7 @@ void DescriptorSetSubState::PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb,
             VkBufferMemoryBarrier barrier_read_after_write = vku::InitStructHelper();
             barrier_read_after_write.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
             barrier_read_after_write.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
-            barrier_read_after_write.buffer = descriptor_encodings_.VkHandle();
+            barrier_read_after_write.buffer = descriptor_encodings.VkHandle();
             barrier_read_after_write.offset = 0;
             barrier_read_after_write.size = VK_WHOLE_SIZE;
 
@@ -330,38 +376,113 @@ void DescriptorSetSubState::PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb,
     }
 }
 
+void DescriptorSetSubState::EncodeDescriptors(uint32_t begin, uint32_t end) {
+    for (const auto& binding : base) {
+        const spirv::BindingLayout& binding_layout = binding_layouts_[binding->binding];
+        const uint32_t first = std::max(begin, binding_layout.start);
+        const uint32_t last = std::min(end, binding_layout.start + binding_layout.count);
+        if (first >= last) {
+            continue;
+        }
+        uint32_t index = first;
+        GetBindingEncodingsHelper(binding.get(), first - binding_layout.start, last - binding_layout.start,
+                                  host_encodings_.data(), index);
+    }
+}
+
 VkDeviceAddress DescriptorSetSubState::GetDescriptorEncodingsAddress(Validator& gpuav) {
     std::lock_guard guard(state_lock_);
-    const uint32_t current_version = current_version_.load();
+    return UpdateDescriptorEncodings(gpuav);
+}
+
+VkDeviceAddress DescriptorSetSubState::PinDescriptorEncodings(Validator& gpuav, uint32_t& out_buffer_index) {
+    std::lock_guard guard(state_lock_);
+    const VkDeviceAddress address = UpdateDescriptorEncodings(gpuav);
+    out_buffer_index = current_encodings_;
+    descriptor_encodings_[current_encodings_].pending_submissions++;
+    return address;
+}
+
+void DescriptorSetSubState::UnpinDescriptorEncodings(uint32_t buffer_index) {
+    std::lock_guard guard(state_lock_);
+    EncodingsBuffer& encodings = descriptor_encodings_[buffer_index];
+    assert(encodings.pending_submissions > 0);
+    if (encodings.pending_submissions > 0) {
+        encodings.pending_submissions--;
+    }
+}
 
+VkDeviceAddress DescriptorSetSubState::UpdateDescriptorEncodings(Validator& gpuav) {
     if (base.GetNonInlineDescriptorCount() == 0) {
         // no descriptors
         return 0;
     }
 
+    EncodingsBuffer* encodings = &descriptor_encodings_[current_encodings_];
     // Create buffer just in time
-    if (descriptor_encodings_.IsDestroyed()) {
-        CreateDescriptorEncodingBuffer();
-    } else if (last_used_version_ == current_version) {
+    if (encodings->buffer.IsDestroyed()) {
+        CreateDescriptorEncodingBuffer(*encodings);
+        if (encodings->buffer.IsDestroyed()) {
+            return 0;
+        }
+    } else if (encodings->dirty.Empty()) {
         // nothing has changed
-        return descriptor_encodings_.Address();
+        return encodings->buffer.Address();
     }
 
-    auto desc_set_encodings_ptr = (glsl::DescriptorEncoding*)descriptor_encodings_.GetMappedPtr();
-
-    uint32_t index = 0;
-    for (const auto& binding : base) {
-        GetBindingEncodingsHelper(binding.get(), desc_set_encodings_ptr, index);
+    if (!dirty_host_encodings_.Empty()) {
+        host_encodings_.resize(encoding_count_);
+        for (const DirtyDescriptorRanges::Range& range : dirty_host_encodings_.Take()) {
+            EncodeDescriptors(range.begin, range.end);
+        }
     }
 
-    // Flush the descriptor encodings before unmapping so that they are visible to the GPU
-    descriptor_encodings_.FlushAllocation();
+    // Writing a buffer a pending submission reads would change the descriptors under it, use one no submission reads
+    if (!base.IsPushDescriptor() && encodings->pending_submissions > 0) {
+        uint32_t free_index = 0;
+        while (free_index < descriptor_encodings_.size() && descriptor_encodings_[free_index].pending_submissions > 0) {
+            free_index++;
+        }
+        if (free_index == descriptor_encodings_.size()) {
+            descriptor_encodings_.emplace_back(gpuav);
+        }
+        EncodingsBuffer& free_encodings = descriptor_encodings_[free_index];
+        if (free_encodings.buffer.IsDestroyed()) {
+            CreateDescriptorEncodingBuffer(free_encodings);
+        }
+        if (!free_encodings.buffer.IsDestroyed()) {
+            current_encodings_ = free_index;
+            encodings = &free_encodings;
+        }
+    }
 
-    last_used_version_ = current_version;
+    vko::Buffer& descriptor_encodings = encodings->buffer;
+    auto desc_set_encodings_ptr = (glsl::DescriptorEncoding*)descriptor_encodings.GetMappedPtr();
+    for (const DirtyDescriptorRanges::Range& range : encodings->dirty.Take()) {
+        std::copy(host_encodings_.begin() + range.begin, host_encodings_.begin() + range.end, desc_set_encodings_ptr + range.begin);
+        // Flush the descriptor encodings so that they are visible to the GPU
+        descriptor_encodings.FlushAllocation(range.begin * sizeof(glsl::DescriptorEncoding),
+                                             (range.end - range.begin) * sizeof(glsl::DescriptorEncoding));
+    }
 
-    return descriptor_encodings_.Address();
+    return descriptor_encodings.Address();
 }
 
-void DescriptorSetSubState::NotifyUpdate() { current_version_++; }
+void DescriptorSetSubState::NotifyUpdate(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
+    const vvl::DescriptorBinding* desc_binding = base.GetBinding(binding);
+    // The encoding of an inline uniform block never changes
+    if (!desc_binding || desc_binding->type == VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK) {
+        return;
+    }
+    // Writes continuing past the end of the binding update the next bindings, which come next in the encodings
+    const uint32_t begin = std::min(binding_layouts_[binding].start + array_element, encoding_count_);
+    const uint32_t end = begin + std::min(descriptor_count, encoding_count_ - begin);
+
+    std::lock_guard guard(state_lock_);
+    dirty_host_encodings_.Add(begin, end);
+    for (EncodingsBuffer& encodings : descriptor_encodings_) {
+        encodings.dirty.Add(begin, end);
+    }
+}
 
 }  // namespace gpuav
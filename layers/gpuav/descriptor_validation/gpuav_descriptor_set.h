@@ -17,10 +17,11 @@
 
 #pragma once
 
-#include <atomic>
+#include <deque>
 #include <mutex>
 #include <vector>
 #include "state_tracker/descriptor_sets.h"
+#include "gpuav/resources/gpuav_shader_resources.h"
 #include "gpuav/resources/gpuav_vulkan_objects.h"
 #include "gpuav/spirv/interface.h"
 #include "containers/limits.h"
@@ -37,30 +38,72 @@ struct DescriptorAccess {
     uint32_t error_logger_i = vvl::kNoIndex32;               // Index of error logger stored in command buffer state
 };
 
+// Ranges [begin, end) of descriptor indices, in the flattened order of the binding layouts, written since they were last encoded
+class DirtyDescriptorRanges {
+  public:
+    struct Range {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    bool Empty() const { return ranges_.empty(); }
+    void Add(uint32_t begin, uint32_t end);
+    // Returns the ranges sorted and merged, and clears them
+    std::vector<Range> Take();
+
+  private:
+    // Past this many the ranges are merged into the one range covering all of them, updating a bit more than needed is
+    // cheaper than a large list
+    static constexpr size_t kMaxRanges = 64;
+    std::vector<Range> ranges_;
+};
+
 class DescriptorSetSubState : public vvl::DescriptorSetSubState {
   public:
     DescriptorSetSubState(const vvl::DescriptorSet &set, Validator &state_data);
     virtual ~DescriptorSetSubState();
 
-    void NotifyUpdate() override;
+    void NotifyUpdate(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) override;
     void PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb, uint32_t write_count,
                                       const VkWriteDescriptorSet* write_descs) override;
+    // Address of the up to date encodings
     VkDeviceAddress GetDescriptorEncodingsAddress(Validator& gpuav);
+    // Same for a submission reading the encodings, the buffer is not written until UnpinDescriptorEncodings(out_buffer_index) is
+    // called once the submission completed
+    VkDeviceAddress PinDescriptorEncodings(Validator& gpuav, uint32_t& out_buffer_index);
+    void UnpinDescriptorEncodings(uint32_t buffer_index);
 
     const std::vector<gpuav::spirv::BindingLayout> &GetBindingLayouts() const { return binding_layouts_; }
 
   private:
     void BuildBindingLayouts();
-    void CreateDescriptorEncodingBuffer();
+    struct EncodingsBuffer {
+        explicit EncodingsBuffer(Validator& gpuav) : buffer(gpuav) {}
+        vko::Buffer buffer;
+        // Written since this buffer was last updated
+        DirtyDescriptorRanges dirty;
+        // Submissions reading this buffer that have not completed yet
+        uint32_t pending_submissions = 0;
+    };
+
+    void CreateDescriptorEncodingBuffer(EncodingsBuffer& encodings);
+    void EncodeDescriptors(uint32_t begin, uint32_t end);
+    // state_lock_ must be held
+    VkDeviceAddress UpdateDescriptorEncodings(Validator& gpuav);
 
     std::vector<gpuav::spirv::BindingLayout> binding_layouts_;
+    // Number of encodings, inline uniform blocks count as one
+    uint32_t encoding_count_{0};
 
-    // Since we will re-bind the same descriptor set many times, keeping a version allows us to know if things have changed and
-    // worth re-saving the new information
-    std::atomic<uint32_t> current_version_{0};
-    // Set when created the last used state
-    uint32_t last_used_version_{0};
-    vko::Buffer descriptor_encodings_;
+    // Since we will re-bind the same descriptor set many times, only the descriptors written since the last use are
+    // re-encoded, first in the host copy and then in the GPU buffer.
+    std::vector<glsl::DescriptorEncoding> host_encodings_;
+    DirtyDescriptorRanges dirty_host_encodings_;
+    // Update after bind sets can be written while submissions read them. A buffer pinned by a pending submission is never
+    // written, the new encodings go to a buffer no submission reads (a new one if they are all pinned), which catches up with
+    // the writes it missed. A deque as the buffers are referenced while new ones are added.
+    std::deque<EncodingsBuffer> descriptor_encodings_;
+    uint32_t current_encodings_{0};
 
     mutable std::mutex state_lock_;
 };
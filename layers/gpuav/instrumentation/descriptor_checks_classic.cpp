@@ -14,6 +14,9 @@
  */
 
 #include <vulkan/vulkan_core.h>
+#include <deque>
+#include <memory>
+#include <vector>
 #include "descriptor_checks_classic.h"
 #include "drawdispatch/drawdispatch_vuids.h"
 #include "gpuav/core/gpuav.h"
@@ -96,6 +99,34 @@ struct DescriptorChecksClassicCbState {
     vko::BufferRange last_bound_desc_sets_ssbo;
 };
 
+// The descriptor encodings buffers read by the pending submissions of a command buffer, they are not written until the
+// submission completes. Submissions of a command buffer complete in order.
+struct DescriptorEncodingsPins {
+    struct Pin {
+        std::shared_ptr<vvl::DescriptorSet> desc_set;
+        uint32_t buffer_index;
+    };
+    // One list per pending submission, oldest first
+    std::deque<std::vector<Pin>> submissions;
+
+    void UnpinOldestSubmission() {
+        if (submissions.empty()) {
+            return;
+        }
+        for (const Pin& pin : submissions.front()) {
+            SubState(*pin.desc_set).UnpinDescriptorEncodings(pin.buffer_index);
+        }
+        submissions.pop_front();
+    }
+
+    // Reset or destroyed command buffer
+    ~DescriptorEncodingsPins() {
+        while (!submissions.empty()) {
+            UnpinOldestSubmission();
+        }
+    }
+};
+
 void DescriptorChecksClassicOnFinishDeviceSetup(Validator& gpuav) {
     if (!gpuav.gpuav_settings.shader_instrumentation.descriptor_checks) {
         gpuav.shared_resources_cache.GetOrCreate<DescriptorIdPool>(gpuav, 0);
@@ -398,6 +429,8 @@ void RegisterDescriptorChecksClassicValidation(Validator& gpuav, CommandBufferSu
     // corresponding descriptor states
     cb.on_pre_cb_submission_functions.emplace_back([](Validator& gpuav, CommandBufferSubState& cb, VkCommandBuffer) {
         DescriptorSetBindings& desc_set_bindings = cb.shared_resources_cache.Get<DescriptorSetBindings>();
+        std::vector<DescriptorEncodingsPins::Pin>& pins =
+            cb.shared_resources_cache.GetOrCreate<DescriptorEncodingsPins>().submissions.emplace_back();
         for (DescriptorSetBindings::BindingCommand& desc_binding_cmd : desc_set_bindings.descriptor_set_binding_commands) {
             auto desc_sets_ssbo_ptr =
                 static_cast<glsl::BoundDescriptorSetsSSBO*>(desc_binding_cmd.bound_desc_sets_ssbo.offset_mapped_ptr);
@@ -409,10 +442,20 @@ void RegisterDescriptorChecksClassicValidation(Validator& gpuav, CommandBufferSu
                 }
 
                 DescriptorSetSubState& desc_set_state = SubState(*bound_ds);
-                desc_sets_ssbo_ptr->descriptor_encodings[bound_ds_i] = desc_set_state.GetDescriptorEncodingsAddress(gpuav);
+                uint32_t buffer_index = 0;
+                desc_sets_ssbo_ptr->descriptor_encodings[bound_ds_i] = desc_set_state.PinDescriptorEncodings(gpuav, buffer_index);
+                pins.emplace_back(DescriptorEncodingsPins::Pin{bound_ds, buffer_index});
             }
         }
     });
+
+    cb.on_cb_completion_functions.emplace_back(
+        [](Validator&, CommandBufferSubState& cb, const CommandBufferSubState::LabelLogging&, const Location&) {
+            if (DescriptorEncodingsPins* pins = cb.shared_resources_cache.TryGet<DescriptorEncodingsPins>()) {
+                pins->UnpinOldestSubmission();
+            }
+            return true;
+        });
 }
 
 }  // namespace gpuav
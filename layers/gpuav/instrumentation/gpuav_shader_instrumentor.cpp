@@ -21,6 +21,7 @@
 
 #include "containers/container_utils.h"
 #include "error_message/error_location.h"
+#include "error_message/log_capture.h"
 #include "generated/vk_extension_helper.h"
 #include "generated/dispatch_functions.h"
 #include "chassis/chassis_modification_state.h"
@@ -275,6 +276,10 @@ void GpuShaderInstrumentor::FinishDeviceSetup(const VkDeviceCreateInfo* pCreateI
     instrumentation_device_settings_.phys_dev_props = &phys_dev_props;
     instrumentation_device_settings_.phys_dev_ext_props = &phys_dev_ext_props;
     instrumentation_device_settings_.enabled_features = &modified_features;
+
+    if (gpuav_settings.parallel_shader_instrumentation) {
+        instrumentation_pool_ = std::make_unique<vvl::ThreadPool>();
+    }
 }
 
 void GpuShaderInstrumentor::Cleanup() {
@@ -749,8 +754,14 @@ void GpuShaderInstrumentor::PostCallRecordCreateShadersEXT(VkDevice device, uint
             code = shader_object_state->stage.spirv_state->words_;
         }
 
+        std::shared_ptr<const debug_printf::FormatTable> format_table;
+        if (instrumentation_data.status.host.has_debug_printf) {
+            format_table = debug_printf::BuildFormatTable(code);
+        }
+
         instrumented_shaders_map_.insert_or_assign(instrumentation_data.unique_shader_id, VK_NULL_HANDLE, VK_NULL_HANDLE,
-                                                   shader_handle, std::move(code), std::move(instrumentation_data.status.device));
+                                                   shader_handle, std::move(code), std::move(instrumentation_data.status.device),
+                                                   std::move(format_table));
     }
 }
 
@@ -778,6 +789,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    // The stages of all the create infos are instrumented together after the loop
+    ShaderInstrumentationJobs jobs;
     for (uint32_t i = 0; i < count; ++i) {
         const auto& pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -799,12 +812,15 @@ void GpuShaderInstrumentor::PreCallRecordCreateGraphicsPipelines(VkDevice device
         } else {
             success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
                                                                          uint32_t(pipeline_state->stage_states.size()),
-                                                                         create_info_loc, shader_instrumentation_metadata);
+                                                                         create_info_loc, shader_instrumentation_metadata, &jobs);
         }
         if (!success) {
             return;
         }
     }
+    if (!InstrumentShaderJobs(jobs)) {
+        return;
+    }
 
     chassis_state.is_modified = true;
     chassis_state.pCreateInfos = reinterpret_cast<VkGraphicsPipelineCreateInfo*>(chassis_state.modified_create_infos.data());
@@ -822,6 +838,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    // The stages of all the create infos are instrumented together after the loop
+    ShaderInstrumentationJobs jobs;
     for (uint32_t i = 0; i < count; ++i) {
         const auto& pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -837,11 +855,14 @@ void GpuShaderInstrumentor::PreCallRecordCreateComputePipelines(VkDevice device,
         auto& shader_instrumentation_metadata = chassis_state.shader_instrumentations_metadata[i];
 
         bool success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci, 1,
-                                                                          create_info_loc, shader_instrumentation_metadata);
+                                                                          create_info_loc, shader_instrumentation_metadata, &jobs);
         if (!success) {
             return;
         }
     }
+    if (!InstrumentShaderJobs(jobs)) {
+        return;
+    }
 
     chassis_state.is_modified = true;
     chassis_state.pCreateInfos = reinterpret_cast<VkComputePipelineCreateInfo*>(chassis_state.modified_create_infos.data());
@@ -858,6 +879,8 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
     chassis_state.shader_instrumentations_metadata.resize(count);
     chassis_state.modified_create_infos.resize(count);
 
+    // The stages of all the create infos are instrumented together after the loop
+    ShaderInstrumentationJobs jobs;
     for (uint32_t i = 0; i < count; ++i) {
         const auto& pipeline_state = pipeline_states[i];
         const Location create_info_loc = record_obj.location.dot(vvl::Field::pCreateInfos, i);
@@ -880,11 +903,14 @@ void GpuShaderInstrumentor::PreCallRecordCreateRayTracingPipelinesKHR(
         // stages coming from libraries are added last.
         bool success = PreCallRecordPipelineCreationShaderInstrumentation(pAllocator, *pipeline_state, new_pipeline_ci,
                                                                           new_pipeline_ci.stageCount, create_info_loc,
-                                                                          shader_instrumentation_metadata);
+                                                                          shader_instrumentation_metadata, &jobs);
         if (!success) {
             return;
         }
     }
+    if (!InstrumentShaderJobs(jobs)) {
+        return;
+    }
 
     chassis_state.is_modified = true;
     chassis_state.pCreateInfos = reinterpret_cast<VkRayTracingPipelineCreateInfoKHR*>(chassis_state.modified_create_infos.data());
@@ -1377,17 +1403,20 @@ template <typename SafeCreateInfo>
 bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
     const VkAllocationCallbacks* pAllocator, vvl::Pipeline& pipeline_state, SafeCreateInfo& modified_pipeline_ci,
     uint32_t stages_count, const Location& loc,
-    std::vector<chassis::ShaderInstrumentationMetadata>& shader_instrumentation_metadata) {
+    std::vector<chassis::ShaderInstrumentationMetadata>& shader_instrumentation_metadata, ShaderInstrumentationJobs* jobs) {
     // Init here instead of in chassis so we don't pay cost when GPU-AV is not used
     shader_instrumentation_metadata.resize(stages_count);
 
-    spirv::InstrumentationInterface interface(loc);
+    spirv::InstrumentationDescriptorSetLayouts instrumentation_dsl;
     // Can set this once for all shaders in the pipeline
-    BuildDescriptorSetLayoutInfo(pipeline_state, interface.instrumentation_dsl);
+    BuildDescriptorSetLayoutInfo(pipeline_state, instrumentation_dsl);
 
     bool is_pipeline_selected_for_instrumentation =
         IsPipelineSelectedForInstrumentation(modified_pipeline_ci.pNext, VK_NULL_HANDLE, loc);
 
+    ShaderInstrumentationJobs pipeline_jobs;
+    ShaderInstrumentationJobs& queued_jobs = jobs ? *jobs : pipeline_jobs;
+
     PipelineSubState& pipeline_sub_state = SubState(pipeline_state);
     for (uint32_t stage_state_i = 0; stage_state_i < stages_count; ++stage_state_i) {
         const auto& stage_state = pipeline_state.stage_states[stage_state_i];
@@ -1396,7 +1425,6 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
         if (!modified_module_state->spirv) {
             continue;  // Hit when using VK_KHR_pipeline_binary
         }
-        std::unique_lock<std::mutex> module_lock(modified_module_state->module_mutex_);
 
         auto& instrumentation_metadata = shader_instrumentation_metadata[stage_state_i];
 
@@ -1417,9 +1445,11 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
                 continue;
             }
         }
-        std::vector<uint32_t> instrumented_spirv;
         const uint32_t unique_shader_id = unique_shader_module_id_++;
 
+        auto job = std::make_unique<ShaderInstrumentationJob>(loc);
+        spirv::InstrumentationInterface& interface = job->interface;
+        interface.instrumentation_dsl = instrumentation_dsl;
         interface.unique_shader_id = unique_shader_id;
         interface.entry_point_name = stage_state.GetPName();
         interface.entry_point_stage = stage_state.GetStage();
@@ -1435,50 +1465,94 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentation(
         interface.descriptor_mode = pipeline_state.descriptor_heap_mode     ? vvl::DescriptorModeHeap
                                     : pipeline_state.descriptor_buffer_mode ? vvl::DescriptorModeBuffer
                                                                             : vvl::DescriptorModeClassic;
+        job->module_state = modified_module_state;
+        job->out_status = &instrumentation_metadata.status;
+
+        job->apply = [this, pAllocator, &pipeline_state, &modified_pipeline_ci, &pipeline_sub_state, &instrumentation_metadata,
+                      modified_shader_module_ci, stage_state_i, unique_shader_id](ShaderInstrumentationJob& job) {
+            const auto& stage_state = pipeline_state.stage_states[stage_state_i];
+            const vvl::ShaderModule& module_state = *job.module_state;
+            std::vector<uint32_t>& instrumented_spirv = job.instrumented_spirv;
+
+            if (instrumentation_metadata.status.host.is_instrumented) {
+                pipeline_sub_state.status.Append(instrumentation_metadata.status);
+                instrumentation_metadata.unique_shader_id = unique_shader_id;
+                if (module_state.VkHandle() != VK_NULL_HANDLE) {
+                    // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
+                    // shader
+                    VkShaderModuleCreateInfo instrumented_shader_module_ci = vku::InitStructHelper();
+                    instrumented_shader_module_ci.pCode = instrumented_spirv.data();
+                    instrumented_shader_module_ci.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
+                    VkShaderModule instrumented_shader_module = VK_NULL_HANDLE;
+                    VkResult result =
+                        DispatchCreateShaderModule(device, &instrumented_shader_module_ci, pAllocator, &instrumented_shader_module);
+                    if (result == VK_SUCCESS) {
+                        SetShaderModule(modified_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
+                                        stage_state_i);
 
-        InstrumentShader(modified_module_state->spirv->words_, interface, instrumentation_metadata.status, instrumented_spirv);
-
-        if (instrumentation_metadata.status.host.is_instrumented) {
-            pipeline_sub_state.status.Append(instrumentation_metadata.status);
-            instrumentation_metadata.unique_shader_id = unique_shader_id;
-            if (modified_module_state->VkHandle() != VK_NULL_HANDLE) {
-                // If the user used vkCreateShaderModule, we create a new VkShaderModule to replace with the instrumented
-                // shader
-                VkShaderModuleCreateInfo instrumented_shader_module_ci = vku::InitStructHelper();
-                instrumented_shader_module_ci.pCode = instrumented_spirv.data();
-                instrumented_shader_module_ci.codeSize = instrumented_spirv.size() * sizeof(uint32_t);
-                VkShaderModule instrumented_shader_module = VK_NULL_HANDLE;
-                VkResult result =
-                    DispatchCreateShaderModule(device, &instrumented_shader_module_ci, pAllocator, &instrumented_shader_module);
-                if (result == VK_SUCCESS) {
-                    SetShaderModule(modified_pipeline_ci, *stage_state.pipeline_create_info, instrumented_shader_module,
-                                    stage_state_i);
-
-                    pipeline_sub_state.shader_modules.emplace_back(instrumented_shader_module);
+                        pipeline_sub_state.shader_modules.emplace_back(instrumented_shader_module);
+                    } else {
+                        InternalError(device, job.loc, "Unable to replace non-instrumented shader with instrumented one.");
+                        return false;
+                    }
+                } else if (modified_shader_module_ci) {
+                    // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
+                    instrumentation_metadata.passed_in_shader_stage_ci = true;
+                    // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
+                    // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
+                    // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to
+                    // not double-free the memory on us. If making any changes, we have to consider a case where the user inlines
+                    // the fragment shader, but use a normal VkShaderModule in the vertex shader.
+                    modified_shader_module_ci->SetCode(instrumented_spirv);
                 } else {
-                    InternalError(device, loc, "Unable to replace non-instrumented shader with instrumented one.");
+                    assert(false);
                     return false;
                 }
-            } else if (modified_shader_module_ci) {
-                // The user is inlining the Shader Module into the pipeline, so just need to update the spirv
-                instrumentation_metadata.passed_in_shader_stage_ci = true;
-                // TODO - This makes a copy, but could save on Chassis stack instead (then remove function from VUL).
-                // The core issue is we always use std::vector<uint32_t> but Safe Struct manages its own version of the pCode
-                // memory. It would be much harder to change everything from std::vector and instead to adjust Safe Struct to not
-                // double-free the memory on us. If making any changes, we have to consider a case where the user inlines the
-                // fragment shader, but use a normal VkShaderModule in the vertex shader.
-                modified_shader_module_ci->SetCode(instrumented_spirv);
-            } else {
-                assert(false);
-                return false;
             }
+
+            if (stage_state.heap.descriptor_heap_mode) {
+                const VkShaderStageFlagBits stage = stage_state.GetStage();
+                auto& stage_ci =
+                    GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(modified_pipeline_ci, stage);
+                AddDescriptorHeapMappings(reinterpret_cast<VkBaseOutStructure*>(&stage_ci));
+            }
+            return true;
+        };
+        queued_jobs.emplace_back(std::move(job));
+    }
+    return jobs ? true : InstrumentShaderJobs(pipeline_jobs);
+}
+
+// Instruments the queued stages, each spirv::Module is independent so they can be instrumented at the same time. Stages of the same
+// VkShaderModule still wait on each other as the module is locked while instrumenting it.
+bool GpuShaderInstrumentor::InstrumentShaderJobs(ShaderInstrumentationJobs& jobs) {
+    auto instrument = [this, &jobs](uint32_t i) {
+        ShaderInstrumentationJob& job = *jobs[i];
+        std::unique_lock<std::mutex> module_lock(job.module_state->module_mutex_);
+        InstrumentShader(job.module_state->spirv->words_, job.interface, *job.out_status, job.instrumented_spirv);
+    };
+
+    const uint32_t job_count = static_cast<uint32_t>(jobs.size());
+    if (instrumentation_pool_ && job_count > 1) {
+        // Each job logs into its own capture and the captures are flushed in queue order, so the messages come out the same as
+        // when instrumenting one stage after the other
+        std::vector<LogCapture> captures(job_count);
+        instrumentation_pool_->ParallelFor(job_count, [&](uint32_t i) {
+            LogCapture::Scope capture_scope(captures[i]);
+            instrument(i);
+        });
+        for (LogCapture& capture : captures) {
+            capture.Flush(*debug_report);
+        }
+    } else {
+        for (uint32_t i = 0; i < job_count; ++i) {
+            instrument(i);
         }
+    }
 
-        if (stage_state.heap.descriptor_heap_mode) {
-            const VkShaderStageFlagBits stage = stage_state.GetStage();
-            auto& stage_ci =
-                GetShaderStageCI<SafeCreateInfo, vku::safe_VkPipelineShaderStageCreateInfo>(modified_pipeline_ci, stage);
-            AddDescriptorHeapMappings(reinterpret_cast<VkBaseOutStructure*>(&stage_ci));
+    for (const auto& job : jobs) {
+        if (!job->apply(*job)) {
+            return false;
         }
     }
     return true;
@@ -1517,9 +1591,14 @@ void GpuShaderInstrumentor::PostCallRecordPipelineCreationShaderInstrumentation(
             shader_module_handle = kPipelineStageInfoHandle;
         }
 
+        std::shared_ptr<const debug_printf::FormatTable> format_table;
+        if (instrumentation_metadata.status.host.has_debug_printf) {
+            format_table = debug_printf::BuildFormatTable(code);
+        }
+
         instrumented_shaders_map_.insert_or_assign(instrumentation_metadata.unique_shader_id, pipeline_state.VkHandle(),
                                                    shader_module_handle, VK_NULL_HANDLE, std::move(code),
-                                                   std::move(instrumentation_metadata.status.device));
+                                                   std::move(instrumentation_metadata.status.device), std::move(format_table));
     }
 }
 
@@ -1722,9 +1801,14 @@ bool GpuShaderInstrumentor::PreCallRecordPipelineCreationShaderInstrumentationGP
                 if (modified_module_state && modified_module_state->spirv) {
                     original_spirv_copy = modified_module_state->spirv->words_;
                 }
+                std::shared_ptr<const debug_printf::FormatTable> format_table;
+                if (stage_status.host.has_debug_printf) {
+                    format_table = debug_printf::BuildFormatTable(original_spirv_copy);
+                }
                 instrumented_shaders_map_.insert_or_assign(unique_shader_id, modified_library_ci->pLibraries[modified_lib_i],
                                                            instrumented_shader_module, VK_NULL_HANDLE,
-                                                           std::move(original_spirv_copy), std::move(stage_status.device));
+                                                           std::move(original_spirv_copy), std::move(stage_status.device),
+                                                           std::move(format_table));
             }
         }
 
@@ -1795,86 +1879,74 @@ void GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t>& in
 
     spirv::Module module(input_spirv, debug_report, instrumentation_device_settings_, interface, out_status);
 
+    // One walk to find what the shader contains, passes with nothing to look at are not run
+    spirv::PassManager pass_manager(module, !gpuav_settings.debug_disable_pass_manager);
     bool modified = false;
 
     // If descriptor indexing is enabled, enable length checks and updated descriptor checks
     if (gpuav_settings.shader_instrumentation.descriptor_checks) {
         if (interface.descriptor_mode == vvl::DescriptorModeClassic) {
             // Will wrap descriptor indexing with if/else to prevent crashing if OOB
-            spirv::DescriptorIndexingOOBPass oob_pass(module);
-            modified |= oob_pass.Run();
+            modified |= pass_manager.Run<spirv::DescriptorIndexingOOBPass>();
 
             // Depending on the DescriptorClass, will add dedicated check
             if (!modified_features.robustBufferAccess) {
                 // This check is for catching OOB in a UBO/SSBO which is caught with robustBufferAccess
-                spirv::DescriptorClassGeneralBufferPass general_buffer_pass(module);
-                modified |= general_buffer_pass.Run();
+                modified |= pass_manager.Run<spirv::DescriptorClassGeneralBufferPass>();
 
                 // Details being worked out in https://gitlab.khronos.org/vulkan/vulkan/-/issues/3977
                 // But for what we are checking for, can rely on robustBufferAccess
-                spirv::DescriptorClassTexelBufferPass texel_buffer_pass(module);
-                modified |= texel_buffer_pass.Run();
+                modified |= pass_manager.Run<spirv::DescriptorClassTexelBufferPass>();
             } else if (modified_features.cooperativeMatrix && !modified_features.cooperativeMatrixRobustBufferAccess) {
                 // Cooperative Matrix OOB rules are unique and have their own robustness feature, so still need to run the pass
-                spirv::DescriptorClassGeneralBufferPass general_buffer_pass(module);
-                modified |= general_buffer_pass.Run();
+                modified |= pass_manager.Run<spirv::DescriptorClassGeneralBufferPass>();
             }
         } else if (interface.descriptor_mode == vvl::DescriptorModeBuffer) {
-            spirv::DescriptorBufferPass pass(module);
-            modified |= pass.Run();
+            modified |= pass_manager.Run<spirv::DescriptorBufferPass>();
         } else if (interface.descriptor_mode == vvl::DescriptorModeHeap) {
-            spirv::DescriptorHeapPass pass(module);
-            modified |= pass.Run();
+            modified |= pass_manager.Run<spirv::DescriptorHeapPass>();
         }
     }
 
     if (gpuav_settings.shader_instrumentation.buffer_device_address) {
-        spirv::BufferDeviceAddressPass pass(module);
-        modified |= pass.Run();
+        modified |= pass_manager.Run<spirv::BufferDeviceAddressPass>();
     }
 
     if (gpuav_settings.shader_instrumentation.trace_ray) {
-        spirv::TraceRayPass pass(module);
-        modified |= pass.Run();
+        modified |= pass_manager.Run<spirv::TraceRayPass>();
     }
 
     if (gpuav_settings.shader_instrumentation.shared_memory_data_race) {
-        spirv::SharedMemoryDataRacePass pass(module);
-        modified |= pass.Run();
+        modified |= pass_manager.Run<spirv::SharedMemoryDataRacePass>();
     }
 
     if (gpuav_settings.shader_instrumentation.mesh_shading) {
-        spirv::MeshShading pass(module);
-        modified |= pass.Run();
+        modified |= pass_manager.Run<spirv::MeshShading>();
     }
 
     // Post Process instrumentation passes assume the things inside are valid, but putting at the end, things above will wrap checks
     // in a if/else, this means they will be gaurded as if they were inside the above passes
     if (gpuav_settings.shader_instrumentation.post_process_descriptor_indexing) {
         if (interface.descriptor_mode == vvl::DescriptorModeClassic) {
-            spirv::PostProcessDescriptorIndexingPass pass(module);
-            modified |= pass.Run();
+            modified |= pass_manager.Run<spirv::PostProcessDescriptorIndexingPass>();
         }
     }
 
     if (gpuav_settings.shader_instrumentation.vertex_attribute_fetch_oob) {
         if (!modified_features.robustBufferAccess) {
-            spirv::VertexAttributeFetchOobPass pass(module);
-            modified |= pass.Run();
+            modified |= pass_manager.Run<spirv::VertexAttributeFetchOobPass>();
         }
     }
 
     // Currently only runs in Safe Mode until have perf numbers how costly it is to enable
     if (gpuav_settings.shader_instrumentation.sanitizer && gpuav_settings.safe_mode) {
-        spirv::SanitizerPass pass(module);
-        modified |= pass.Run();
+        modified |= pass_manager.Run<spirv::SanitizerPass>();
     }
 
     // If we have passes that require inject LogError before the shader end we do it now.
     // We have a dedicated pass to ensure the LogError is only added once
     if (module.need_log_error_) {
-        spirv::LogErrorPass log_error_pass(module);
-        modified |= log_error_pass.Run();
+        modified |= pass_manager.Run<spirv::LogErrorPass>();
     }
 
     // If there were GLSL written function injected, we will grab them and link them in here
@@ -1887,9 +1959,16 @@ void GpuShaderInstrumentor::InstrumentShader(const vvl::span<const uint32_t>& in
     // 2. We might want to debug the above passes and want to inject our own debug printf calls
     if (gpuav_settings.debug_printf_enabled) {
         // binding slot allows debug printf to be slotted in the same set as GPU-AV if needed
-        spirv::DebugPrintfPass pass(module, internal_only_debug_printf_, glsl::kBindingInstDebugPrintf);
+        // Other stages might be instrumented at the same time, only add to internal_only_debug_printf_ at the end
+        std::vector<spirv::InternalOnlyDebugPrintf> internal_only_debug_printf;
+        spirv::DebugPrintfPass pass(module, internal_only_debug_printf, glsl::kBindingInstDebugPrintf);
         out_status.host.has_debug_printf = pass.Run();
         modified |= out_status.host.has_debug_printf;
+        if (!internal_only_debug_printf.empty()) {
+            std::lock_guard<std::mutex> guard(internal_only_debug_printf_lock_);
+            internal_only_debug_printf_.insert(internal_only_debug_printf_.end(), internal_only_debug_printf.begin(),
+                                               internal_only_debug_printf.end());
+        }
     }
 
     // If nothing was instrumented, leave early to save time
@@ -1949,7 +2028,9 @@ void GpuShaderInstrumentor::InternalError(LogObjectList objlist, const Location&
     // Once we encounter an internal issue disconnect everything.
     // This prevents need to check "if (aborted)" (which is awful when we easily forget to check somewhere and the user gets spammed
     // with errors making it hard to see the first error with the real source of the problem).
-    dispatch_device_->ReleaseValidationObject(LayerObjectTypeGpuAssisted);
+    if (!released_.exchange(true)) {
+        dispatch_device_->ReleaseValidationObject(LayerObjectTypeGpuAssisted);
+    }
 }
 
 // Dedicated warning VUID that likely can be ignored.
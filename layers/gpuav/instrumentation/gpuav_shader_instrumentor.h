@@ -16,13 +16,19 @@
  */
 #pragma once
 
+#include "gpuav/debug_printf/debug_printf.h"
 #include "gpuav/spirv/instrumentation_status.h"
 #include "state_tracker/descriptor_mode.h"
 #include "state_tracker/shader_instruction.h"
 #include "state_tracker/state_tracker.h"
 #include "gpuav/spirv/interface.h"
 #include "containers/custom_containers.h"
+#include "utils/thread_pool.h"
 
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 // There is a spirv::Instruction used for normal validation.
@@ -70,6 +76,9 @@ struct InstrumentedShader {
     std::vector<uint32_t> original_spirv;
 
     gpuav::spirv::InstrumentationStatus::Device status;
+
+    // Only for shaders with DebugPrintf instructions
+    std::shared_ptr<const debug_printf::FormatTable> debug_printf_format_table;
 };
 
 // Historically this was an common interface to both GPU-AV and DebugPrintf before the were merged together.
@@ -186,11 +195,30 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     void BuildDescriptorSetLayoutInfo(const vvl::DescriptorSetLayout& set_layout_state, const uint32_t set_layout_index,
                                       spirv::InstrumentationDescriptorSetLayouts& out_instrumentation_dsl);
 
+    // A shader stage of a pipeline waiting to be instrumented.
+    // The stages of all the create infos of a vkCreate*Pipelines call are queued first, then instrumented together (on
+    // instrumentation_pool_ when there is one) and applied to their create info in queue order, see InstrumentShaderJobs.
+    struct ShaderInstrumentationJob {
+        explicit ShaderInstrumentationJob(const Location &loc) : loc(loc), interface(this->loc) {}
+        const Location loc;
+        spirv::InstrumentationInterface interface;
+        std::shared_ptr<vvl::ShaderModule> module_state;
+        spirv::InstrumentationStatus *out_status = nullptr;
+        std::vector<uint32_t> instrumented_spirv;
+        // Puts the instrumented shader in the create info, returns false if GPU-AV had to abort
+        std::function<bool(ShaderInstrumentationJob &)> apply;
+    };
+    // Jobs are not moved once queued, |interface| points to their |loc|
+    using ShaderInstrumentationJobs = std::vector<std::unique_ptr<ShaderInstrumentationJob>>;
+
+    // If |jobs| is null the stages are instrumented before returning, otherwise they are only queued in it
     template <typename SafeCreateInfo>
     [[nodiscard]] bool PreCallRecordPipelineCreationShaderInstrumentation(
         const VkAllocationCallbacks *pAllocator, vvl::Pipeline &pipeline_state, SafeCreateInfo &modified_pipeline_ci,
         uint32_t stages_count, const Location &loc,
-        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
+        std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata,
+        ShaderInstrumentationJobs *jobs = nullptr);
+    [[nodiscard]] bool InstrumentShaderJobs(ShaderInstrumentationJobs &jobs);
     void PostCallRecordPipelineCreationShaderInstrumentation(
         vvl::Pipeline &pipeline_state, uint32_t stages_count,
         std::vector<chassis::ShaderInstrumentationMetadata> &shader_instrumentation_metadata);
@@ -221,7 +249,10 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     // If we are deep into a call stack, we can use this to return up to the chassis call.
     // It should only be used after calls that might abort, not to be used for guarding a function (unless a case is found that make
     // sense too)
-    mutable bool aborted_ = false;
+    // Stages can be instrumented on worker threads, which can abort while other threads read it
+    mutable std::atomic<bool> aborted_ = false;
+    // Stages can be instrumented on worker threads, only the first internal error releases the validation object
+    mutable std::atomic<bool> released_ = false;
 
     // Some errors/warnings only want to report once for the lifetime of the app
     bool reported_code_type_binary_ = false;
@@ -235,7 +266,12 @@ class GpuShaderInstrumentor : public vvl::DeviceProxy {
     std::vector<VkDescriptorSetLayoutBinding> instrumentation_bindings_;
     spirv::DeviceSettings instrumentation_device_settings_;
 
+    // Appended to by the instrumentation threads while the debug printf output is read
     std::vector<spirv::InternalOnlyDebugPrintf> internal_only_debug_printf_;
+    mutable std::mutex internal_only_debug_printf_lock_;
+
+    // Only created when gpuav_parallel_shader_instrumentation is enabled, see InstrumentShaderJobs
+    std::unique_ptr<vvl::ThreadPool> instrumentation_pool_;
 
     // VK_EXT_descriptor_buffer
     // Each action command advances into the global indirect buffer by this stride
@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <vulkan/vulkan_core.h>
 #include "generated/dispatch_functions.h"
 #include "gpuav/resources/gpuav_state_trackers.h"
@@ -45,6 +46,24 @@ CommandBufferSubState::CommandBufferSubState(Validator& gpuav, vvl::CommandBuffe
 
 CommandBufferSubState::~CommandBufferSubState() {}
 
+// Number of error words actually in the error output buffer.
+// The written size is the number of words the shaders tried to write, it can be bigger than the buffer.
+static uint32_t GetErrorRecordsWordCount(const uint32_t* error_output_buffer_ptr) {
+    const uint32_t written_words =
+        std::min(error_output_buffer_ptr[cst::stream_output_size_offset], uint32_t(glsl::kErrorBufferDataLength));
+    return written_words - (written_words % glsl::kErrorRecordSize);
+}
+
+// Zeroes the error records and the written size, leaving the buffer as the shaders expect it.
+// Only the written words are cleared, the rest of the stream is already zero.
+static void ClearErrorRecords(uint32_t* error_output_buffer_ptr) {
+    const uint32_t records_word_count = GetErrorRecordsWordCount(error_output_buffer_ptr);
+    if (records_word_count != 0) {
+        memset(&error_output_buffer_ptr[cst::stream_output_data_offset], 0, records_word_count * sizeof(uint32_t));
+    }
+    error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
+}
+
 void CommandBufferSubState::AllocateResources(const Location& loc) {
     VkResult result = VK_SUCCESS;
 
@@ -63,17 +82,20 @@ void CommandBufferSubState::AllocateResources(const Location& loc) {
     }
 
     // Error output buffer
+    // Kept across resets: its error stream is emptied when processed, so only the header needs to be written here
     {
-        error_output_buffer_range_ = gpu_resources_manager.GetHostCoherentBufferRange(glsl::kErrorBufferByteSize);
         if (error_output_buffer_range_.buffer == VK_NULL_HANDLE) {
-            return;
+            error_output_buffer_range_ = gpuav_.error_buffer_pool_.Get();
+            if (error_output_buffer_range_.buffer == VK_NULL_HANDLE) {
+                return;
+            }
+        } else {
+            // Command buffer can be reset without its last submission having been processed
+            ClearErrorRecords((uint32_t*)error_output_buffer_range_.offset_mapped_ptr);
         }
 
-        memset(error_output_buffer_range_.offset_mapped_ptr, 0, (size_t)error_output_buffer_range_.size);
-        if (gpuav_.gpuav_settings.shader_instrumentation.descriptor_checks) {
-            ((uint32_t*)error_output_buffer_range_.offset_mapped_ptr)[cst::stream_output_flags_offset] =
-                cst::inst_buffer_oob_enabled;
-        }
+        ((uint32_t*)error_output_buffer_range_.offset_mapped_ptr)[cst::stream_output_flags_offset] =
+            gpuav_.gpuav_settings.shader_instrumentation.descriptor_checks ? cst::inst_buffer_oob_enabled : 0;
     }
 
     // Commands errors counts buffer
@@ -195,6 +217,10 @@ void CommandBufferSubState::ResetCBState(bool should_destroy) {
     }
 
     if (should_destroy) {
+        if (error_output_buffer_range_.buffer != VK_NULL_HANDLE) {
+            ClearErrorRecords((uint32_t*)error_output_buffer_range_.offset_mapped_ptr);
+            gpuav_.error_buffer_pool_.Return(error_output_buffer_range_);
+        }
         error_output_buffer_range_ = {};
         cmd_errors_counts_buffer_.Destroy();
 
@@ -390,15 +416,16 @@ void CommandBufferSubState::OnCompletion(VkQueue queue, const std::vector<std::s
         // A zero here means that the shader instrumentation didn't write anything.
         if (total_words != 0) {
             uint32_t* const error_records_start = &error_output_buffer_ptr[cst::stream_output_data_offset];
-            assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
-            uint32_t* const error_records_end =
-                error_output_buffer_ptr + (glsl::kErrorBufferByteSize - cst::stream_output_data_offset);
+            uint32_t* const error_records_end = error_records_start + GetErrorRecordsWordCount(error_output_buffer_ptr);
 
             uint32_t* error_record_ptr = error_records_start;
-            uint32_t record_size = error_record_ptr[glsl::kHeader_ErrorRecordSizeOffset];
-            assert(record_size == glsl::kErrorRecordSize);
+            while (error_record_ptr < error_records_end) {
+                const uint32_t record_size = error_record_ptr[glsl::kHeader_ErrorRecordSizeOffset];
+                assert(record_size == glsl::kErrorRecordSize);
+                if (record_size == 0 || (error_record_ptr + record_size) > error_records_end) {
+                    break;
+                }
 
-            while (record_size > 0 && (error_record_ptr + record_size) <= error_records_end) {
                 const uint32_t error_logger_i =
                     error_record_ptr[glsl::kHeader_ActionIdErrorLoggerIdOffset] & glsl::kErrorLoggerId_Mask;
 
@@ -424,17 +451,14 @@ void CommandBufferSubState::OnCompletion(VkQueue queue, const std::vector<std::s
 
                 // Next record
                 error_record_ptr += record_size;
-                record_size = error_record_ptr[glsl::kHeader_ErrorRecordSizeOffset];
             }
 
             VVL_TracyPlot("GPU-AV errors count", int64_t(total_words / glsl::kErrorRecordSize));
 
-            // Clear the written size and any error messages. Note that this preserves the first word, which contains flags.
-            assert(glsl::kErrorBufferByteSize > cst::stream_output_data_offset);
-            memset(&error_output_buffer_ptr[cst::stream_output_flags_offset + 1], 0,
-                   size_t(error_output_buffer_range_.size) - sizeof(uint32_t));
+            // Clear the written size and error records, the flags word is preserved.
+            // Only what was written is cleared, instead of the whole buffer every submission.
+            ClearErrorRecords(error_output_buffer_ptr);
         }
-        error_output_buffer_ptr[cst::stream_output_size_offset] = 0;
     }
 
     cmd_errors_counts_buffer_.Clear();
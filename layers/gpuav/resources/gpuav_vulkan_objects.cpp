@@ -440,6 +440,8 @@ void GpuResourcesManager::DestroyResources() {
     buffer_caches_.DestroyBuffers();
 }
 
+VkDeviceSize GpuResourcesManager::BufferCacheByteSize() const { return buffer_caches_.TotalByteSize(); }
+
 void GpuResourcesManager::BufferCache::Create(VkBufferUsageFlags buffer_usage_flags, const VmaAllocationCreateInfo allocation_ci) {
     std::unique_lock<std::mutex> lock(mtx, std::defer_lock);
     if (thread_safe_) {
@@ -578,6 +580,51 @@ void GpuResourcesManager::BufferCache::DestroyBuffers() {
     cached_buffers_blocks_.clear();
 }
 
+VkDeviceSize GpuResourcesManager::BufferCache::TotalByteSize() const {
+    std::unique_lock<std::mutex> lock(mtx, std::defer_lock);
+    if (thread_safe_) {
+        lock.lock();
+    }
+
+    VkDeviceSize byte_size = 0;
+    for (const CachedBufferBlock& cached_buffer_block : cached_buffers_blocks_) {
+        byte_size += cached_buffer_block.total_range.size();
+    }
+    return byte_size;
+}
+
+vko::BufferRange BufferRangePool::Get() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        if (!free_ranges_.empty()) {
+            vko::BufferRange buffer_range = free_ranges_.back();
+            free_ranges_.pop_back();
+            return buffer_range;
+        }
+    }
+
+    vko::BufferRange buffer_range = gpu_resources_manager_.GetHostCoherentBufferRange(range_size_);
+    if (buffer_range.buffer != VK_NULL_HANDLE) {
+        memset(buffer_range.offset_mapped_ptr, 0, (size_t)buffer_range.size);
+    }
+    return buffer_range;
+}
+
+void BufferRangePool::Return(const vko::BufferRange& buffer_range) {
+    if (buffer_range.buffer == VK_NULL_HANDLE) {
+        return;
+    }
+    assert(buffer_range.size == range_size_);
+    std::lock_guard<std::mutex> guard(lock_);
+    // Most recently used range is handed out first, it is the most likely to still be in the CPU caches
+    free_ranges_.emplace_back(buffer_range);
+}
+
+void BufferRangePool::Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    free_ranges_.clear();
+}
+
 bool StagingBuffer::CanDeviceEverStage(Validator& gpuav) {
     return gpuav.phys_dev_props.deviceType != VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU;
 }
@@ -19,6 +19,7 @@
 
 #include "external/vma/vma.h"
 
+#include <mutex>
 #include <typeinfo>
 #include <vector>
 #include "containers/custom_containers.h"
@@ -117,6 +118,9 @@ class GpuResourcesManager {
     void ReturnResources();
     void DestroyResources();
 
+    // Size of all the buffers of the caches, used or not
+    VkDeviceSize BufferCacheByteSize() const;
+
     Validator &gpuav_;
 
   private:
@@ -142,6 +146,7 @@ class GpuResourcesManager {
         void ReturnBufferRange(const vko::BufferRange &buffer_range);
         void ReturnBuffers();
         void DestroyBuffers();
+        VkDeviceSize TotalByteSize() const;
 
       private:
         bool thread_safe_ = false;
@@ -194,9 +199,35 @@ class GpuResourcesManager {
             device_local_indirect.DestroyBuffers();
             staging.DestroyBuffers();
         }
+
+        VkDeviceSize TotalByteSize() const {
+            return host_coherent.TotalByteSize() + host_cached.TotalByteSize() + device_local.TotalByteSize() +
+                   device_local_indirect.TotalByteSize() + staging.TotalByteSize();
+        }
     } buffer_caches_;
 };
 
+// Buffer ranges of a single size that are reused as they are: a returned range keeps its content until it is handed out again.
+// Users that put a range back in a known state before returning it don't need to initialize it every time they get one.
+// Ranges are sub-allocated from |gpu_resources_manager| and live as long as it does.
+class BufferRangePool {
+  public:
+    BufferRangePool(GpuResourcesManager &gpu_resources_manager, VkDeviceSize range_size)
+        : gpu_resources_manager_(gpu_resources_manager), range_size_(range_size) {}
+
+    // Ranges that were never used are zeroed
+    vko::BufferRange Get();
+    void Return(const vko::BufferRange &buffer_range);
+    // Forgets the free ranges, to call before the resources of |gpu_resources_manager| are destroyed
+    void Clear();
+
+  private:
+    GpuResourcesManager &gpu_resources_manager_;
+    const VkDeviceSize range_size_;
+    std::mutex lock_;
+    std::vector<vko::BufferRange> free_ranges_;
+};
+
 class StagingBuffer {
   public:
     static bool CanDeviceEverStage(Validator &gpuav);
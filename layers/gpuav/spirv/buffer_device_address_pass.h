@@ -30,6 +30,7 @@ class BufferDeviceAddressPass : public Pass {
     BufferDeviceAddressPass(Module& module);
     const char* Name() const final { return "BufferDeviceAddressPass"; }
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.has_bda_access; }
     void PrintDebugInfo() const final;
 
   private:
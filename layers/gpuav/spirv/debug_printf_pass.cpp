@@ -318,7 +318,7 @@ uint32_t DebugPrintfPass::CreateDescriptorSet() {
     }
 
     const uint32_t struct_type_id = module_.TakeNextId();
-    auto new_struct_inst = std::make_unique<Instruction>(4, spv::OpTypeStruct);
+    auto new_struct_inst = module_.NewInstruction(4, spv::OpTypeStruct);
     new_struct_inst->Fill({struct_type_id, uint32_type.Id(), runtime_array_type_id});
     const Type& struct_type = type_manager_.AddType(std::move(new_struct_inst), SpvType::kStruct);
     module_.AddDecoration(struct_type_id, spv::DecorationBlock, {});
@@ -328,7 +328,7 @@ uint32_t DebugPrintfPass::CreateDescriptorSet() {
     // create a storage buffer interface variable
     const Type& pointer_type = type_manager_.GetTypePointer(spv::StorageClassStorageBuffer, struct_type);
     const uint32_t output_buffer_variable_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpVariable);
+    auto new_inst = module_.NewInstruction(4, spv::OpVariable);
     new_inst->Fill({pointer_type.Id(), output_buffer_variable_id, spv::StorageClassStorageBuffer});
     type_manager_.AddVariable(std::move(new_inst), pointer_type);
     module_.AddInterfaceVariables(output_buffer_variable_id, spv::StorageClassStorageBuffer);
@@ -373,7 +373,7 @@ void DebugPrintfPass::CreateBufferWriteFunction(uint32_t argument_count, uint32_
         for (size_t i = 0; i < argument_count; i++) {
             words.push_back(uint32_type_id);
         }
-        auto new_inst = std::make_unique<Instruction>((uint32_t)words.size() + 1, spv::OpTypeFunction);
+        auto new_inst = module_.NewInstruction((uint32_t)words.size() + 1, spv::OpTypeFunction);
         new_inst->Fill(words);
         type_manager_.AddType(std::move(new_inst), SpvType::kFunction);
     }
@@ -382,13 +382,13 @@ void DebugPrintfPass::CreateBufferWriteFunction(uint32_t argument_count, uint32_
     Function& new_function = module_.functions_.emplace_back(module_);
     std::vector<uint32_t> function_param_ids;
     {
-        auto new_inst = std::make_unique<Instruction>(5, spv::OpFunction);
+        auto new_inst = module_.NewInstruction(5, spv::OpFunction);
         new_inst->Fill({void_type_id, function_id, spv::FunctionControlMaskNone, function_type_id});
         new_function.pre_block_inst_.emplace_back(std::move(new_inst));
 
         for (size_t i = 0; i < argument_count; i++) {
             const uint32_t new_id = module_.TakeNextId();
-            auto param_inst = std::make_unique<Instruction>(3, spv::OpFunctionParameter);
+            auto param_inst = module_.NewInstruction(3, spv::OpFunctionParameter);
             param_inst->Fill({uint32_type_id, new_id});
             new_function.pre_block_inst_.emplace_back(std::move(param_inst));
             function_param_ids.push_back(new_id);
@@ -511,7 +511,7 @@ void DebugPrintfPass::CreateBufferWriteFunction(uint32_t argument_count, uint32_
     }
 
     {
-        auto new_inst = std::make_unique<Instruction>(1, spv::OpFunctionEnd);
+        auto new_inst = module_.NewInstruction(1, spv::OpFunctionEnd);
         new_function.post_block_inst_.emplace_back(std::move(new_inst));
     }
 }
@@ -27,6 +27,7 @@ class DescriptorBufferPass : public Pass {
     DescriptorBufferPass(Module& module);
     const char* Name() const final { return "DescriptorBufferPass"; }
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.has_descriptor_access; }
     void PrintDebugInfo() const final;
 
   private:
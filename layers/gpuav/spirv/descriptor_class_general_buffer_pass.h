@@ -31,6 +31,7 @@ class DescriptorClassGeneralBufferPass : public Pass {
     const char* Name() const final { return "DescriptorClassGeneralBufferPass"; }
 
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.has_descriptor_access; }
     void PostProcess() final;
     void PrintDebugInfo() const final;
 
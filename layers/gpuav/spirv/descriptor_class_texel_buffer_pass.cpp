@@ -14,6 +14,7 @@
  */
 
 #include "descriptor_class_texel_buffer_pass.h"
+#include "containers/container_utils.h"
 #include "function_basic_block.h"
 #include "module.h"
 #include <spirv/unified1/spirv.hpp>
@@ -166,6 +167,29 @@ bool DescriptorClassTexelBufferPass::Instrument() {
         return false;  // If there is no bindings, nothing to instrument
     }
 
+    if (summary_) {
+        CandidatePosition position;
+        auto is_target = [](spv::Op opcode) { return IsValueIn(opcode, kTargetOpcodes); };
+        for (const Candidate* candidate : summary_->GetCandidates(is_target)) {
+            FindCandidate(*candidate, position);
+            if (!position.found) {
+                continue;
+            }
+            InstructionMeta meta;
+            if (!RequiresInstrumentation(*candidate->function, *(position.inst_it->get()), meta)) {
+                continue;
+            }
+
+            if (MaxInstrumentationsCountReached()) {
+                return instrumentations_count_ != 0;
+            }
+            instrumentations_count_++;
+
+            CreateFunctionCall(**position.block_it, &position.inst_it, meta);
+        }
+        return instrumentations_count_ != 0;
+    }
+
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (Function& function : module_.functions_) {
         if (!function.called_from_target_) {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <array>
 #include "pass.h"
 
 namespace gpuav {
@@ -28,10 +29,13 @@ class DescriptorClassTexelBufferPass : public Pass {
     const char* Name() const final { return "DescriptorClassTexelBufferPass"; }
 
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.HasAnyOpcode(kTargetOpcodes); }
     void PostProcess() final;
     void PrintDebugInfo() const final;
 
   private:
+    static constexpr std::array<spv::Op, 3> kTargetOpcodes = {spv::OpImageFetch, spv::OpImageRead, spv::OpImageWrite};
+
     // This is metadata tied to a single instruction gathered during RequiresInstrumentation() to be used later
     struct InstructionMeta {
         const Instruction* target_instruction = nullptr;
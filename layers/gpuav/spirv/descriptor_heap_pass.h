@@ -30,6 +30,7 @@ class DescriptorHeapPass : public Pass {
     DescriptorHeapPass(Module& module);
     const char* Name() const final { return "DescriptorHeapPass"; }
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.has_descriptor_access; }
     void PrintDebugInfo() const final;
 
   private:
@@ -29,6 +29,10 @@ class DescriptorIndexingOOBPass : public Pass {
     DescriptorIndexingOOBPass(Module& module);
     const char* Name() const final { return "DescriptorIndexingOOBPass"; }
     bool Instrument() final;
+    // Also looks at every OpSampledImage, see the OpCopyObject injected in Instrument()
+    bool HasCandidates(const ModuleSummary& summary) const final {
+        return summary.has_descriptor_access || summary.HasOpcode(spv::OpSampledImage);
+    }
     void PrintDebugInfo() const final;
 
   private:
@@ -41,7 +41,7 @@ void Function::ToBinary(std::vector<uint32_t>& out) const {
 
 // Used when loading initial SPIR-V
 // The Function pointer is not stable yet
-BasicBlock::BasicBlock(std::unique_ptr<Instruction> label) {
+BasicBlock::BasicBlock(InstructionPtr label) {
     instructions_.emplace_back(std::move(label));  // OpLabel
 }
 
@@ -92,7 +92,7 @@ void BasicBlock::CreateInstruction(spv::Op opcode, const std::vector<uint32_t>&
     }
 
     // Add 1 as we need to reserve the first word for the opcode/length
-    auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), opcode);
+    auto new_inst = function_->module_.NewInstruction((uint32_t)(words.size() + 1), opcode);
     new_inst->Fill(words);
 
     const uint32_t result_id = new_inst->ResultId();
@@ -108,7 +108,7 @@ void BasicBlock::CreateInstruction(spv::Op opcode, const std::vector<uint32_t>&
     }
 }
 
-Function::Function(Module& module, std::unique_ptr<Instruction> function_inst) : id_(function_inst->ResultId()), module_(module) {
+Function::Function(Module& module, InstructionPtr function_inst) : id_(function_inst->ResultId()), module_(module) {
     // Used when loading initial SPIR-V
     pre_block_inst_.emplace_back(std::move(function_inst));  // OpFunction
 }
@@ -32,13 +32,33 @@ struct Function;
 // randomly in a block, for those cases, we just need to manage the iterator The unique_ptr allows us to create instructions outside
 // module scope and bring them back.
 using Instruction = ::spirv::Instruction;
-using InstructionList = std::vector<std::unique_ptr<Instruction>>;
+
+// Instructions are allocated in the arena of their Module (see Module::NewInstruction) and the memory is released all at once with
+// the Module, so the deleter only runs the destructor (long instructions keep their words on the heap).
+// An instruction made with std::make_unique can still be added to a list, it is deleted normally.
+struct InstructionDeleter {
+    InstructionDeleter() = default;
+    InstructionDeleter(std::default_delete<Instruction>) {}
+    explicit InstructionDeleter(bool in_arena) : in_arena(in_arena) {}
+
+    void operator()(Instruction* inst) const {
+        if (in_arena) {
+            inst->~Instruction();
+        } else {
+            delete inst;
+        }
+    }
+
+    bool in_arena = false;
+};
+using InstructionPtr = std::unique_ptr<Instruction, InstructionDeleter>;
+using InstructionList = std::vector<InstructionPtr>;
 using InstructionIt = InstructionList::iterator;
 
 // Since CFG analysis/manipulation is not a main focus, Blocks/Funcitons are just simple containers for ordering Instructions
 struct BasicBlock {
     // Used when loading initial SPIR-V
-    BasicBlock(std::unique_ptr<Instruction> label);
+    BasicBlock(InstructionPtr label);
     // Used for times we need to inject a new block
     BasicBlock(Module& module, Function* function);
 
@@ -81,7 +101,7 @@ using BasicBlockIt = BasicBlockList::iterator;
 
 struct Function {
     // Used to add functions building up SPIR-V the first time
-    Function(Module& module, std::unique_ptr<Instruction> function_inst);
+    Function(Module& module, InstructionPtr function_inst);
     // Used to link in new functions
     Function(Module& module) : id_(0), module_(module) {}
 
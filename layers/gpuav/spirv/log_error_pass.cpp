@@ -41,7 +41,7 @@ void LogErrorPass::ClearErrorPayloadVariable(Function& function) {
         const Type& uint32_type = type_manager_.GetTypeInt(32, false);
 
         const uint32_t struct_type_id = module_.TakeNextId();
-        auto new_struct_inst = std::make_unique<Instruction>(7, spv::OpTypeStruct);
+        auto new_struct_inst = module_.NewInstruction(7, spv::OpTypeStruct);
         new_struct_inst->Fill({
             struct_type_id,
             uint32_type.Id(),  // uint inst_offset;
@@ -54,7 +54,7 @@ void LogErrorPass::ClearErrorPayloadVariable(Function& function) {
         type_manager_.AddStructTypeForLinking(&struct_type);
         const Type& pointer_type = type_manager_.GetTypePointer(spv::StorageClassPrivate, struct_type);
         {
-            auto new_inst = std::make_unique<Instruction>(4, spv::OpVariable);
+            auto new_inst = module_.NewInstruction(4, spv::OpVariable);
             new_inst->Fill({pointer_type.Id(), module_.error_payload_variable_id_, spv::StorageClassPrivate});
             type_manager_.AddVariable(std::move(new_inst), pointer_type);
         }
@@ -62,7 +62,7 @@ void LogErrorPass::ClearErrorPayloadVariable(Function& function) {
         const uint32_t uint32_0_id = type_manager_.GetConstantZeroUint32().Id();
         const uint32_t constant_id = module_.TakeNextId();
         {
-            auto new_inst = std::make_unique<Instruction>(8, spv::OpConstantComposite);
+            auto new_inst = module_.NewInstruction(8, spv::OpConstantComposite);
             new_inst->Fill({struct_type.Id(), constant_id, uint32_0_id, uint32_0_id, uint32_0_id, uint32_0_id, uint32_0_id});
             const Constant& clear_constant = type_manager_.AddConstant(std::move(new_inst), struct_type);
             error_payload_variable_clear_ = clear_constant.Id();
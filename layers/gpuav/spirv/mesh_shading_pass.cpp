@@ -111,6 +111,40 @@ bool MeshShading::Instrument() {
         guard_all_task_payloads_ = true;
     }
 
+    if (summary_) {
+        CandidatePosition position;
+        auto is_target = [this](spv::Op opcode) {
+            return opcode == spv::OpSetMeshOutputsEXT ||
+                   (guard_all_task_payloads_ && (IsValueIn(opcode, {spv::OpLoad, spv::OpStore}) || AtomicOperation(opcode)));
+        };
+        for (const Candidate* candidate : summary_->GetCandidates(is_target)) {
+            FindCandidate(*candidate, position);
+            if (!position.found || (*position.block_it)->IsLoopHeader()) {
+                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
+            }
+            BasicBlock& current_block = **position.block_it;
+
+            InstructionMeta meta;
+            if (!RequiresInstrumentation(*candidate->function, *(position.inst_it->get()), meta)) {
+                continue;
+            }
+
+            if (MaxInstrumentationsCountReached()) {
+                return instrumentations_count_ != 0;
+            }
+            instrumentations_count_++;
+
+            if (!module_.settings_.safe_mode) {
+                CreateFunctionCall(current_block, &position.inst_it, meta);
+            } else {
+                InjectConditionalData ic_data = InjectFunctionPre(*candidate->function, position.block_it, position.inst_it);
+                ic_data.function_result_id = CreateFunctionCall(current_block, nullptr, meta);
+                InjectFunctionPost(current_block, ic_data);
+            }
+        }
+        return instrumentations_count_ != 0;
+    }
+
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (Function& function : module_.functions_) {
         if (!function.called_from_target_) {
@@ -26,6 +26,9 @@ class MeshShading : public Pass {
     MeshShading(Module& module);
     const char* Name() const final { return "MeshShading"; }
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final {
+        return summary.HasOpcode(spv::OpSetMeshOutputsEXT) || summary.has_task_payload_access;
+    }
     void PrintDebugInfo() const final;
 
   private:
@@ -70,7 +70,7 @@ Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const
         }
 
         const uint32_t position_offset = static_cast<uint32_t>(it - words.begin());
-        auto new_inst = std::make_unique<Instruction>(it, position_offset);
+        auto new_inst = NewInstruction(it, position_offset);
 
         switch (opcode) {
             case spv::OpCapability:
@@ -260,7 +260,7 @@ Module::Module(vvl::span<const uint32_t> words, DebugReport* debug_report, const
         const uint32_t opcode = *it & 0x0ffffu;
         const uint32_t length = *it >> 16;
         const uint32_t position_offset = static_cast<uint32_t>(it - words.begin());
-        auto new_inst = std::make_unique<Instruction>(it, position_offset);
+        auto new_inst = NewInstruction(it, position_offset);
 
         const uint32_t result_id = new_inst->ResultId();
         if (opcode == spv::OpFunction) {
@@ -396,7 +396,7 @@ static void StringToSpirv(const char* input, std::vector<uint32_t>& output) {
 // Will only add if not already added
 void Module::AddCapability(spv::Capability capability) {
     if (!HasCapability(capability)) {
-        auto new_inst = std::make_unique<Instruction>(2, spv::OpCapability);
+        auto new_inst = NewInstruction(2, spv::OpCapability);
         new_inst->Fill({(uint32_t)capability});
         capabilities_.emplace_back(std::move(new_inst));
     }
@@ -415,7 +415,7 @@ void Module::RemoveCapability(spv::Capability capability) {
 void Module::AddExtension(const char* extension) {
     std::vector<uint32_t> words;
     StringToSpirv(extension, words);
-    auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), spv::OpExtension);
+    auto new_inst = NewInstruction((uint32_t)(words.size() + 1), spv::OpExtension);
     new_inst->Fill(words);
     extensions_.emplace_back(std::move(new_inst));
 }
@@ -423,13 +423,13 @@ void Module::AddExtension(const char* extension) {
 void Module::AddDebugName(const char* name, uint32_t id) {
     std::vector<uint32_t> words = {id};
     StringToSpirv(name, words);
-    auto new_inst = std::make_unique<Instruction>((uint32_t)(words.size() + 1), spv::OpName);
+    auto new_inst = NewInstruction((uint32_t)(words.size() + 1), spv::OpName);
     new_inst->Fill(words);
     debug_name_.emplace_back(std::move(new_inst));
 }
 
 void Module::AddDecoration(uint32_t target_id, spv::Decoration decoration, const std::vector<uint32_t>& operands) {
-    auto new_inst = std::make_unique<Instruction>((uint32_t)(operands.size() + 3), spv::OpDecorate);
+    auto new_inst = NewInstruction((uint32_t)(operands.size() + 3), spv::OpDecorate);
     new_inst->Fill({target_id, (uint32_t)decoration});
     if (!operands.empty()) {
         new_inst->Fill(operands);
@@ -439,7 +439,7 @@ void Module::AddDecoration(uint32_t target_id, spv::Decoration decoration, const
 
 void Module::AddMemberDecoration(uint32_t target_id, uint32_t index, spv::Decoration decoration,
                                  const std::vector<uint32_t>& operands) {
-    auto new_inst = std::make_unique<Instruction>((uint32_t)(operands.size() + 4), spv::OpMemberDecorate);
+    auto new_inst = NewInstruction((uint32_t)(operands.size() + 4), spv::OpMemberDecorate);
     new_inst->Fill({target_id, index, (uint32_t)decoration});
     if (!operands.empty()) {
         new_inst->Fill(operands);
@@ -459,7 +459,7 @@ const Variable& Module::GetBuiltInVariable(uint32_t built_in) {
 
     if (variable_id == 0) {
         variable_id = TakeNextId();
-        auto new_inst = std::make_unique<Instruction>(4, spv::OpDecorate);
+        auto new_inst = NewInstruction(4, spv::OpDecorate);
         new_inst->Fill({variable_id, spv::DecorationBuiltIn, built_in});
         annotations_.emplace_back(std::move(new_inst));
     }
@@ -469,7 +469,7 @@ const Variable& Module::GetBuiltInVariable(uint32_t built_in) {
     const Variable* built_in_variable = type_manager_.FindVariableById(variable_id);
     if (!built_in_variable) {
         const Type& pointer_type = type_manager_.GetTypePointerBuiltInInput(spv::BuiltIn(built_in));
-        auto new_inst = std::make_unique<Instruction>(4, spv::OpVariable);
+        auto new_inst = NewInstruction(4, spv::OpVariable);
         new_inst->Fill({pointer_type.Id(), variable_id, spv::StorageClassInput});
         built_in_variable = &type_manager_.AddVariable(std::move(new_inst), pointer_type);
         AddInterfaceVariables(built_in_variable->Id(), spv::StorageClassInput);
@@ -620,7 +620,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
             break;
         }
 
-        auto new_inst = std::make_unique<Instruction>(inst_word, kLinkedInstruction);
+        auto new_inst = NewInstruction(inst_word, kLinkedInstruction);
         uint32_t old_result_id = new_inst->ResultId();
 
         SpvType spv_type = GetSpvType(opcode);
@@ -757,7 +757,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
                 } else if (value == glsl::kDescriptorHashingCapacity) {
                     new_op_constant[3] = settings_.descriptor_hashing_total_descriptors;
                 }
-                new_inst.reset(new Instruction(new_op_constant, kLinkedInstruction));
+                new_inst = NewInstruction(new_op_constant, kLinkedInstruction);
             } else if (opcode == spv::OpSpecConstantOp) {
                 // Apply the SpecConstantOp and generate a new OpCostant
                 uint32_t new_op_constant[4];
@@ -772,7 +772,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
                 } else {
                     assert(false);  // Missing support
                 }
-                new_inst.reset(new Instruction(new_op_constant, kLinkedInstruction));
+                new_inst = NewInstruction(new_op_constant, kLinkedInstruction);
             }
 
             const Type& type = *type_manager_.FindTypeById(id_swap_map[new_inst->TypeId()]);
@@ -910,7 +910,7 @@ void Module::LinkFunctions(const LinkInfo& info) {
         offset = link_function.offline.offset;
         while (offset < info.module.word_count) {
             const uint32_t* inst_word = &info.module.words[offset];
-            auto new_inst = std::make_unique<Instruction>(inst_word, kLinkedInstruction);
+            auto new_inst = NewInstruction(inst_word, kLinkedInstruction);
             const uint32_t opcode = new_inst->Opcode();
             const uint32_t length = new_inst->Length();
 
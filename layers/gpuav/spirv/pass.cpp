@@ -15,8 +15,10 @@
 
 #include "pass.h"
 #include <vulkan/vulkan_core.h>
+#include <algorithm>
 #include <cstdint>
 #include <spirv/unified1/spirv.hpp>
+#include "access_path.h"
 #include "cooperative_matrix.h"
 #include "function_basic_block.h"
 #include "generated/spirv_grammar_helper.h"
@@ -48,6 +50,70 @@ bool Pass::Run() {
     return modified;
 }
 
+bool ModuleSummary::HasAnyOpcode(std::initializer_list<spv::Op> opcode_list) const {
+    return std::any_of(opcode_list.begin(), opcode_list.end(), [this](spv::Op opcode) { return HasOpcode(opcode); });
+}
+
+BasicBlockIt ModuleSummary::FindBlock(const Candidate& candidate) const {
+    auto it = moved.find(candidate.inst);
+    return it != moved.end() ? it->second : candidate.block_it;
+}
+
+PassManager::PassManager(Module& module, bool enabled) : module_(module), enabled_(enabled) {
+    if (!enabled_) {
+        return;
+    }
+    uint32_t order = 0;
+    for (Function& function : module_.functions_) {
+        if (!function.called_from_target_) {
+            continue;
+        }
+        for (auto block_it = function.blocks_.begin(); block_it != function.blocks_.end(); ++block_it) {
+            for (const auto& inst : (*block_it)->instructions_) {
+                summary_.candidates[inst->Opcode()].emplace_back(Candidate{&function, block_it, inst.get(), order++});
+
+                // Fills the cache every pass looking at memory accesses reads from
+                const AccessPath* access_path = module_.GetAccessPath(function, *inst);
+                if (!access_path) {
+                    continue;
+                }
+                summary_.has_descriptor_access |= access_path->IsValidDescriptor();
+                summary_.has_bda_access |= access_path->IsValidBda();
+                summary_.has_task_payload_access |= access_path->IsValid(spv::StorageClassTaskPayloadWorkgroupEXT);
+            }
+        }
+    }
+}
+
+bool PassManager::Run(Pass& pass) {
+    if (!enabled_) {
+        return pass.Run();
+    }
+    if (!pass.HasCandidates(summary_)) {
+        if (module_.settings_.print_debug_info) {
+            pass.PrintDebugInfo();
+        }
+        return false;
+    }
+    pass.summary_ = &summary_;
+    return pass.Run();
+}
+
+void Pass::FindCandidate(const Candidate& candidate, CandidatePosition& position) const {
+    const BasicBlockIt block_it = summary_->FindBlock(candidate);
+    auto& block_instructions = (*block_it)->instructions_;
+    if (!position.found || position.block_it->get() != block_it->get()) {
+        position.block_it = block_it;
+        position.inst_it = block_instructions.begin();
+    }
+    auto is_candidate = [&candidate](const InstructionPtr& inst) { return inst.get() == candidate.inst; };
+    position.inst_it = std::find_if(position.inst_it, block_instructions.end(), is_candidate);
+    position.found = position.inst_it != block_instructions.end();
+    if (!position.found) {
+        module_.InternalError(Name(), "failed to find candidate instruction");
+    }
+}
+
 // Special function to map to the internal representation of the execution models used for GenerateStageMessage()
 static uint32_t GetNormalizedExecutionModel(VkShaderStageFlagBits shader_stage) {
     switch (shader_stage) {
@@ -813,6 +879,9 @@ InjectConditionalData Pass::InjectFunctionPre(Function& function, const BasicBlo
     const Instruction& target_inst = *valid_block.instructions_.emplace_back(std::move(*inst_it));
     inst_it = original_block.instructions_.erase(inst_it);
     valid_block.CreateInstruction(spv::OpBranch, {merge_block_label});
+    if (summary_) {
+        summary_->moved[&target_inst] = valid_block_it;
+    }
 
     // If thre is a result, we need to create an additional BasicBlock to hold the |else| case, then after we create a Phi node to
     // hold the result
@@ -872,6 +941,11 @@ InjectConditionalData Pass::InjectFunctionPre(Function& function, const BasicBlo
     invalid_block.CreateInstruction(spv::OpBranch, {merge_block_label});
 
     // move all remaining instructions to the newly created merge block
+    if (summary_) {
+        for (auto it = inst_it; it != original_block.instructions_.end(); ++it) {
+            summary_->moved[it->get()] = merge_block_it;
+        }
+    }
     merge_block.instructions_.insert(merge_block.instructions_.end(), std::make_move_iterator(inst_it),
                                      std::make_move_iterator(original_block.instructions_.end()));
     original_block.instructions_.erase(inst_it, original_block.instructions_.end());
@@ -15,7 +15,12 @@
 #pragma once
 
 #include <stdint.h>
+#include <algorithm>
 #include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+#include <vector>
 #include <spirv/unified1/spirv.hpp>
 #include "cooperative_matrix.h"
 #include "function_basic_block.h"
@@ -46,6 +51,62 @@ struct InjectConditionalData {
 // If the pass has no linking and it is all done inplace at instrumentation time
 [[maybe_unused]] static const OfflineModule kNullOffline{nullptr, 0};
 
+// An instruction found by the PassManager walk
+struct Candidate {
+    Function* function;
+    // The block it was found in, only InjectFunctionPre moves instructions to another block (see ModuleSummary::FindBlock)
+    BasicBlockIt block_it;
+    const Instruction* inst;
+    uint32_t order;  // position in the walk, to merge the lists of several opcodes back in program order
+};
+
+// What the functions called from the target entry point contain, gathered in a single walk before any pass runs.
+// Most shaders only have a few of the things the passes look for, a pass with no candidate at all is skipped, and a pass looking
+// for a few opcodes goes through their candidates instead of walking every function and block just to find them.
+struct ModuleSummary {
+    // The instructions of each opcode, in program order
+    vvl::unordered_map<uint32_t, std::vector<Candidate>> candidates;
+    // From the AccessPath of the memory accesses
+    bool has_descriptor_access = false;
+    bool has_bda_access = false;
+    bool has_task_payload_access = false;
+
+    // Instructions InjectFunctionPre moved out of the block they were found in
+    vvl::unordered_map<const Instruction*, BasicBlockIt> moved;
+
+    bool HasOpcode(spv::Op opcode) const { return candidates.find(opcode) != candidates.end(); }
+    bool HasAnyOpcode(std::initializer_list<spv::Op> opcode_list) const;
+    template <typename Range>
+    bool HasAnyOpcode(const Range& opcodes) const {
+        return std::any_of(std::begin(opcodes), std::end(opcodes), [this](spv::Op opcode) { return HasOpcode(opcode); });
+    }
+
+    // The candidates of every opcode |predicate| accepts, in program order
+    template <typename Predicate>
+    std::vector<const Candidate*> GetCandidates(Predicate&& predicate) const {
+        std::vector<const Candidate*> result;
+        for (const auto& [opcode, opcode_candidates] : candidates) {
+            if (predicate(spv::Op(opcode))) {
+                for (const Candidate& candidate : opcode_candidates) {
+                    result.emplace_back(&candidate);
+                }
+            }
+        }
+        std::sort(result.begin(), result.end(), [](const Candidate* a, const Candidate* b) { return a->order < b->order; });
+        return result;
+    }
+
+    // The block the candidate is in now, an earlier pass might have split the block it was found in
+    BasicBlockIt FindBlock(const Candidate& candidate) const;
+};
+
+// Where a pass going through the candidates is, see Pass::FindCandidate()
+struct CandidatePosition {
+    BasicBlockIt block_it;
+    InstructionIt inst_it;
+    bool found = false;
+};
+
 // Common helpers for all passes
 // The pass takes the Module object and modifies it as needed
 class Pass {
@@ -60,6 +121,9 @@ class Pass {
     virtual void PostProcess() {};
     // Requiring because this becomes important/helpful while debugging
     virtual void PrintDebugInfo() const = 0;
+    // Return false if there is nothing the pass could instrument in the module. Only an early out, a pass returning true can still
+    // find nothing to instrument.
+    virtual bool HasCandidates(const ModuleSummary&) const { return true; }
     // Wrapper that each pass can use to start
     bool Run();
 
@@ -107,11 +171,43 @@ class Pass {
     LinkInfo link_info_;
     uint32_t GetLinkFunction(uint32_t& link_function_id, const OfflineFunction& offline);
 
+    // Set while the pass is run by a PassManager, the passes that can go through the candidates instead of walking every block
+    // still walk without it
+    ModuleSummary* summary_ = nullptr;
+    friend class PassManager;
+
+    // For passes going through candidates in program order, sets |position| to where |candidate| is now.
+    // If it is in the same block as the previous candidate, the search starts from there (the pass keeps |position.inst_it| valid
+    // the same way it does when walking the block), so going through all the candidates of a block is a single pass over it.
+    void FindCandidate(const Candidate& candidate, CandidatePosition& position) const;
+
     // Currently a just used to quickly see GPU runtime diff if the entire loop is not instrumented
     // (Still deciding how to properly handle slow loops, but need examine more traces)
     const bool debug_disable_loops_ = false;
 };
 
+// Runs the passes, in order, over a Module.
+// The order matters as the checks of a pass are guarded by the if/else injected by the passes before it, so each pass still does
+// its own rewrite. What is shared is the analysis, the ModuleSummary is built once when the manager is created and the AccessPath
+// of every memory access is cached in the Module for all the passes.
+// When |enabled| is false there is no analysis, each pass is run on its own and walks the whole module (used to compare the output)
+class PassManager {
+  public:
+    PassManager(Module& module, bool enabled);
+
+    template <typename PassType, typename... Args>
+    bool Run(Args&&... args) {
+        PassType pass(module_, std::forward<Args>(args)...);
+        return Run(pass);
+    }
+    bool Run(Pass& pass);
+
+  private:
+    Module& module_;
+    const bool enabled_;
+    ModuleSummary summary_;
+};
+
 // Push Constants can be used to determine the index into descriptor arrays (Example: https://godbolt.org/z/jTEaaExov)
 // From examining many large shaders, the same access is made, but generated as a different OpLoad.
 // spirv-opt is not going to remove the duplicate loads because it is designed to allow the compiler to decide how long
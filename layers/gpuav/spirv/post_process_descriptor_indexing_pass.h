@@ -29,6 +29,7 @@ class PostProcessDescriptorIndexingPass : public Pass {
     const char* Name() const final { return "PostProcessDescriptorIndexingPass"; }
 
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.has_descriptor_access; }
     void PrintDebugInfo() const final;
 
   private:
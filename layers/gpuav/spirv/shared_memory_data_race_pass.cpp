@@ -418,7 +418,7 @@ void SharedMemoryDataRacePass::PostProcess() {
     const Type& uint32_arr_type = type_manager_.GetTypeArray(uint32_type, array_size);
     const Type& uint32_arr_ptr_type = type_manager_.GetTypePointer(spv::StorageClassWorkgroup, uint32_arr_type);
 
-    auto shadow_var = std::make_unique<Instruction>(4, spv::OpVariable);
+    auto shadow_var = module_.NewInstruction(4, spv::OpVariable);
     shadow_var->Fill({uint32_arr_ptr_type.Id(), module_.shared_memory_shadow_variable_id_, spv::StorageClassWorkgroup});
     type_manager_.AddVariable(std::move(shadow_var), uint32_arr_ptr_type);
 }
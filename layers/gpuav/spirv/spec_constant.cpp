@@ -275,7 +275,7 @@ bool Module::ConstantFoldVectorShuffle(Instruction* inst, const Type& result_typ
         }
     }
 
-    auto new_inst = std::make_unique<Instruction>(1 + (uint32_t)words.size(), spv::OpConstantComposite);
+    auto new_inst = NewInstruction(1 + (uint32_t)words.size(), spv::OpConstantComposite);
     new_inst->Fill(words);
     type_manager_.AddConstant(std::move(new_inst), result_type);
     return true;
@@ -291,7 +291,7 @@ bool Module::ConstantFoldCompositeExtract(Instruction* inst, const Type& result_
             assert(false);
             return false;
         } else if (composite->inst_.Opcode() == spv::OpConstantNull) {
-            auto new_inst = std::make_unique<Instruction>(3, spv::OpConstantNull);
+            auto new_inst = NewInstruction(3, spv::OpConstantNull);
             new_inst->Fill({result_type.Id(), inst->ResultId()});
             type_manager_.AddConstant(std::move(new_inst), result_type);
             return true;
@@ -315,7 +315,7 @@ bool Module::ConstantFoldCompositeExtract(Instruction* inst, const Type& result_
     words[0] = result_type.Id();
     words[1] = inst->ResultId();
 
-    auto new_inst = std::make_unique<Instruction>(1 + (uint32_t)words.size(), (spv::Op)final_composite->inst_.Opcode());
+    auto new_inst = NewInstruction(1 + (uint32_t)words.size(), (spv::Op)final_composite->inst_.Opcode());
     new_inst->Fill(words);
     type_manager_.AddConstant(std::move(new_inst), result_type);
     return true;
@@ -351,7 +351,7 @@ bool Module::ConstantFoldCompositeInsert(Instruction* inst, const Type& result_t
         }
     }
 
-    auto new_inst = std::make_unique<Instruction>(1 + (uint32_t)words.size(), spv::OpConstantComposite);
+    auto new_inst = NewInstruction(1 + (uint32_t)words.size(), spv::OpConstantComposite);
     new_inst->Fill(words);
     type_manager_.AddConstant(std::move(new_inst), result_type);
     return true;
@@ -492,7 +492,7 @@ bool Module::ConstantFold(Instruction* inst, const Type& result_type) {
             new_composite_components.emplace_back(scalar_id);
         } else if (scalar_type.spv_type_ == SpvType::kBool) {
             const spv::Op new_opcode = (lane_result == 0) ? spv::OpConstantFalse : spv::OpConstantTrue;
-            auto new_inst = std::make_unique<Instruction>(3, new_opcode);
+            auto new_inst = NewInstruction(3, new_opcode);
             new_inst->Fill({scalar_type.Id(), inst->ResultId()});
             type_manager_.AddConstant(std::move(new_inst), scalar_type);
             return true;
@@ -503,7 +503,7 @@ bool Module::ConstantFold(Instruction* inst, const Type& result_type) {
     }
 
     assert(is_vector);
-    auto new_inst = std::make_unique<Instruction>(3 + new_composite_components.size(), spv::OpConstantComposite);
+    auto new_inst = NewInstruction(3 + new_composite_components.size(), spv::OpConstantComposite);
     std::vector<uint32_t> words = {result_type.Id(), inst->ResultId()};
     words.insert(words.end(), new_composite_components.begin(), new_composite_components.end());
     new_inst->Fill(words);
@@ -234,7 +234,93 @@ uint32_t TraceRayPass::AddFunctionCall(BasicBlock& block, std::vector<uint32_t>&
     return function_result;
 }
 
+// Returns true if the block was split, the instructions after |inst_it| are then in the new merge block
+bool TraceRayPass::InstrumentInstruction(Function& function, BasicBlockIt block_it, InstructionIt& inst_it) {
+    BasicBlock& current_block = **block_it;
+    const spv::Op opcode = spv::Op(inst_it->get()->Opcode());
+
+    std::vector<std::vector<uint32_t>> func_calls;
+    auto add_func_call = [&](std::vector<uint32_t>&& func_call) {
+        if (!func_call.empty()) {
+            func_calls.emplace_back(std::move(func_call));
+        }
+    };
+    switch (opcode) {
+        case spv::OpRayQueryInitializeKHR: {
+            add_func_call(GetTlasValidationFunctionCallInstructions(function, 1, glsl::kErrorSubCode_RayQuery_TlasNotBuilt,
+                                                                    current_block, &inst_it));
+            add_func_call(GetRayQueryInitializeValidationFunctionCallInstructions(&inst_it));
+            break;
+        }
+        case spv::OpTraceRayKHR: {
+            add_func_call(GetTraceRayValidationFunctionCallInstructions(&inst_it));
+            add_func_call(GetTlasValidationFunctionCallInstructions(function, 0, glsl::kErrorSubCode_TraceRay_TlasNotBuilt,
+                                                                    current_block, &inst_it));
+            break;
+        }
+        case spv::OpHitObjectSetShaderBindingTableRecordIndexEXT: {
+            add_func_call(GetRayHitObjectSbtIndexValidationFunctionCallInstructions(&inst_it));
+            break;
+        }
+        case spv::OpHitObjectTraceRayEXT:
+        case spv::OpHitObjectTraceReorderExecuteEXT:
+        case spv::OpHitObjectTraceRayMotionEXT:
+        case spv::OpHitObjectTraceMotionReorderExecuteEXT: {
+            add_func_call(GetRayHitObjectValidationFunctionCallInstructions(&inst_it));
+            break;
+        }
+        case spv::OpReportIntersectionKHR: {
+            add_func_call(GetReportIntersectionValidationFunctionCallInstructions(&inst_it));
+            break;
+        }
+        default:
+            break;
+    }
+
+    if (func_calls.empty()) {
+        return false;
+    }
+
+    ++instrumentations_count_;
+
+    if (!module_.settings_.safe_mode) {
+        for (auto& func_call : func_calls) {
+            AddFunctionCall(current_block, std::move(func_call), &inst_it);
+        }
+        return false;
+    }
+
+    InjectConditionalData ic_data = InjectFunctionPre(function, block_it, inst_it);
+    uint32_t combined_func_results_id = AddFunctionCall(current_block, std::move(func_calls[0]), nullptr);
+    for (size_t i = 1; i < func_calls.size(); ++i) {
+        const uint32_t next_func_result_id = AddFunctionCall(current_block, std::move(func_calls[i]), nullptr);
+        const uint32_t next_combined_func_results_id = module_.TakeNextId();
+        current_block.CreateInstruction(spv::OpLogicalAnd, {type_manager_.GetTypeBool().Id(), next_combined_func_results_id,
+                                                            combined_func_results_id, next_func_result_id});
+        combined_func_results_id = next_combined_func_results_id;
+    }
+    ic_data.function_result_id = combined_func_results_id;
+    InjectFunctionPost(current_block, ic_data);
+    return true;
+}
+
 bool TraceRayPass::Instrument() {
+    if (summary_) {
+        CandidatePosition position;
+        auto is_target = [](spv::Op opcode) { return IsValueIn(opcode, kTargetOpcodes); };
+        for (const Candidate* candidate : summary_->GetCandidates(is_target)) {
+            if (MaxInstrumentationsCountReached()) {
+                return instrumentations_count_ != 0;
+            }
+            FindCandidate(*candidate, position);
+            if (!position.found || (*position.block_it)->IsLoopHeader()) {
+                continue;  // Currently can't properly handle injecting CFG logic into a loop header block
+            }
+            InstrumentInstruction(*candidate->function, position.block_it, position.inst_it);
+        }
+        return instrumentations_count_ != 0;
+    }
+
     // Can safely loop function list as there is no injecting of new Functions until linking time
     for (Function& function : module_.functions_) {
         if (!function.called_from_target_) {
@@ -258,69 +344,7 @@ bool TraceRayPass::Instrument() {
                     return instrumentations_count_ != 0;
                 }
 
-                const spv::Op opcode = spv::Op(inst_it->get()->Opcode());
-
-                std::vector<std::vector<uint32_t>> func_calls;
-                auto add_func_call = [&](std::vector<uint32_t>&& func_call) {
-                    if (!func_call.empty()) {
-                        func_calls.emplace_back(std::move(func_call));
-                    }
-                };
-                switch (opcode) {
-                    case spv::OpRayQueryInitializeKHR: {
-                        add_func_call(GetTlasValidationFunctionCallInstructions(
-                            function, 1, glsl::kErrorSubCode_RayQuery_TlasNotBuilt, current_block, &inst_it));
-                        add_func_call(GetRayQueryInitializeValidationFunctionCallInstructions(&inst_it));
-                        break;
-                    }
-                    case spv::OpTraceRayKHR: {
-                        add_func_call(GetTraceRayValidationFunctionCallInstructions(&inst_it));
-                        add_func_call(GetTlasValidationFunctionCallInstructions(
-                            function, 0, glsl::kErrorSubCode_TraceRay_TlasNotBuilt, current_block, &inst_it));
-                        break;
-                    }
-                    case spv::OpHitObjectSetShaderBindingTableRecordIndexEXT: {
-                        add_func_call(GetRayHitObjectSbtIndexValidationFunctionCallInstructions(&inst_it));
-                        break;
-                    }
-                    case spv::OpHitObjectTraceRayEXT:
-                    case spv::OpHitObjectTraceReorderExecuteEXT:
-                    case spv::OpHitObjectTraceRayMotionEXT:
-                    case spv::OpHitObjectTraceMotionReorderExecuteEXT: {
-                        add_func_call(GetRayHitObjectValidationFunctionCallInstructions(&inst_it));
-                        break;
-                    }
-                    case spv::OpReportIntersectionKHR: {
-                        add_func_call(GetReportIntersectionValidationFunctionCallInstructions(&inst_it));
-                        break;
-                    }
-                    default:
-                        break;
-                }
-
-                if (func_calls.empty()) {
-                    continue;
-                }
-
-                ++instrumentations_count_;
-
-                if (!module_.settings_.safe_mode) {
-                    for (auto& func_call : func_calls) {
-                        AddFunctionCall(current_block, std::move(func_call), &inst_it);
-                    }
-                } else {
-                    InjectConditionalData ic_data = InjectFunctionPre(function, block_it, inst_it);
-                    uint32_t combined_func_results_id = AddFunctionCall(current_block, std::move(func_calls[0]), nullptr);
-                    for (size_t i = 1; i < func_calls.size(); ++i) {
-                        const uint32_t next_func_result_id = AddFunctionCall(current_block, std::move(func_calls[i]), nullptr);
-                        const uint32_t next_combined_func_results_id = module_.TakeNextId();
-                        current_block.CreateInstruction(spv::OpLogicalAnd,
-                                                        {type_manager_.GetTypeBool().Id(), next_combined_func_results_id,
-                                                         combined_func_results_id, next_func_result_id});
-                        combined_func_results_id = next_combined_func_results_id;
-                    }
-                    ic_data.function_result_id = combined_func_results_id;
-                    InjectFunctionPost(current_block, ic_data);
+                if (InstrumentInstruction(function, block_it, inst_it)) {
                     // Skip the newly added valid and invalid block. Start searching again from newly split merge block
                     ++block_it;
                     ++block_it;
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <array>
 #include <vector>
 #include "pass.h"
 
@@ -27,9 +28,20 @@ class TraceRayPass : public Pass {
     TraceRayPass(Module& module);
     const char* Name() const final { return "TraceRayPass"; }
     bool Instrument() final;
+    bool HasCandidates(const ModuleSummary& summary) const final { return summary.HasAnyOpcode(kTargetOpcodes); }
     void PrintDebugInfo() const final;
 
   private:
+    static constexpr std::array<spv::Op, 8> kTargetOpcodes = {spv::OpRayQueryInitializeKHR,
+                                                              spv::OpTraceRayKHR,
+                                                              spv::OpHitObjectSetShaderBindingTableRecordIndexEXT,
+                                                              spv::OpHitObjectTraceRayEXT,
+                                                              spv::OpHitObjectTraceReorderExecuteEXT,
+                                                              spv::OpHitObjectTraceRayMotionEXT,
+                                                              spv::OpHitObjectTraceMotionReorderExecuteEXT,
+                                                              spv::OpReportIntersectionKHR};
+
+    bool InstrumentInstruction(Function& function, BasicBlockIt block_it, InstructionIt& inst_it);
     std::vector<uint32_t> GetTlasValidationFunctionCallInstructions(const Function& function, uint32_t tlas_operand_pos,
                                                                     uint32_t error_sub_code, BasicBlock& block,
                                                                     InstructionIt* trace_ray_inst_it);
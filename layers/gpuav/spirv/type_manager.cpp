@@ -80,7 +80,7 @@ const Type* Variable::PointerType(const TypeManager& type_manager_) const {
     return type_manager_.FindTypeById(type_id);
 }
 
-const Type& TypeManager::AddType(std::unique_ptr<Instruction> new_inst, SpvType spv_type) {
+const Type& TypeManager::AddType(InstructionPtr new_inst, SpvType spv_type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
     id_to_type_[inst->ResultId()] = std::make_unique<Type>(spv_type, *inst, *this);
@@ -239,7 +239,7 @@ const Type& TypeManager::GetTypeVoid() {
     };
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeVoid);
+    auto new_inst = module_.NewInstruction(2, spv::OpTypeVoid);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kVoid);
 }
@@ -250,7 +250,7 @@ const Type& TypeManager::GetTypeBool() {
     };
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeBool);
+    auto new_inst = module_.NewInstruction(2, spv::OpTypeBool);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kBool);
 }
@@ -261,7 +261,7 @@ const Type& TypeManager::GetTypeSampler() {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeSampler);
+    auto new_inst = module_.NewInstruction(2, spv::OpTypeSampler);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kSampler);
 }
@@ -272,7 +272,7 @@ const Type& TypeManager::GetTypeRayQuery() {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeRayQueryKHR);
+    auto new_inst = module_.NewInstruction(2, spv::OpTypeRayQueryKHR);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kRayQueryKHR);
 }
@@ -283,7 +283,7 @@ const Type& TypeManager::GetTypeAccelerationStructure() {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(2, spv::OpTypeAccelerationStructureKHR);
+    auto new_inst = module_.NewInstruction(2, spv::OpTypeAccelerationStructureKHR);
     new_inst->Fill({type_id});
     return AddType(std::move(new_inst), SpvType::kAccelerationStructureKHR);
 }
@@ -297,7 +297,7 @@ const Type& TypeManager::GetTypeInt(uint32_t bit_width, bool is_signed) {
 
     const uint32_t type_id = module_.TakeNextId();
     const uint32_t signed_word = is_signed ? 1 : 0;
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeInt);
+    auto new_inst = module_.NewInstruction(4, spv::OpTypeInt);
     new_inst->Fill({type_id, bit_width, signed_word});
     return AddType(std::move(new_inst), SpvType::kInt);
 }
@@ -310,7 +310,7 @@ const Type& TypeManager::GetTypeFloat(uint32_t bit_width) {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpTypeFloat);
+    auto new_inst = module_.NewInstruction(3, spv::OpTypeFloat);
     new_inst->Fill({type_id, bit_width});
     return AddType(std::move(new_inst), SpvType::kFloat);
 }
@@ -328,7 +328,7 @@ const Type& TypeManager::GetTypeArray(const Type& element_type, const Constant&
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeArray);
+    auto new_inst = module_.NewInstruction(4, spv::OpTypeArray);
     new_inst->Fill({type_id, element_type.Id(), length.Id()});
     return AddType(std::move(new_inst), SpvType::kArray);
 }
@@ -344,7 +344,7 @@ const Type& TypeManager::GetTypeRuntimeArray(const Type& element_type, bool get_
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpTypeRuntimeArray);
+    auto new_inst = module_.NewInstruction(3, spv::OpTypeRuntimeArray);
     new_inst->Fill({type_id, element_type.Id()});
     return AddType(std::move(new_inst), SpvType::kRuntimeArray);
 }
@@ -362,7 +362,7 @@ const Type& TypeManager::GetTypeVector(const Type& component_type, uint32_t comp
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeVector);
+    auto new_inst = module_.NewInstruction(4, spv::OpTypeVector);
     new_inst->Fill({type_id, component_type.Id(), component_count});
     return AddType(std::move(new_inst), SpvType::kVector);
 }
@@ -380,7 +380,7 @@ const Type& TypeManager::GetTypeMatrix(const Type& column_type, uint32_t column_
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypeMatrix);
+    auto new_inst = module_.NewInstruction(4, spv::OpTypeMatrix);
     new_inst->Fill({type_id, column_type.Id(), column_count});
     return AddType(std::move(new_inst), SpvType::kMatrix);
 }
@@ -394,7 +394,7 @@ const Type& TypeManager::GetTypeSampledImage(const Type& image_type) {
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpTypeSampledImage);
+    auto new_inst = module_.NewInstruction(3, spv::OpTypeSampledImage);
     new_inst->Fill({type_id, image_type.Id()});
     return AddType(std::move(new_inst), SpvType::kSampledImage);
 }
@@ -414,7 +414,7 @@ const Type& TypeManager::GetTypePointer(spv::StorageClass storage_class, const T
     }
 
     const uint32_t type_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpTypePointer);
+    auto new_inst = module_.NewInstruction(4, spv::OpTypePointer);
     new_inst->Fill({type_id, uint32_t(storage_class), pointer_type.Id()});
     return AddType(std::move(new_inst), SpvType::kPointer);
 }
@@ -526,7 +526,7 @@ uint32_t TypeManager::GetTypeBytesSize(const Type& type) {
     return 0;
 }
 
-const Constant& TypeManager::AddConstant(std::unique_ptr<Instruction> new_inst, const Type& type) {
+const Constant& TypeManager::AddConstant(InstructionPtr new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
     id_to_constant_[inst->ResultId()] = std::make_unique<Constant>(type, *inst);
@@ -588,7 +588,7 @@ const Constant* TypeManager::FindConstantById(uint32_t id) const {
 const Constant& TypeManager::CreateConstantUInt32(uint32_t value) {
     const Type& type = GetTypeInt(32, 0);
     const uint32_t constant_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(4, spv::OpConstant);
+    auto new_inst = module_.NewInstruction(4, spv::OpConstant);
     new_inst->Fill({type.Id(), constant_id, value});
     return AddConstant(std::move(new_inst), type);
 }
@@ -597,7 +597,7 @@ const Constant& TypeManager::CreateConstantUInt32(uint32_t value) {
 const Constant& TypeManager::CreateConstantScalar(uint64_t value, const Type& type, uint32_t result_id) {
     const bool is_64bit = type.Is64Bit();
 
-    auto new_inst = std::make_unique<Instruction>(is_64bit ? 5 : 4, spv::OpConstant);
+    auto new_inst = module_.NewInstruction(is_64bit ? 5 : 4, spv::OpConstant);
 
     if (result_id == 0) {
         result_id = module_.TakeNextId();
@@ -637,7 +637,7 @@ const Constant& TypeManager::GetConstantBool(bool is_true) {
     if (is_true) {
         if (!bool_true_constants_) {
             const uint32_t constant_id = module_.TakeNextId();
-            auto new_inst = std::make_unique<Instruction>(3, spv::OpConstantTrue);
+            auto new_inst = module_.NewInstruction(3, spv::OpConstantTrue);
             new_inst->Fill({bool_type.Id(), constant_id});
             AddConstant(std::move(new_inst), bool_type);  // sets member var
         }
@@ -645,7 +645,7 @@ const Constant& TypeManager::GetConstantBool(bool is_true) {
     } else {
         if (!bool_false_constants_) {
             const uint32_t constant_id = module_.TakeNextId();
-            auto new_inst = std::make_unique<Instruction>(3, spv::OpConstantFalse);
+            auto new_inst = module_.NewInstruction(3, spv::OpConstantFalse);
             new_inst->Fill({bool_type.Id(), constant_id});
             AddConstant(std::move(new_inst), bool_type);  // sets member var
         }
@@ -682,7 +682,7 @@ const Constant& TypeManager::GetConstantZeroFloat16() {
         float_16bit_zero_constants_ = FindConstantFloat16(float_16_type.Id(), 0);
         if (!float_16bit_zero_constants_) {
             const uint32_t constant_id = module_.TakeNextId();
-            auto new_inst = std::make_unique<Instruction>(4, spv::OpConstant);
+            auto new_inst = module_.NewInstruction(4, spv::OpConstant);
             new_inst->Fill({float_16_type.Id(), constant_id, 0});
             float_16bit_zero_constants_ = &AddConstant(std::move(new_inst), float_16_type);
         }
@@ -697,7 +697,7 @@ const Constant& TypeManager::GetConstantZeroFloat32() {
         float_32bit_zero_constants_ = FindConstantFloat32(float_32_type.Id(), 0);
         if (!float_32bit_zero_constants_) {
             const uint32_t constant_id = module_.TakeNextId();
-            auto new_inst = std::make_unique<Instruction>(4, spv::OpConstant);
+            auto new_inst = module_.NewInstruction(4, spv::OpConstant);
             new_inst->Fill({float_32_type.Id(), constant_id, 0});
             float_32bit_zero_constants_ = &AddConstant(std::move(new_inst), float_32_type);
         }
@@ -713,7 +713,7 @@ const Constant& TypeManager::GetConstantZeroVec3() {
         const uint32_t float32_0_id = GetConstantZeroFloat32().Id();
 
         const uint32_t constant_id = module_.TakeNextId();
-        auto new_inst = std::make_unique<Instruction>(6, spv::OpConstantComposite);
+        auto new_inst = module_.NewInstruction(6, spv::OpConstantComposite);
         new_inst->Fill({vec3_type.Id(), constant_id, float32_0_id, float32_0_id, float32_0_id});
         vec3_zero_constants_ = &AddConstant(std::move(new_inst), vec3_type);
     }
@@ -728,7 +728,7 @@ const Constant& TypeManager::GetConstantZeroUvec4() {
         const uint32_t uint32_0_id = GetConstantZeroUint32().Id();
 
         const uint32_t constant_id = module_.TakeNextId();
-        auto new_inst = std::make_unique<Instruction>(7, spv::OpConstantComposite);
+        auto new_inst = module_.NewInstruction(7, spv::OpConstantComposite);
         new_inst->Fill({uvec4_type.Id(), constant_id, uint32_0_id, uint32_0_id, uint32_0_id, uint32_0_id});
         uvec4_zero_constants_ = &AddConstant(std::move(new_inst), uvec4_type);
     }
@@ -740,7 +740,7 @@ const Constant& TypeManager::GetConstantZeroVector(const Type& vector_type) {
     const Type* component_type = FindTypeById(vector_type.inst_.Word(2));
 
     const uint32_t vector_length = vector_type.VectorSize();
-    auto new_inst = std::make_unique<Instruction>(3 + vector_length, spv::OpConstantComposite);
+    auto new_inst = module_.NewInstruction(3 + vector_length, spv::OpConstantComposite);
 
     const uint32_t constant_id = module_.TakeNextId();
     std::vector<uint32_t> words = {vector_type.Id(), constant_id};
@@ -762,7 +762,7 @@ const Constant& TypeManager::GetConstantNull(const Type& type) {
     }
 
     const uint32_t constant_id = module_.TakeNextId();
-    auto new_inst = std::make_unique<Instruction>(3, spv::OpConstantNull);
+    auto new_inst = module_.NewInstruction(3, spv::OpConstantNull);
     new_inst->Fill({type.Id(), constant_id});
     return AddConstant(std::move(new_inst), type);
 }
@@ -811,7 +811,7 @@ const CooperativeMatrixAccess TypeManager::BuildCooperativeMatrixAccess(const Fu
     return info;
 }
 
-const Variable& TypeManager::AddVariable(std::unique_ptr<Instruction> new_inst, const Type& type) {
+const Variable& TypeManager::AddVariable(InstructionPtr new_inst, const Type& type) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
 
     id_to_variable_[inst->ResultId()] = std::make_unique<Variable>(module_, type, *inst);
@@ -960,7 +960,7 @@ uint64_t Constant::GetValueUint64(bool is_signed) const {
     return value;
 }
 
-void TypeManager::AddUndef(std::unique_ptr<Instruction> new_inst) {
+void TypeManager::AddUndef(InstructionPtr new_inst) {
     const auto& inst = module_.types_values_constants_.emplace_back(std::move(new_inst));
     undef_ids_.insert(inst->ResultId());
 }
@@ -170,7 +170,7 @@ class TypeManager {
   public:
     TypeManager(Module& module) : module_(module) {}
 
-    const Type& AddType(std::unique_ptr<Instruction> new_inst, SpvType spv_type);
+    const Type& AddType(InstructionPtr new_inst, SpvType spv_type);
 
     const Type* FindTypeById(uint32_t id) const;
     const Type* FindFunctionType(const Instruction& inst) const;
@@ -198,7 +198,7 @@ class TypeManager {
     void AddStructTypeForLinking(const Type* new_type);
     uint32_t FindLinkingStructType(const Instruction& inst, vvl::unordered_map<uint32_t, uint32_t>& id_swap_map) const;
 
-    const Constant& AddConstant(std::unique_ptr<Instruction> new_inst, const Type& type);
+    const Constant& AddConstant(InstructionPtr new_inst, const Type& type);
     const Constant* FindConstantById(uint32_t id) const;
     const Constant* FindConstantInt32(uint32_t type_id, uint32_t value) const;
     const Constant* FindConstantFloat16(uint32_t type_id, uint32_t value) const;
@@ -220,7 +220,7 @@ class TypeManager {
 
     const CooperativeMatrixAccess BuildCooperativeMatrixAccess(const Function& function, const Instruction& inst);
 
-    const Variable& AddVariable(std::unique_ptr<Instruction> new_inst, const Type& type);
+    const Variable& AddVariable(InstructionPtr new_inst, const Type& type);
     const Variable* FindVariableById(uint32_t id) const;
     void OverridePushConstantVariable(const Variable* new_variable);
     const Variable* FindPushConstantVariable() const;
@@ -231,7 +231,7 @@ class TypeManager {
 
     uint32_t GetScalarElementCount(const Type& type) const;
 
-    void AddUndef(std::unique_ptr<Instruction> new_inst);
+    void AddUndef(InstructionPtr new_inst);
     bool IsUndef(uint32_t id) const;
 
     void FindArrayOfPSBStructWithRuntime(vvl::unordered_set<uint32_t>& out_struct_ids);
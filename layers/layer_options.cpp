@@ -148,6 +148,17 @@ const char* VK_LAYER_DEBUG_DISABLE_SPIRV_VAL = "debug_disable_spirv_val";
 // Used both with GPU-AV and GPU Dump
 const char* VK_LAYER_DESCRIPTOR_HASHING = "descriptor_hashing";
 const char* VK_LAYER_DESCRIPTOR_HASHING_TOTAL_DESCRIPTORS = "descriptor_hashing_total_descriptors";
+// Core Checks
+const char* VK_LAYER_PARALLEL_PIPELINE_VALIDATION = "parallel_pipeline_validation";
+const char* VK_LAYER_CHECK_THROTTLE_BUDGET_NS = "check_throttle_budget_ns";
+const char* VK_LAYER_CHECK_THROTTLE_PASSES = "check_throttle_passes";
+// Chassis
+const char* VK_LAYER_PARALLEL_SUBMIT_VALIDATION = "parallel_submit_validation";
+const char* VK_LAYER_VALIDATION_SAMPLING_PERIOD = "validation_sampling_period";
+const char* VK_LAYER_VALIDATION_SAMPLING_MODE = "validation_sampling_mode";
+// Profiling
+const char* VK_LAYER_API_TIMING_FILE = "api_timing_file";
+const char* VK_LAYER_MEMORY_REPORT_FRAMES = "memory_report_frames";
 
 // DebugPrintf (which is now part of GPU-AV internally)
 // ---
@@ -158,6 +169,7 @@ const char* VK_LAYER_PRINTF_ENABLE = "printf_enable";
 const char* VK_LAYER_PRINTF_TO_STDOUT = "printf_to_stdout";
 const char* VK_LAYER_PRINTF_VERBOSE = "printf_verbose";
 const char* VK_LAYER_PRINTF_BUFFER_SIZE = "printf_buffer_size";
+const char* VK_LAYER_PRINTF_BINARY_LOG_FILE = "printf_binary_log_file";
 
 // GPU-AV
 // ---
@@ -190,6 +202,7 @@ const char* VK_LAYER_GPUAV_ACCELERATION_STRUCTURES_BUILDS = "gpuav_acceleration_
 const char* VK_LAYER_GPUAV_RAY_TRACING_BUFFERS_CONSISTENCY = "gpuav_ray_tracing_buffers_consistency";
 
 const char* VK_LAYER_GPUAV_FORCE_ON_ROBUSTNESS = "gpuav_force_on_robustness";
+const char* VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION = "gpuav_parallel_shader_instrumentation";
 
 const char* VK_LAYER_GPUAV_DEBUG_DISABLE_ALL = "gpuav_debug_disable_all";
 const char* VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS = "gpuav_debug_validate_instrumented_shaders";
@@ -197,6 +210,7 @@ const char* VK_LAYER_GPUAV_DEBUG_DUMP_INSTRUMENTED_SHADERS = "gpuav_debug_dump_i
 const char* VK_LAYER_GPUAV_DEBUG_MAX_INSTRUMENTATIONS_COUNT = "gpuav_debug_max_instrumentations_count";
 const char* VK_LAYER_GPUAV_DEBUG_PRINT_INSTRUMENTATION_INFO = "gpuav_debug_print_instrumentation_info";
 const char* VK_LAYER_GPUAV_DEBUG_DISABLE_DONTINLINE = "gpuav_debug_disable_dontinline";
+const char* VK_LAYER_GPUAV_DEBUG_DISABLE_PASS_MANAGER = "gpuav_debug_disable_pass_manager";
 
 // SyncVal
 // ---
@@ -1005,6 +1019,40 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings* settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DESCRIPTOR_HASHING, global_settings.descriptor_hashing);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_PIPELINE_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_PIPELINE_VALIDATION, global_settings.parallel_pipeline_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CHECK_THROTTLE_BUDGET_NS)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CHECK_THROTTLE_BUDGET_NS, global_settings.check_throttle_budget_ns);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_CHECK_THROTTLE_PASSES)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_CHECK_THROTTLE_PASSES, global_settings.check_throttle_passes);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PARALLEL_SUBMIT_VALIDATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PARALLEL_SUBMIT_VALIDATION, global_settings.parallel_submit_validation);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_VALIDATION_SAMPLING_PERIOD)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_VALIDATION_SAMPLING_PERIOD, global_settings.validation_sampling_period);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_VALIDATION_SAMPLING_MODE)) {
+        std::string mode;
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_VALIDATION_SAMPLING_MODE, mode);
+        global_settings.validation_sampling_frames = (mode == "FRAME");
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_API_TIMING_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_API_TIMING_FILE, global_settings.api_timing_file);
+    }
+
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_MEMORY_REPORT_FRAMES)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_MEMORY_REPORT_FRAMES, global_settings.memory_report_frames);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_DESCRIPTOR_HASHING_TOTAL_DESCRIPTORS)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_DESCRIPTOR_HASHING_TOTAL_DESCRIPTORS,
                                 global_settings.descriptor_hashing_total_descriptors);
@@ -1168,6 +1216,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings* settings_data) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_FORCE_ON_ROBUSTNESS, gpuav_settings.force_on_robustness);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_PARALLEL_SHADER_INSTRUMENTATION,
+                                gpuav_settings.parallel_shader_instrumentation);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_VALIDATE_INSTRUMENTED_SHADERS,
                                 gpuav_settings.debug_validate_instrumented_shaders);
@@ -1198,6 +1251,11 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings* settings_data) {
                                 gpuav_settings.debug_disable_dontinline);
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_GPUAV_DEBUG_DISABLE_PASS_MANAGER)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_GPUAV_DEBUG_DISABLE_PASS_MANAGER,
+                                gpuav_settings.debug_disable_pass_manager);
+    }
+
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_TO_STDOUT)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_TO_STDOUT, gpuav_settings.debug_printf_to_stdout);
     }
@@ -1224,6 +1282,10 @@ void ProcessConfigAndEnvSettings(ConfigAndEnvSettings* settings_data) {
         }
     }
 
+    if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_PRINTF_BINARY_LOG_FILE)) {
+        vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_PRINTF_BINARY_LOG_FILE, gpuav_settings.debug_printf_binary_log_file);
+    }
+
     SyncValSettings& syncval_settings = *settings_data->syncval_settings;
     if (vkuHasLayerSetting(layer_setting_set, VK_LAYER_SYNCVAL_FULL_VALIDATION)) {
         vkuGetLayerSettingValue(layer_setting_set, VK_LAYER_SYNCVAL_FULL_VALIDATION, syncval_settings.full_validation);
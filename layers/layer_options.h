@@ -104,6 +104,25 @@ struct GlobalSettings {
     // (by far the largest performance bottle neck for large shaders using spec cosntants)
     bool spirv_const_fold = true;
 
+    // Validate the create infos of a vkCreate*Pipelines call on the pipeline validation worker pool
+    bool parallel_pipeline_validation = false;
+    // Skip the image layout and descriptor set checks costing more than this on average on the objects they passed
+    // check_throttle_passes times in a row on, see core::CheckThrottle. 0 never skips them
+    uint32_t check_throttle_budget_ns = 0;
+    uint32_t check_throttle_passes = 100;
+    // Run the PreCallValidate of each validation object for vkQueueSubmit* concurrently, see DispatchDevice::ValidateInParallel
+    bool parallel_submit_validation = false;
+    // Only validate the commands of one in every validation_sampling_period command buffer recordings (or of the recordings begun
+    // in one in every validation_sampling_period frames), the state is still recorded for all of them. 0 and 1 validate everything
+    uint32_t validation_sampling_period = 0;
+    bool validation_sampling_frames = false;
+
+    // When set, vvl::ApiTimer measures every call and writes the report to this file
+    std::string api_timing_file;
+    // Logs an estimate of the memory held by each validation object every memory_report_frames vkQueuePresentKHR calls and at
+    // vkDestroyDevice, 0 disables the report
+    uint32_t memory_report_frames = 0;
+
     // Option to track the hashes of descriptors in VK_EXT_descriptor_buffer/VK_EXT_descriptor_heap
     bool descriptor_hashing = false;
     // Default seems like a sane value
@@ -22,6 +22,8 @@
 #include "object_lifetime_validation.h"
 #include "chassis/dispatch_object.h"
 #include "containers/small_vector.h"
+#include "profiling/api_timing.h"
+#include "profiling/memory_report.h"
 #include "utils/descriptor_utils.h"
 
 namespace object_lifetimes {
@@ -104,6 +106,51 @@ std::shared_ptr<ObjectState> Tracker::GetObjectState(VulkanTypedHandle object) c
 
 bool Tracker::TracksObject(VulkanTypedHandle object) const { return object_map[object.type].contains(object.handle); }
 
+bool Tracker::HasChildObjects(VulkanObjectType object_type) {
+    return object_type == kVulkanObjectTypeCommandPool || object_type == kVulkanObjectTypeDescriptorPool ||
+           object_type == kVulkanObjectTypeSwapchainKHR;
+}
+
+void Tracker::AddChild(VulkanTypedHandle parent, uint64_t child) {
+    assert(HasChildObjects(parent.type));
+    if (auto parent_state = GetObjectState(parent)) {
+        auto parent_lock = parent_state->WriteLock();
+        parent_state->child_objects->insert(child);
+    }
+}
+
+void Tracker::RemoveChild(VulkanTypedHandle parent, uint64_t child) {
+    assert(HasChildObjects(parent.type));
+    if (auto parent_state = GetObjectState(parent)) {
+        auto parent_lock = parent_state->WriteLock();
+        // Otherwise the child stays listed in its real parent, and is destroyed again with it
+        [[maybe_unused]] const size_t erased = parent_state->child_objects->erase(child);
+        assert(erased == 1);
+    }
+}
+
+std::vector<uint64_t> Tracker::GetChildren(VulkanTypedHandle parent) const {
+    assert(HasChildObjects(parent.type));
+    std::vector<uint64_t> children;
+    if (auto parent_state = GetObjectState(parent)) {
+        auto parent_lock = parent_state->ReadLock();
+        children.assign(parent_state->child_objects->begin(), parent_state->child_objects->end());
+    }
+    return children;
+}
+
+std::vector<uint64_t> Tracker::TakeChildren(VulkanTypedHandle parent) {
+    assert(HasChildObjects(parent.type));
+    std::vector<uint64_t> children;
+    if (auto parent_state = GetObjectState(parent)) {
+        // The lock is released before the caller destroys the children
+        auto parent_lock = parent_state->WriteLock();
+        children.assign(parent_state->child_objects->begin(), parent_state->child_objects->end());
+        parent_state->child_objects->clear();
+    }
+    return children;
+}
+
 void Tracker::RegisterPoisonPair(VulkanTypedHandle poisonee, VulkanTypedHandle poisoner) {
     auto poisonee_state = GetObjectState(poisonee);
     auto poisoner_state = GetObjectState(poisoner);
@@ -206,6 +253,33 @@ void Device::FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Loca
     tracker.SetDeviceHandle(*this);
 }
 
+void Device::ReportMemoryUsage(vvl::MemoryReport& report) {
+    using vvl::MemoryReport;
+    uint64_t object_count = 0;
+    uint64_t object_bytes = 0;
+    for (const ObjectMap& objects : tracker.object_map) {
+        for (const auto& [handle, object_state] : objects.snapshot()) {
+            // The map entry, the state and the control block of its shared_ptr
+            object_bytes += sizeof(handle) + sizeof(object_state) + MemoryReport::kNodeOverhead + sizeof(ObjectState) +
+                            2 * sizeof(void*);
+            auto guard = object_state->ReadLock();
+            if (object_state->child_objects) {
+                object_bytes += sizeof(*object_state->child_objects) + MemoryReport::MapBytes(*object_state->child_objects);
+            }
+            object_bytes += MemoryReport::MapBytes(object_state->objects_to_poison) +
+                            MemoryReport::VectorBytes(object_state->poisoners) +
+                            MemoryReport::VectorBytes(object_state->poison_chain);
+            object_count++;
+        }
+    }
+    report.Add(vvl::String(container_type), "Objects", object_count, object_bytes);
+
+    // The states are the ones of the pipeline libraries, already counted above
+    const auto linked_pipelines = linked_graphics_pipeline_map.snapshot();
+    const uint64_t linked_bytes = linked_pipelines.size() * (sizeof(linked_pipelines[0]) + MemoryReport::kNodeOverhead);
+    report.Add(vvl::String(container_type), "LinkedGraphicsPipelines", linked_pipelines.size(), linked_bytes);
+}
+
 bool Device::CheckPipelineObjectValidity(uint64_t object_handle, const char* invalid_handle_vuid, const Location& loc) const {
     bool skip = false;
     const auto& itr = linked_graphics_pipeline_map.find(object_handle);
@@ -240,6 +314,10 @@ void Tracker::CreateObject(VulkanTypedHandle object, const VkAllocationCallbacks
     node->status_flags = (pAllocator != nullptr) ? kObjectStatusCustomAllocator : kObjectStatusNone;
     node->handle = object.handle;
     node->parent_object = parent_handle;
+    // Created before the object is visible to other threads
+    if (HasChildObjects(object.type)) {
+        node->child_objects = std::make_unique<vvl::unordered_set<uint64_t>>();
+    }
 
     const bool inserted = object_map[object.type].insert(object.handle, node);
     if (!inserted) {
@@ -253,9 +331,6 @@ void Tracker::CreateObject(VulkanTypedHandle object, const VkAllocationCallbacks
                  string_VulkanObjectType(object.type), object.handle);
         return;
     }
-    if (object.type == kVulkanObjectTypeDescriptorPool) {
-        node->child_objects.reset(new vvl::unordered_set<uint64_t>);
-    }
 }
 
 bool Tracker::ValidateDestroyObject(VulkanTypedHandle object, const VkAllocationCallbacks* pAllocator,
@@ -356,6 +431,7 @@ bool Device::ValidateAnonymousObject(uint64_t object, VkObjectType core_object_t
 void Device::AllocateCommandBuffer(const VkCommandPool command_pool, const VkCommandBuffer command_buffer,
                                    VkCommandBufferLevel level, const Location& loc) {
     tracker.CreateObject(command_buffer, kVulkanObjectTypeCommandBuffer, nullptr, loc, command_pool);
+    tracker.AddChild(VulkanTypedHandle(command_pool, kVulkanObjectTypeCommandPool), HandleToUint64(command_buffer));
 }
 
 bool Device::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer command_buffer, const Location& loc) const {
@@ -383,10 +459,7 @@ bool Device::ValidateCommandBuffer(VkCommandPool command_pool, VkCommandBuffer c
 
 void Device::AllocateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location& loc) {
     tracker.CreateObject(descriptor_set, kVulkanObjectTypeDescriptorSet, nullptr, loc, descriptor_pool);
-    auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptor_pool));
-    if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        itr->second->child_objects->insert(HandleToUint64(descriptor_set));
-    }
+    tracker.AddChild(VulkanTypedHandle(descriptor_pool, kVulkanObjectTypeDescriptorPool), HandleToUint64(descriptor_set));
 }
 
 bool Device::ValidateDescriptorSet(VkDescriptorPool descriptor_pool, VkDescriptorSet descriptor_set, const Location& loc) const {
@@ -613,6 +686,7 @@ void Device::CreateQueue(VkQueue vkObj, const Location& loc) {
 
 void Device::CreateSwapchainImageObject(VkImage swapchain_image, VkSwapchainKHR swapchain, const Location& loc) {
     tracker.CreateObject(swapchain_image, kVulkanObjectTypeImage, nullptr, loc, swapchain);
+    tracker.AddChild(VulkanTypedHandle(swapchain, kVulkanObjectTypeSwapchainKHR), HandleToUint64(swapchain_image));
 }
 
 void Instance::FindLeakedObjects(VulkanObjectType object_type, std::vector<VulkanTypedHandle>& leaked_list) const {
@@ -620,16 +694,14 @@ void Instance::FindLeakedObjects(VulkanObjectType object_type, std::vector<Vulka
     // This is entirely incorrect and unfortunately the machinery does not allow distinguishing between
     // implicitly and explicitly created swapchain images, so the best we can do is to ignore any leaked
     // images that have swapchain parents.
-    auto snapshot =
-        (object_type == kVulkanObjectTypeImage)
-            ? tracker.object_map[object_type].snapshot(
-                  [swapchain_snapshot =
-                       tracker.object_map[kVulkanObjectTypeSwapchainKHR].snapshot()](const std::shared_ptr<ObjectState>& pNode) {
-                      return std::find_if(swapchain_snapshot.begin(), swapchain_snapshot.end(), [&](const auto& swapchain_item) {
-                                 return pNode->parent_object == swapchain_item.second->handle;
-                             }) == swapchain_snapshot.end();
-                  })
-            : tracker.object_map[object_type].snapshot();
+    vvl::unordered_set<uint64_t> swapchains;
+    if (object_type == kVulkanObjectTypeImage) {
+        for (const auto& swapchain_item : tracker.object_map[kVulkanObjectTypeSwapchainKHR].snapshot()) {
+            swapchains.insert(swapchain_item.second->handle);
+        }
+    }
+    auto snapshot = tracker.object_map[object_type].snapshot(
+        [&swapchains](const std::shared_ptr<ObjectState>& pNode) { return swapchains.count(pNode->parent_object) == 0; });
     for (const auto& item : snapshot) {
         const auto object_info = item.second;
         leaked_list.emplace_back(ObjTrackStateTypedHandle(*object_info));
@@ -668,16 +740,14 @@ void Device::FindLeakedObjects(VulkanObjectType object_type, std::vector<VulkanT
     // This is entirely incorrect and unfortunately the machinery does not allow distinguishing between
     // implicitly and explicitly created swapchain images, so the best we can do is to ignore any leaked
     // images that have swapchain parents.
-    auto snapshot =
-        (object_type == kVulkanObjectTypeImage)
-            ? tracker.object_map[object_type].snapshot(
-                  [swapchain_snapshot =
-                       tracker.object_map[kVulkanObjectTypeSwapchainKHR].snapshot()](const std::shared_ptr<ObjectState>& pNode) {
-                      return std::find_if(swapchain_snapshot.begin(), swapchain_snapshot.end(), [&](const auto& swapchain_item) {
-                                 return pNode->parent_object == swapchain_item.second->handle;
-                             }) == swapchain_snapshot.end();
-                  })
-            : tracker.object_map[object_type].snapshot();
+    vvl::unordered_set<uint64_t> swapchains;
+    if (object_type == kVulkanObjectTypeImage) {
+        for (const auto& swapchain_item : tracker.object_map[kVulkanObjectTypeSwapchainKHR].snapshot()) {
+            swapchains.insert(swapchain_item.second->handle);
+        }
+    }
+    auto snapshot = tracker.object_map[object_type].snapshot(
+        [&swapchains](const std::shared_ptr<ObjectState>& pNode) { return swapchains.count(pNode->parent_object) == 0; });
     for (const auto& item : snapshot) {
         const auto object_info = item.second;
         leaked_list.emplace_back(ObjTrackStateTypedHandle(*object_info));
@@ -849,13 +919,9 @@ bool Device::PreCallValidateResetDescriptorPool(VkDevice device, VkDescriptorPoo
                            "VUID-vkResetDescriptorPool-descriptorPool-parameter",
                            "VUID-vkResetDescriptorPool-descriptorPool-parent", error_obj.location.dot(Field::descriptorPool));
 
-    auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined, error_obj.location);
-        }
+    for (uint64_t set : tracker.GetChildren(VulkanTypedHandle(descriptorPool, kVulkanObjectTypeDescriptorPool))) {
+        skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined, kVUIDUndefined,
+                                      error_obj.location);
     }
     return skip;
 }
@@ -865,13 +931,8 @@ void Device::PreCallRecordResetDescriptorPool(VkDevice device, VkDescriptorPool
     auto lock = WriteSharedLock();
     // A DescriptorPool's descriptor sets are implicitly deleted when the pool is reset. Remove this pool's descriptor sets from
     // our descriptorSet map.
-    auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, record_obj.location);
-        }
-        pool_node->child_objects->clear();
+    for (uint64_t set : tracker.TakeChildren(VulkanTypedHandle(descriptorPool, kVulkanObjectTypeDescriptorPool))) {
+        RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, record_obj.location);
     }
 }
 
@@ -1108,19 +1169,27 @@ bool Device::PreCallValidateFreeCommandBuffers(VkDevice device, VkCommandPool co
 void Device::PreCallRecordFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
                                              const VkCommandBuffer* pCommandBuffers, const RecordObject& record_obj) {
     for (uint32_t i = 0; i < commandBufferCount; i++) {
+        // commandPool is not always the pool the command buffer was allocated from, see
+        // VUID-vkFreeCommandBuffers-pCommandBuffers-parent
+        const VulkanTypedHandle cb_handle(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer);
+        if (auto cb_state = tracker.GetObjectState(cb_handle)) {
+            const VulkanTypedHandle pool_handle(CastFromUint64<VkCommandPool>(cb_state->parent_object),
+                                                kVulkanObjectTypeCommandPool);
+            tracker.RemoveChild(pool_handle, cb_handle.handle);
+        }
         RecordDestroyObject(pCommandBuffers[i], kVulkanObjectTypeCommandBuffer, record_obj.location);
     }
 }
 
 void Device::PreCallRecordDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks* pAllocator,
                                               const RecordObject& record_obj) {
+    const VulkanTypedHandle swapchain_handle(swapchain, kVulkanObjectTypeSwapchainKHR);
+    const std::vector<uint64_t> swapchain_images = tracker.TakeChildren(swapchain_handle);
     RecordDestroyObject(swapchain, kVulkanObjectTypeSwapchainKHR, record_obj.location);
 
     auto& image_map = tracker.object_map[kVulkanObjectTypeImage];
-    auto snapshot = image_map.snapshot(
-        [swapchain](const std::shared_ptr<ObjectState>& pNode) { return pNode->parent_object == HandleToUint64(swapchain); });
-    for (const auto& itr : snapshot) {
-        image_map.erase(itr.first);
+    for (uint64_t image : swapchain_images) {
+        image_map.erase(image);
     }
 }
 
@@ -1146,16 +1215,15 @@ bool Device::PreCallValidateFreeDescriptorSets(VkDevice device, VkDescriptorPool
 void Device::PreCallRecordFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount,
                                              const VkDescriptorSet* pDescriptorSets, const RecordObject& record_obj) {
     auto lock = WriteSharedLock();
-    std::shared_ptr<ObjectState> pool_node = nullptr;
-    auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        pool_node = itr->second;
-    }
     for (uint32_t i = 0; i < descriptorSetCount; i++) {
-        RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet, record_obj.location);
-        if (pool_node) {
-            pool_node->child_objects->erase(HandleToUint64(pDescriptorSets[i]));
+        // Same as the command buffers, descriptorPool is not always the pool the set was allocated from
+        const VulkanTypedHandle set_handle(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet);
+        if (auto set_state = tracker.GetObjectState(set_handle)) {
+            const VulkanTypedHandle pool_handle(CastFromUint64<VkDescriptorPool>(set_state->parent_object),
+                                                kVulkanObjectTypeDescriptorPool);
+            tracker.RemoveChild(pool_handle, set_handle.handle);
         }
+        RecordDestroyObject(pDescriptorSets[i], kVulkanObjectTypeDescriptorSet, record_obj.location);
     }
 }
 
@@ -1170,13 +1238,9 @@ bool Device::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorP
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parameter",
                            "VUID-vkDestroyDescriptorPool-descriptorPool-parent", descriptor_pool_loc);
 
-    auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined,
-                                          kVUIDUndefined, error_obj.location);
-        }
+    for (uint64_t set : tracker.GetChildren(VulkanTypedHandle(descriptorPool, kVulkanObjectTypeDescriptorPool))) {
+        skip |= ValidateDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, nullptr, kVUIDUndefined, kVUIDUndefined,
+                                      error_obj.location);
     }
     skip |= ValidateDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, pAllocator,
                                   "VUID-vkDestroyDescriptorPool-descriptorPool-00304",
@@ -1186,13 +1250,8 @@ bool Device::PreCallValidateDestroyDescriptorPool(VkDevice device, VkDescriptorP
 void Device::PreCallRecordDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                 const VkAllocationCallbacks* pAllocator, const RecordObject& record_obj) {
     auto lock = WriteSharedLock();
-    auto itr = tracker.object_map[kVulkanObjectTypeDescriptorPool].find(HandleToUint64(descriptorPool));
-    if (itr != tracker.object_map[kVulkanObjectTypeDescriptorPool].end()) {
-        auto pool_node = itr->second;
-        for (auto set : *pool_node->child_objects) {
-            RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, record_obj.location);
-        }
-        pool_node->child_objects->clear();
+    for (uint64_t set : tracker.TakeChildren(VulkanTypedHandle(descriptorPool, kVulkanObjectTypeDescriptorPool))) {
+        RecordDestroyObject((VkDescriptorSet)set, kVulkanObjectTypeDescriptorSet, record_obj.location);
     }
     RecordDestroyObject(descriptorPool, kVulkanObjectTypeDescriptorPool, record_obj.location);
 }
@@ -1206,12 +1265,9 @@ bool Device::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPool co
     skip |= ValidateObject(commandPool, kVulkanObjectTypeCommandPool, true, "VUID-vkDestroyCommandPool-commandPool-parameter",
                            "VUID-vkDestroyCommandPool-commandPool-parent", command_pool_loc);
 
-    auto snapshot = tracker.object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjectState>& pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
-    for (const auto& itr : snapshot) {
-        auto node = itr.second;
-        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(itr.first), command_pool_loc);
-        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, nullptr,
+    for (uint64_t command_buffer : tracker.GetChildren(VulkanTypedHandle(commandPool, kVulkanObjectTypeCommandPool))) {
+        skip |= ValidateCommandBuffer(commandPool, reinterpret_cast<VkCommandBuffer>(command_buffer), command_pool_loc);
+        skip |= ValidateDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer, nullptr,
                                       kVUIDUndefined, kVUIDUndefined, error_obj.location);
     }
     skip |=
@@ -1222,11 +1278,9 @@ bool Device::PreCallValidateDestroyCommandPool(VkDevice device, VkCommandPool co
 
 void Device::PreCallRecordDestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks* pAllocator,
                                              const RecordObject& record_obj) {
-    auto snapshot = tracker.object_map[kVulkanObjectTypeCommandBuffer].snapshot(
-        [commandPool](const std::shared_ptr<ObjectState>& pNode) { return pNode->parent_object == HandleToUint64(commandPool); });
     // A CommandPool's cmd buffers are implicitly deleted when pool is deleted. Remove this pool's cmdBuffers from cmd buffer map.
-    for (const auto& itr : snapshot) {
-        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(itr.first), kVulkanObjectTypeCommandBuffer, record_obj.location);
+    for (uint64_t command_buffer : tracker.TakeChildren(VulkanTypedHandle(commandPool, kVulkanObjectTypeCommandPool))) {
+        RecordDestroyObject(reinterpret_cast<VkCommandBuffer>(command_buffer), kVulkanObjectTypeCommandBuffer, record_obj.location);
     }
     RecordDestroyObject(commandPool, kVulkanObjectTypeCommandPool, record_obj.location);
 }
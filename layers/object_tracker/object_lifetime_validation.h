@@ -43,10 +43,11 @@ struct ObjectState {
     uint32_t status_flags;
     uint64_t parent_object;
 
-    // Child objects (used for VkDescriptorPool only)
+    // Objects freed together with this one: the command buffers of a VkCommandPool, the descriptor sets of a VkDescriptorPool
+    // and the images of a VkSwapchainKHR. Only allocated for these types, see Tracker::AddChild.
     std::unique_ptr<vvl::unordered_set<uint64_t> > child_objects;
 
-    // ObjectState can be accessed from multiple threads
+    // ObjectState can be accessed from multiple threads, the lock guards the poisoning data and child_objects
     mutable std::shared_mutex poison_lock;
     auto WriteLock() const { return std::unique_lock<std::shared_mutex>(poison_lock); }
     auto ReadLock() const { return std::shared_lock<std::shared_mutex>(poison_lock); }
@@ -122,6 +123,14 @@ class Tracker : public Logger {
     void DestroyObjectSilently(VulkanTypedHandle object, const Location &loc);
     void DestroyUndestroyedObjects(VulkanObjectType object_type, const Location &loc);
 
+    // Parent to children index, so freeing a pool or a swapchain only visits its own children instead of every object of the type
+    static bool HasChildObjects(VulkanObjectType object_type);
+    void AddChild(VulkanTypedHandle parent, uint64_t child);
+    void RemoveChild(VulkanTypedHandle parent, uint64_t child);
+    std::vector<uint64_t> GetChildren(VulkanTypedHandle parent) const;
+    // Same as GetChildren, but also empties the list, for when the children are destroyed
+    std::vector<uint64_t> TakeChildren(VulkanTypedHandle parent);
+
     void RegisterPoisonPair(VulkanTypedHandle poisonee, VulkanTypedHandle poisoner);
     bool CheckPoisoning(const ObjectState &object_state, const char *vuid, const Location &loc) const;
     std::string DescribePoisonChain(const std::vector<VulkanTypedHandle> &poison_chain) const;
@@ -214,6 +223,7 @@ class Device : public vvl::BaseDevice {
     ~Device();
 
     void FinishDeviceSetup(const VkDeviceCreateInfo *pCreateInfo, const Location &loc) override;
+    void ReportMemoryUsage(vvl::MemoryReport &report) override;
 
     void DestroyLeakedObjects();
     bool ReportUndestroyedObjects(const Location &loc) const;
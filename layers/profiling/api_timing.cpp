@@ -0,0 +1,301 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiling/api_timing.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "containers/custom_containers.h"
+
+namespace vvl {
+
+std::atomic<bool> ApiTimer::enabled_{false};
+
+namespace {
+
+static_assert(LayerObjectTypeMaxEnum < 16, "The object doesn't fit in the ApiTimer key anymore");
+
+struct ApiTimerStats {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    uint64_t min_ns = std::numeric_limits<uint64_t>::max();
+    uint64_t max_ns = 0;
+
+    void Add(uint64_t ns) {
+        ++count;
+        total_ns += ns;
+        min_ns = std::min(min_ns, ns);
+        max_ns = std::max(max_ns, ns);
+    }
+
+    void Merge(const ApiTimerStats &other) {
+        count += other.count;
+        total_ns += other.total_ns;
+        min_ns = std::min(min_ns, other.min_ns);
+        max_ns = std::max(max_ns, other.max_ns);
+    }
+};
+
+// Only the owning thread adds to its table, the lock is taken by the report
+struct ApiTimerThreadTable {
+    std::mutex lock;
+    vvl::unordered_map<uint32_t, ApiTimerStats> stats;
+    vvl::unordered_map<uint32_t, ApiTimerStats> check_stats;
+};
+
+std::mutex registry_lock;
+std::vector<std::shared_ptr<ApiTimerThreadTable>> thread_tables;
+std::string report_path;
+uint32_t start_count = 0;
+
+thread_local std::shared_ptr<ApiTimerThreadTable> thread_table;
+
+// The PreCallValidate call running on this thread, and the time of the families timed inside it so far
+thread_local LayerObjectTypeId validate_object = LayerObjectTypeMaxEnum;
+thread_local uint64_t validate_family_ns = 0;
+
+uint32_t GetKey(ApiTimer::Phase phase, Func function, LayerObjectTypeId object) {
+    return (static_cast<uint32_t>(function) << 6) | (static_cast<uint32_t>(object) << 2) | static_cast<uint32_t>(phase);
+}
+
+static_assert(static_cast<uint32_t>(CheckFamily::Count) <= 128, "The family doesn't fit in the check key anymore");
+
+uint32_t GetCheckKey(CheckFamily family, Func function, LayerObjectTypeId object, bool throttled) {
+    return (static_cast<uint32_t>(function) << 12) | (static_cast<uint32_t>(object) << 8) | (static_cast<uint32_t>(family) << 1) |
+           (throttled ? 1 : 0);
+}
+
+const char *GetPhaseName(ApiTimer::Phase phase) {
+    switch (phase) {
+        case ApiTimer::PreCallValidate:
+            return "PreCallValidate";
+        case ApiTimer::PreCallRecord:
+            return "PreCallRecord";
+        case ApiTimer::Dispatch:
+            return "Dispatch";
+        case ApiTimer::PostCallRecord:
+        case ApiTimer::PhaseCount:
+            break;
+    }
+    return "PostCallRecord";
+}
+
+void WriteReport(const std::string &path) {
+    vvl::unordered_map<uint32_t, ApiTimerStats> merged;
+    vvl::unordered_map<uint32_t, ApiTimerStats> merged_checks;
+    for (const auto &table : thread_tables) {
+        std::lock_guard<std::mutex> guard(table->lock);
+        for (const auto &[key, stats] : table->stats) {
+            merged[key].Merge(stats);
+        }
+        for (const auto &[key, stats] : table->check_stats) {
+            merged_checks[key].Merge(stats);
+        }
+        table->stats.clear();
+        table->check_stats.clear();
+    }
+
+    // Three levels of rows: "CoreChecks::PreCallValidate_vkCmdDraw", then "vkCmdDraw" for the whole entry point and
+    // "CoreChecks" for all the time spent in a validation object.
+    // Min and Max are only tracked for the first level, there is no single call to compare for the sums.
+    struct Row {
+        std::string name;
+        ApiTimerStats stats;
+    };
+    std::vector<Row> rows;
+    vvl::unordered_map<uint32_t, ApiTimerStats> functions;
+    ApiTimerStats objects[LayerObjectTypeMaxEnum + 1];
+    for (const auto &[key, stats] : merged) {
+        const auto phase = static_cast<ApiTimer::Phase>(key & 0x3);
+        const auto object = static_cast<LayerObjectTypeId>((key >> 2) & 0xF);
+        const uint32_t function = key >> 6;
+
+        std::string name = String(object);
+        name += "::";
+        name += GetPhaseName(phase);
+        name += '_';
+        name += String(static_cast<Func>(function));
+        rows.emplace_back(Row{std::move(name), stats});
+
+        ApiTimerStats &function_stats = functions[function];
+        function_stats.count = std::max(function_stats.count, stats.count);
+        function_stats.total_ns += stats.total_ns;
+        objects[object].Merge(stats);
+    }
+    for (const auto &[function, stats] : functions) {
+        rows.emplace_back(Row{String(static_cast<Func>(function)), stats});
+    }
+    for (uint32_t object = 0; object <= LayerObjectTypeMaxEnum; ++object) {
+        if (objects[object].count != 0) {
+            ApiTimerStats object_stats = objects[object];
+            object_stats.min_ns = std::numeric_limits<uint64_t>::max();
+            object_stats.max_ns = 0;
+            rows.emplace_back(Row{String(static_cast<LayerObjectTypeId>(object)), object_stats});
+        }
+    }
+
+    // The checks are part of the time of their validation object: "CoreChecks::Check::ImageLayout_vkQueueSubmit" for a family of
+    // a validation object in one entry point, "Check::ImageLayout" for the family, and "Check::ImageLayout_Throttled" counting the
+    // runs skipped by the throttling.
+    ApiTimerStats families[static_cast<uint32_t>(CheckFamily::Count)];
+    ApiTimerStats throttled_families[static_cast<uint32_t>(CheckFamily::Count)];
+    for (const auto &[key, stats] : merged_checks) {
+        const uint32_t family = (key >> 1) & 0x7F;
+        const std::string family_name = std::string("Check::") + String(static_cast<CheckFamily>(family));
+        if (key & 1) {
+            throttled_families[family].count += stats.count;
+            continue;
+        }
+        const auto object = static_cast<LayerObjectTypeId>((key >> 8) & 0xF);
+        std::string name = String(object);
+        name += "::" + family_name + '_' + String(static_cast<Func>(key >> 12));
+        rows.emplace_back(Row{std::move(name), stats});
+        families[family].Merge(stats);
+    }
+    for (uint32_t family = 0; family < static_cast<uint32_t>(CheckFamily::Count); ++family) {
+        const std::string family_name = std::string("Check::") + String(static_cast<CheckFamily>(family));
+        if (families[family].count != 0) {
+            rows.emplace_back(Row{family_name, families[family]});
+        }
+        if (throttled_families[family].count != 0) {
+            rows.emplace_back(Row{family_name + "_Throttled", throttled_families[family]});
+        }
+    }
+
+    std::sort(rows.begin(), rows.end(), [](const Row &a, const Row &b) { return a.stats.total_ns > b.stats.total_ns; });
+
+    FILE *file = fopen(path.c_str(), "w");
+    if (!file) {
+        fprintf(stderr, "Validation Layer: Failed to open api_timing_file %s\n", path.c_str());
+        return;
+    }
+    fprintf(file, "Zone Name,Count,Total (ms),Avg (ms),Min (ms),Max (ms)\n");
+    for (const Row &row : rows) {
+        const double total_ms = double(row.stats.total_ns) / 1e6;
+        const double avg_ms = row.stats.count ? total_ms / double(row.stats.count) : 0.0;
+        const double min_ms = row.stats.max_ns != 0 ? double(row.stats.min_ns) / 1e6 : 0.0;
+        fprintf(file, "%s,%" PRIu64 ",%.6f,%.6f,%.6f,%.6f\n", row.name.c_str(), row.stats.count, total_ms, avg_ms, min_ms,
+                double(row.stats.max_ns) / 1e6);
+    }
+    fclose(file);
+}
+
+}  // namespace
+
+const char *String(LayerObjectTypeId object) {
+    switch (object) {
+        case LayerObjectTypeParameterValidation:
+            return "StatelessValidation";
+        case LayerObjectTypeLegacy:
+            return "Legacy";
+        case LayerObjectTypeThreading:
+            return "ThreadSafety";
+        case LayerObjectTypeObjectTracker:
+            return "ObjectLifetimes";
+        case LayerObjectTypeStateTracker:
+            return "StateTracker";
+        case LayerObjectTypeCoreValidation:
+            return "CoreChecks";
+        case LayerObjectTypeBestPractices:
+            return "BestPractices";
+        case LayerObjectTypeGpuAssisted:
+            return "GpuAV";
+        case LayerObjectTypeSyncValidation:
+            return "SyncVal";
+        case LayerObjectTypeGpuDump:
+            return "GpuDump";
+        case LayerObjectTypeMaxEnum:
+            break;
+    }
+    return "Driver";
+}
+
+const char *String(CheckFamily family) {
+    switch (family) {
+        case CheckFamily::ImageLayout:
+            return "ImageLayout";
+        case CheckFamily::DescriptorSet:
+            return "DescriptorSet";
+        case CheckFamily::Other:
+            return "Other";
+        case CheckFamily::Count:
+            break;
+    }
+    return "Unknown";
+}
+
+void ApiTimer::Start(const std::string &file_path) {
+    std::lock_guard<std::mutex> guard(registry_lock);
+    if (start_count++ == 0) {
+        report_path = file_path;
+        enabled_.store(true, std::memory_order_relaxed);
+    }
+}
+
+void ApiTimer::Stop() {
+    std::lock_guard<std::mutex> guard(registry_lock);
+    if (start_count == 0 || --start_count != 0) {
+        return;
+    }
+    enabled_.store(false, std::memory_order_relaxed);
+    WriteReport(report_path);
+}
+
+static ApiTimerThreadTable &GetThreadTable() {
+    if (!thread_table) {
+        thread_table = std::make_shared<ApiTimerThreadTable>();
+        std::lock_guard<std::mutex> guard(registry_lock);
+        thread_tables.emplace_back(thread_table);
+    }
+    return *thread_table;
+}
+
+void ApiTimer::BeginValidate(LayerObjectTypeId object) {
+    validate_object = object;
+    validate_family_ns = 0;
+}
+
+void ApiTimer::Add(Phase phase, Func function, LayerObjectTypeId object, std::chrono::steady_clock::duration duration) {
+    ApiTimerThreadTable &table = GetThreadTable();
+    const uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    std::lock_guard<std::mutex> guard(table.lock);
+    table.stats[GetKey(phase, function, object)].Add(ns);
+    if (phase == PreCallValidate && validate_object == object) {
+        const uint64_t other_ns = ns > validate_family_ns ? ns - validate_family_ns : 0;
+        table.check_stats[GetCheckKey(CheckFamily::Other, function, object, false)].Add(other_ns);
+        validate_object = LayerObjectTypeMaxEnum;
+    }
+}
+
+void ApiTimer::AddCheck(CheckFamily family, Func function, LayerObjectTypeId object, std::chrono::steady_clock::duration duration,
+                        bool throttled) {
+    ApiTimerThreadTable &table = GetThreadTable();
+    const uint64_t ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    if (!throttled && validate_object == object) {
+        validate_family_ns += ns;
+    }
+    std::lock_guard<std::mutex> guard(table.lock);
+    table.check_stats[GetCheckKey(family, function, object, throttled)].Add(ns);
+}
+
+}  // namespace vvl
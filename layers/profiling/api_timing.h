@@ -0,0 +1,89 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "chassis/layer_object_id.h"
+#include "generated/error_location_helper.h"
+
+namespace vvl {
+
+// Families of checks timed on their own inside a validation object, see core::CheckScope.
+// Other is the rest of the PreCallValidate time of each validation object, so every check is in one family.
+enum class CheckFamily : uint8_t { ImageLayout, DescriptorSet, Other, Count };
+const char *String(CheckFamily family);
+// Name of a validation object in the reports, "Driver" for LayerObjectTypeMaxEnum
+const char *String(LayerObjectTypeId object);
+
+// Measures the time spent in each entry point, split by validation object and phase, when the api_timing_file setting is set.
+// Unlike the Tracy zones, this is always built in and only needs the layer settings, so it can be used on any application.
+//
+// The chassis creates one ApiTimer around each call to a validation object, and one around the call down the chain (which is
+// reported as the "Driver" object). Each thread accumulates into its own table, the tables are merged and written as a CSV file
+// when the last instance using the setting is destroyed. The CSV columns match the ones read by layers/profiling/compare.py.
+class ApiTimer {
+  public:
+    enum Phase : uint8_t { PreCallValidate, PreCallRecord, Dispatch, PostCallRecord, PhaseCount };
+
+    ApiTimer(Phase phase, Func function, LayerObjectTypeId object) {
+        if (enabled_.load(std::memory_order_relaxed)) {
+            phase_ = phase;
+            function_ = function;
+            object_ = object;
+            if (phase == PreCallValidate) {
+                BeginValidate(object);
+            }
+            start_ = std::chrono::steady_clock::now();
+            started_ = true;
+        }
+    }
+    ~ApiTimer() {
+        if (started_) {
+            Add(phase_, function_, object_, std::chrono::steady_clock::now() - start_);
+        }
+    }
+    ApiTimer(const ApiTimer &) = delete;
+    ApiTimer &operator=(const ApiTimer &) = delete;
+
+    // Called at instance creation and destruction, the report is written when the last user stops
+    static void Start(const std::string &file_path);
+    static void Stop();
+
+    static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+    // Adds one run of a family of checks of |object|, reported as "CoreChecks::Check::ImageLayout_vkQueueSubmit". Throttled runs
+    // are only counted. The time is taken out of the Other family of the PreCallValidate call it runs in.
+    static void AddCheck(CheckFamily family, Func function, LayerObjectTypeId object, std::chrono::steady_clock::duration duration,
+                         bool throttled);
+
+  private:
+    static void BeginValidate(LayerObjectTypeId object);
+    static void Add(Phase phase, Func function, LayerObjectTypeId object, std::chrono::steady_clock::duration duration);
+
+    static std::atomic<bool> enabled_;
+
+    bool started_ = false;
+    Phase phase_ = PreCallValidate;
+    Func function_ = Func::Empty;
+    LayerObjectTypeId object_ = LayerObjectTypeMaxEnum;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,81 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "profiling/memory_report.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include "profiling/profiling.h"
+
+#if defined(TRACY_ENABLE)
+#include <mutex>
+#include <unordered_set>
+#endif
+
+namespace vvl {
+
+void MemoryReport::Add(const char *owner, const char *category, uint64_t count, uint64_t bytes, Kind kind) {
+    rows_.emplace_back(Row{owner, category, count, bytes, kind});
+}
+
+uint64_t MemoryReport::TotalBytes(Kind kind) const {
+    uint64_t total = 0;
+    for (const Row &row : rows_) {
+        if (row.kind == kind) {
+            total += row.bytes;
+        }
+    }
+    return total;
+}
+
+std::string MemoryReport::ToString() const {
+    std::vector<Row> rows = rows_;
+    std::sort(rows.begin(), rows.end(),
+              [](const Row &a, const Row &b) { return a.kind != b.kind ? a.kind < b.kind : a.bytes > b.bytes; });
+
+    std::string report;
+    char line[256];
+    std::snprintf(line, sizeof(line), "Host memory: %.3f MB, device memory: %.3f MB", double(TotalBytes(Host)) / 1e6,
+                  double(TotalBytes(Device)) / 1e6);
+    report += line;
+    for (const Row &row : rows) {
+        std::snprintf(line, sizeof(line), "\n%s %s::%s: %" PRIu64 " objects, %.3f MB", row.kind == Host ? "host" : "device",
+                      row.owner, row.category, row.count, double(row.bytes) / 1e6);
+        report += line;
+    }
+    return report;
+}
+
+void MemoryReport::Plot() const {
+#if defined(TRACY_ENABLE)
+    // Tracy keeps the plot names by pointer, they are interned for the lifetime of the process
+    static std::mutex names_lock;
+    static std::unordered_set<std::string> names;
+    for (const Row &row : rows_) {
+        const char *name = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(names_lock);
+            name = names.emplace(std::string("Memory ") + row.owner + "::" + row.category).first->c_str();
+        }
+        VVL_TracyPlot(name, row.bytes);
+    }
+#endif
+}
+
+}  // namespace vvl
@@ -0,0 +1,74 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vvl {
+
+// Memory used by the validation objects of a device, when the memory_report_frames setting is set.
+//
+// Each validation object adds one row per kind of state it keeps (the state objects of each type, the syncval access maps, the
+// GPU-AV buffer caches, ...), see BaseDevice::ReportMemoryUsage. The sizes are estimates: the size of the objects and of the
+// containers they own, without the allocator overhead and without what is shared with other objects. They are meant to find
+// what grows, not to add up to the resident size of the process.
+class MemoryReport {
+  public:
+    // A node of a hash or tree map holds about this much besides its value
+    static constexpr size_t kNodeOverhead = 2 * sizeof(void *);
+
+    enum Kind : uint8_t { Host, Device };
+
+    // Heap memory of the elements of a container, the containers themselves are counted with the object holding them
+    template <typename Vector>
+    static size_t VectorBytes(const Vector &vector) {
+        return vector.capacity() * sizeof(typename Vector::value_type);
+    }
+    static size_t VectorBytes(const std::vector<bool> &vector) { return vector.capacity() / 8; }
+    template <typename Map>
+    static size_t MapBytes(const Map &map) {
+        return map.size() * (sizeof(typename Map::value_type) + kNodeOverhead) + map.bucket_count() * sizeof(void *);
+    }
+    // The standard libraries store at least 15 characters in the string itself
+    static size_t StringBytes(const std::string &string) { return string.capacity() > 15 ? string.capacity() + 1 : 0; }
+
+    // |owner| is the validation object keeping the state (String(container_type)), |category| what it is. Both must outlive the
+    // report, they also name the Tracy plot.
+    void Add(const char *owner, const char *category, uint64_t count, uint64_t bytes, Kind kind = Host);
+
+    uint64_t TotalBytes(Kind kind) const;
+    // Rows sorted by size, host memory first
+    std::string ToString() const;
+    // Sets a Tracy plot per row, does nothing in builds without Tracy
+    void Plot() const;
+
+  private:
+    struct Row {
+        const char *owner;
+        const char *category;
+        uint64_t count;
+        uint64_t bytes;
+        Kind kind;
+    };
+    std::vector<Row> rows_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Valve Corporation
+# Copyright (c) 2026 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Runs a workload (an application, or the test suite) on top of VVL_Test_ICD with the api_timing_file setting, so the time spent
+# in the validation layer can be measured without a GPU. The workload is run several times and the median of each row is kept.
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+import tempfile
+from statistics import median
+
+import compare
+
+COLUMNS = ["Zone Name", "Count", "Total (ms)", "Avg (ms)", "Min (ms)", "Max (ms)"]
+
+def make_environment(args, timing_file):
+    """Environment loading the validation layer on top of the test ICD, and writing the timing report to timing_file."""
+    env = dict(os.environ)
+    env['VK_DRIVER_FILES'] = args.driver
+    env['VK_LAYER_PATH'] = args.layer_path
+    layers = ['VK_LAYER_KHRONOS_validation']
+    # The test ICD exposes little on its own, the tests use the profiles layer to report the features they need
+    if args.profile:
+        layers.append('VK_LAYER_KHRONOS_profiles')
+        env['VK_KHRONOS_PROFILES_PROFILE_FILE'] = args.profile
+        env['VK_KHRONOS_PROFILES_SIMULATE_CAPABILITIES'] = 'SIMULATE_API_VERSION_BIT,SIMULATE_FEATURES_BIT,SIMULATE_PROPERTIES_BIT,SIMULATE_EXTENSIONS_BIT,SIMULATE_FORMATS_BIT,SIMULATE_QUEUE_FAMILY_PROPERTIES_BIT'
+    env['VK_INSTANCE_LAYERS'] = os.pathsep.join(layers)
+    env['VK_LAYER_API_TIMING_FILE'] = timing_file
+    return env
+
+def read_report(filename):
+    """Reads a report written by api_timing_file, returns a dictionary mapping row names to their columns."""
+    rows = {}
+    with open(filename, 'r', newline='') as csvfile:
+        for row in csv.DictReader(csvfile):
+            rows[row["Zone Name"]] = {column: float(row[column]) for column in COLUMNS[1:]}
+    return rows
+
+def merge_reports(reports):
+    """Keeps the median of each column over the runs, the rows missing in a run count as 0 for that run."""
+    names = set()
+    for report in reports:
+        names.update(report.keys())
+    merged = {}
+    for name in names:
+        merged[name] = {}
+        for column in COLUMNS[1:]:
+            merged[name][column] = median(report[name][column] if name in report else 0.0 for report in reports)
+    return merged
+
+def write_report(filename, report):
+    """Writes the merged report in the format of api_timing_file, sorted by total time."""
+    with open(filename, 'w', newline='') as csvfile:
+        writer = csv.writer(csvfile)
+        writer.writerow(COLUMNS)
+        for name, row in sorted(report.items(), key=lambda item: item[1]["Total (ms)"], reverse=True):
+            writer.writerow([name, int(row["Count"])] + [f'{row[column]:.6f}' for column in COLUMNS[2:]])
+
+def main():
+    parser = argparse.ArgumentParser(description='Times the validation layer running a workload on VVL_Test_ICD.')
+    parser.add_argument('--driver', required=True, help='Path to VVL_Test_ICD.json')
+    parser.add_argument('--layer-path', required=True, help='Folder(s) with VkLayer_khronos_validation.json (and the profiles layer)')
+    parser.add_argument('--profile', help='Profile file given to the profiles layer, for instance tests/device_profiles/max_profile.json')
+    parser.add_argument('--runs', type=int, default=3, help='Number of runs, the median of each row is kept')
+    parser.add_argument('--output', default='api_timing.csv', help='Merged report')
+    parser.add_argument('--baseline', help='Report of a previous run, compared to the merged report with compare.py')
+    parser.add_argument('command', nargs=argparse.REMAINDER, help='Workload to run, after --')
+    args = parser.parse_args()
+
+    command = args.command[1:] if args.command[:1] == ['--'] else args.command
+    if not command:
+        parser.error('a workload to run is needed, for instance: -- vk_layer_validation_tests --gtest_filter=*Sync*')
+
+    reports = []
+    with tempfile.TemporaryDirectory() as temp_dir:
+        for run in range(args.runs):
+            timing_file = os.path.join(temp_dir, f'api_timing_{run}.csv')
+            result = subprocess.run(command, env=make_environment(args, timing_file))
+            if result.returncode != 0:
+                print(f'Run {run} failed with exit code {result.returncode}', file=sys.stderr)
+                sys.exit(result.returncode)
+            if not os.path.exists(timing_file):
+                print(f'Run {run} wrote no report, the workload must destroy its VkInstance', file=sys.stderr)
+                sys.exit(1)
+            reports.append(read_report(timing_file))
+
+    write_report(args.output, merge_reports(reports))
+    if args.baseline:
+        compare.main(args.baseline, args.output)
+
+if __name__ == '__main__':
+    main()
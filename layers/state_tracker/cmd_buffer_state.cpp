@@ -37,6 +37,7 @@
 #include "state_tracker/image_state.h"
 #include "state_tracker/queue_state.h"
 #include "state_tracker/vertex_index_buffer_state.h"
+#include "profiling/memory_report.h"
 #include "utils/assert_utils.h"
 #include "utils/image_utils.h"
 #include "containers/container_utils.h"
@@ -124,7 +125,11 @@ CommandPool::CommandPool(DeviceState& dev, VkCommandPool handle, const VkCommand
       createFlags(create_info->flags),
       queueFamilyIndex(create_info->queueFamilyIndex),
       queue_flags(flags),
-      unprotected((create_info->flags & VK_COMMAND_POOL_CREATE_PROTECTED_BIT) == 0) {}
+      unprotected((create_info->flags & VK_COMMAND_POOL_CREATE_PROTECTED_BIT) == 0),
+      // Command buffers of transient pools are reset or freed all the time, keep more blocks around for their next recording
+      arena_block_cache(std::make_shared<vvl::ArenaBlockCache>(
+          kArenaFirstBlockSize, kArenaMaxBlockSize,
+          (create_info->flags & VK_COMMAND_POOL_CREATE_TRANSIENT_BIT) ? 4 * 1024 * 1024 : 512 * 1024)) {}
 
 void CommandPool::Allocate(const VkCommandBufferAllocateInfo* allocate_info, const VkCommandBuffer* command_buffers) {
     for (uint32_t i = 0; i < allocate_info->commandBufferCount; i++) {
@@ -186,7 +191,8 @@ CommandBuffer::CommandBuffer(DeviceState& dev, VkCommandBuffer handle, const VkC
       lastBound({{{*this, VK_PIPELINE_BIND_POINT_GRAPHICS},
                   {*this, VK_PIPELINE_BIND_POINT_COMPUTE},
                   {*this, VK_PIPELINE_BIND_POINT_RAY_TRACING_KHR},
-                  {*this, VK_PIPELINE_BIND_POINT_DATA_GRAPH_ARM}}}) {
+                  {*this, VK_PIPELINE_BIND_POINT_DATA_GRAPH_ARM}}}),
+      arena(pool.arena_block_cache) {
     ResetCBState();
 }
 
@@ -406,6 +412,7 @@ void CommandBuffer::Reset(const Location& loc) {
     for (auto& item : sub_states_) {
         item.second->Reset(loc);
     }
+    arena.Reset();
 }
 
 void CommandBuffer::Destroy() {
@@ -419,9 +426,43 @@ void CommandBuffer::Destroy() {
         item.second->Destroy();
     }
     sub_states_.clear();
+    arena.Reset();
     StateObject::Destroy();
 }
 
+size_t CommandBuffer::HeapMemoryUsage() const {
+    using vvl::MemoryReport;
+    auto guard = ReadLock();
+    // Includes what the sub-states allocated in the arena, the containers below are on the heap and keep their capacity
+    size_t bytes = arena.ReservedBytes();
+    bytes += MemoryReport::MapBytes(image_layout_registry) + MemoryReport::MapBytes(aliased_image_layout_map);
+    bytes += MemoryReport::MapBytes(object_bindings) + MemoryReport::MapBytes(broken_bindings);
+    bytes += MemoryReport::MapBytes(active_queries) + MemoryReport::MapBytes(started_queries) +
+             MemoryReport::MapBytes(updated_queries) + MemoryReport::MapBytes(render_pass_queries);
+    bytes += MemoryReport::MapBytes(current_vertex_buffer_binding_info) + MemoryReport::MapBytes(linked_command_buffers);
+    bytes += MemoryReport::MapBytes(active_color_attachments_index) + MemoryReport::MapBytes(video_session_updates);
+    bytes += MemoryReport::VectorBytes(active_attachments) + MemoryReport::VectorBytes(active_subpasses) +
+             MemoryReport::VectorBytes(tensor_barriers) + MemoryReport::VectorBytes(push_data_dword_mask) +
+             MemoryReport::VectorBytes(descriptor_buffer.binding_info);
+    bytes += MemoryReport::VectorBytes(rendering_attachments.color_locations) +
+             MemoryReport::VectorBytes(rendering_attachments.color_indexes);
+
+    const auto& dynamic_state = dynamic_state_value;
+    bytes += MemoryReport::MapBytes(dynamic_state.vertex_bindings) + MemoryReport::VectorBytes(dynamic_state.viewports) +
+             MemoryReport::VectorBytes(dynamic_state.viewport_w_scalings) +
+             MemoryReport::VectorBytes(dynamic_state.color_blend_equations) +
+             MemoryReport::VectorBytes(dynamic_state.color_write_masks) +
+             MemoryReport::VectorBytes(dynamic_state.exclusive_scissor_enables) +
+             MemoryReport::VectorBytes(dynamic_state.exclusive_scissors);
+
+    // The label commands grow with each recording of vkCmdBeginDebugUtilsLabelEXT
+    bytes += MemoryReport::VectorBytes(label_commands_);
+    for (const LabelCommand& label_command : label_commands_) {
+        bytes += MemoryReport::StringBytes(label_command.label_name);
+    }
+    return bytes;
+}
+
 void CommandBuffer::NotifyInvalidate(const StateObject::NodeList& invalid_nodes, bool unlink) {
     {
         auto guard = WriteLock();
@@ -510,16 +551,18 @@ std::shared_ptr<CommandBufferImageLayoutMap> CommandBuffer::GetOrCreateImageLayo
         if (alias_iter != aliased_image_layout_map.end()) {
             image_layout_map = alias_iter->second;
         } else {
-            image_layout_map = std::make_shared<CommandBufferImageLayoutMap>(image_state.subresource_encoder.SubresourceCount(),
-                                                                             image_state.GetId());
+            image_layout_map = std::allocate_shared<CommandBufferImageLayoutMap>(
+                vvl::ArenaAllocator<CommandBufferImageLayoutMap>(arena), image_state.subresource_encoder.SubresourceCount(),
+                image_state.GetId());
             // Save the local layout map for the next aliased image.
             // The global layout map pointer is only used as a key into the local lookup
             // table so it doesn't need to be locked.
             aliased_image_layout_map.emplace(p_global_layout_map, image_layout_map);
         }
     } else {
-        image_layout_map =
-            std::make_shared<CommandBufferImageLayoutMap>(image_state.subresource_encoder.SubresourceCount(), image_state.GetId());
+        image_layout_map = std::allocate_shared<CommandBufferImageLayoutMap>(
+            vvl::ArenaAllocator<CommandBufferImageLayoutMap>(arena), image_state.subresource_encoder.SubresourceCount(),
+            image_state.GetId());
     }
     if (iter != image_layout_registry.end()) {
         // overwrite the stale entry
@@ -1409,6 +1452,7 @@ void CommandBuffer::Begin(const VkCommandBufferBeginInfo* pBeginInfo) {
 
     // Set updated state here in case implicit reset occurs above
     state = CbState::Recording;
+    recording_count++;
     ASSERT_AND_RETURN(pBeginInfo);
 
     begin_info_flags = pBeginInfo->flags;
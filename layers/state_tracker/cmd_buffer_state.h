@@ -22,6 +22,7 @@
 #pragma once
 #include <vulkan/vulkan_core.h>
 #include <memory>
+#include "containers/arena.h"
 #include "state_tracker/state_object.h"
 #include "state_tracker/image_layout_map.h"
 #include "state_tracker/pipeline_library_state.h"
@@ -136,6 +137,11 @@ namespace vvl {
 // Track command pools and their command buffers
 class CommandPool : public StateObject {
   public:
+    // The first block of a command buffer fits the layout map of one image, the next ones double up to the largest size, so
+    // command buffers touching few images do not hold on to a large block
+    static constexpr size_t kArenaFirstBlockSize = 1024;
+    static constexpr size_t kArenaMaxBlockSize = 16 * 1024;
+
     DeviceState &dev_data;
     const VkCommandPoolCreateFlags createFlags;
     const uint32_t queueFamilyIndex;
@@ -143,6 +149,8 @@ class CommandPool : public StateObject {
     const bool unprotected;  // can't be used for protected memory
     // Cmd buffers allocated from this pool
     vvl::unordered_map<VkCommandBuffer, CommandBuffer *> commandBuffers;
+    // Blocks of the arenas of the command buffers, a block released by a reset is reused by the next recording
+    std::shared_ptr<vvl::ArenaBlockCache> arena_block_cache;
 
     CommandPool(DeviceState &dev, VkCommandPool handle, const VkCommandPoolCreateInfo *create_info, VkQueueFlags flags);
     virtual ~CommandPool() { Destroy(); }
@@ -154,6 +162,7 @@ class CommandPool : public StateObject {
     void Reset(const Location &loc);
 
     void Destroy() override;
+    size_t HeapMemoryUsage() const override { return arena_block_cache ? arena_block_cache->CachedBytes() : 0; }
 };
 
 // This struct is not used to store label inserted with vkCmdInsertDebugUtilsLabelEXT
@@ -184,6 +193,8 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     uint64_t command_count;  // Number of commands recorded. Currently only used with VK_KHR_performance_query
     uint64_t submit_count;   // Number of times CB has been submitted
     uint64_t image_layout_change_count;  // The sequence number for changes to image layout (for cached validation)
+    // Number of times CB has been begun, unlike the counts above it is not reset with the rest of the state
+    uint64_t recording_count = 0;
 
     // Track status of all vkCmdSet* calls, if 1, means it was set
     struct DynamicStateStatus {
@@ -497,6 +508,12 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     vvl::unordered_set<QueryObject> started_queries;
     vvl::unordered_set<QueryObject> updated_queries;
     vvl::unordered_set<QueryObject> render_pass_queries;
+    // Memory for state living until the command buffer is reset, the blocks come from the command pool so recording again does not
+    // go back to the heap. Sub-states can allocate from it with vvl::ArenaAllocator, it is reset after their Reset() and Destroy()
+    // which must release everything they allocated. Declared before the members using it.
+    // The image layout maps are in it (a map keeps up to 16 ranges inline so for most images that is all their state), as well as
+    // the callbacks and per command records of the core and best practices sub-states.
+    vvl::Arena arena;
     ImageLayoutRegistry image_layout_registry;
     AliasedLayoutMap aliased_image_layout_map;  // storage for potentially aliased images
 
@@ -600,6 +617,7 @@ class CommandBuffer : public RefcountedStateObject, public SubStateManager<Comma
     virtual ~CommandBuffer() { Destroy(); }
 
     void Destroy() override;
+    size_t HeapMemoryUsage() const override;
 
     VkCommandBuffer VkHandle() const { return handle_.Cast<VkCommandBuffer>(); }
 
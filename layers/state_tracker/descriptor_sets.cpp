@@ -737,6 +737,8 @@ void vvl::DescriptorSet::LinkChildNodes() {
 }
 
 void vvl::DescriptorSet::NotifyInvalidate(const NodeList& invalid_nodes, bool unlink) {
+    // A destroyed view, buffer or sampler changes what validating the set gives, as much as an update
+    ++change_count_;
     BaseClass::NotifyInvalidate(invalid_nodes, unlink);
     for (auto& binding : bindings_) {
         binding->NotifyInvalidate(invalid_nodes, unlink);
@@ -784,10 +786,18 @@ void vvl::DescriptorSet::Destroy() {
     StateObject::Destroy();
 }
 
+size_t vvl::DescriptorSet::HeapMemoryUsage() const {
+    size_t bytes = bindings_store_.capacity() * sizeof(BindingBackingStore) + bindings_.capacity() * sizeof(BindingPtr);
+    for (const auto& binding : bindings_) {
+        bytes += binding->HeapMemoryUsage();
+    }
+    return bytes;
+}
+
 // Will let things like GPU-AV know descriptor sets are updated
-void vvl::DescriptorSet::NotifyUpdate() {
+void vvl::DescriptorSet::NotifyUpdate(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {
     for (auto& item : sub_states_) {
-        item.second->NotifyUpdate();
+        item.second->NotifyUpdate(binding, array_element, descriptor_count);
     }
 }
 
@@ -808,8 +818,6 @@ void vvl::DescriptorSet::PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb, ui
     for (auto& item : sub_states_) {
         item.second->PerformPushDescriptorsUpdate(cb, write_count, write_descs);
     }
-
-    NotifyUpdate();
 }
 
 // Perform write update in given update struct
@@ -838,7 +846,7 @@ void vvl::DescriptorSet::PerformWriteUpdate(const VkWriteDescriptorSet& update)
         Invalidate(false);
     }
 
-    NotifyUpdate();
+    NotifyUpdate(update.dstBinding, update.dstArrayElement, update.descriptorCount);
 }
 
 // Perform Copy update
@@ -870,7 +878,7 @@ void vvl::DescriptorSet::PerformCopyUpdate(const VkCopyDescriptorSet& update, co
         Invalidate(false);
     }
 
-    NotifyUpdate();
+    NotifyUpdate(update.dstBinding, update.dstArrayElement, update.descriptorCount);
 }
 
 // Update the drawing state for the affected descriptors.
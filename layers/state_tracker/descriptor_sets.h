@@ -768,6 +768,8 @@ class DescriptorBinding {
 
     virtual const Descriptor *GetDescriptor(const uint32_t index) const = 0;
     virtual Descriptor *GetDescriptor(const uint32_t index) = 0;
+    // Memory of the descriptors not stored in the binding itself
+    virtual size_t HeapMemoryUsage() const = 0;
 
     bool IsVariableCount() const { return (binding_flags & VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT) != 0; }
 
@@ -801,6 +803,12 @@ class DescriptorBindingImpl : public DescriptorBinding {
 
     Descriptor *GetDescriptor(const uint32_t index) override { return index < count ? &descriptors[index] : nullptr; }
 
+    size_t HeapMemoryUsage() const override {
+        // The first descriptor and updated flag are stored inline
+        const size_t descriptor_bytes = descriptors.capacity() > 1 ? descriptors.capacity() * sizeof(T) : 0;
+        return descriptor_bytes + (updated.capacity() > 1 ? updated.capacity() : 0);
+    }
+
     template <typename Fn>
     void ForAllUpdated(Fn &&op) {
         auto size = updated.size();
@@ -888,7 +896,8 @@ class DescriptorSetSubState {
     virtual ~DescriptorSetSubState() {}
 
     virtual void NotifyInvalidate(const StateObject::NodeList &invalid_nodes, bool unlink) {}
-    virtual void NotifyUpdate() {}
+    // |descriptor_count| descriptors starting at |array_element| of |binding| were written, continuing into the next bindings
+    virtual void NotifyUpdate(uint32_t binding, uint32_t array_element, uint32_t descriptor_count) {}
     virtual void PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb, uint32_t write_count,
                                               const VkWriteDescriptorSet* write_descs) {};
 
@@ -924,7 +933,7 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
     // Return true if given binding is present in this set
     bool HasBinding(const uint32_t binding) const { return layout_->HasBinding(binding); };
 
-    void NotifyUpdate();
+    void NotifyUpdate(uint32_t binding, uint32_t array_element, uint32_t descriptor_count);
     // Perform a push update whose contents were just validated using ValidatePushDescriptorsUpdate
     virtual void PerformPushDescriptorsUpdate(vvl::CommandBuffer& cb, uint32_t write_count,
                                               const VkWriteDescriptorSet* write_descs);
@@ -1009,6 +1018,7 @@ class DescriptorSet : public StateObject, public SubStateManager<DescriptorSetSu
     const std::vector<vku::safe_VkWriteDescriptorSet> &GetWrites() const { return push_descriptor_set_writes; }
 
     void Destroy() override;
+    size_t HeapMemoryUsage() const override;
 
     const DescriptorSetLayout &Layout() const { return *layout_; }
 
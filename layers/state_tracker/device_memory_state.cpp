@@ -154,41 +154,170 @@ BoundRanges vvl::BindableLinearMemoryTracker::GetBoundRanges(const BufferRange&
     return memory_to_bound_ranges_map;
 }
 
+static uint64_t GetSparsePageCount(VkDeviceSize resource_size, VkDeviceSize page_size) {
+    return page_size != 0 ? (resource_size + page_size - 1) / page_size : 0;
+}
+
+vvl::BindableSparseMemoryTracker::BindableSparseMemoryTracker(const VkMemoryRequirements* requirements, bool is_resident)
+    : page_table_(GetSparsePageCount(requirements->size, requirements->alignment)),
+      page_bindings_(1),
+      page_size_(requirements->alignment),
+      use_binding_map_(requirements->alignment == 0),
+      resource_size_(requirements->size),
+      is_resident_(is_resident) {}
+
+template <typename Func>
+void vvl::BindableSparseMemoryTracker::ForEachBinding(const BufferRange& range, Func&& func) const {
+    if (use_binding_map_) {
+        auto begin = binding_map_.lower_bound(range);
+        auto end = binding_map_.upper_bound(range);
+        for (auto it = begin; it != end; ++it) {
+            func(it->first, it->second);
+        }
+        return;
+    }
+
+    if (range.begin >= range.end) {
+        return;
+    }
+    const uint64_t first_page = range.begin / page_size_;
+    const uint64_t last_page = (range.end - 1) / page_size_ + 1;
+    page_table_.ForEachRun(first_page, last_page, [&](uint64_t run_begin, uint64_t run_end, uint32_t binding_index) {
+        if (binding_index != 0) {
+            const BufferRange resource_range(run_begin * page_size_, std::min(run_end * page_size_, resource_size_));
+            func(resource_range, page_bindings_[binding_index].binding);
+        }
+    });
+}
+
 unsigned vvl::BindableSparseMemoryTracker::CountDeviceMemory(VkDeviceMemory memory) const {
     unsigned count = 0u;
     auto guard = ReadLockGuard{binding_lock_};
-    for (const auto& range_state : binding_map_) {
-        count += (range_state.second.memory_state && range_state.second.memory_state->VkHandle() == memory);
-    }
+    ForEachBinding(BufferRange(0, resource_size_), [&](const BufferRange&, const MemoryBinding& binding) {
+        count += (binding.memory_state && binding.memory_state->VkHandle() == memory);
+    });
     return count;
 }
 
 bool vvl::BindableSparseMemoryTracker::HasFullRangeBound() const {
-    if (!is_resident_) {
-        VkDeviceSize current_offset = 0u;
-        {
-            auto guard = ReadLockGuard{binding_lock_};
-            for (const auto& range : binding_map_) {
-                if (current_offset != range.first.begin || !range.second.memory_state || range.second.memory_state->Invalid()) {
-                    return false;
-                }
-                current_offset = range.first.end;
+    if (is_resident_) {
+        return true;
+    }
+
+    auto guard = ReadLockGuard{binding_lock_};
+    if (!use_binding_map_) {
+        // Called each time the resource is used, the page counts avoid looking at the bindings
+        if (bound_page_count_ != page_table_.PageCount()) {
+            return false;
+        }
+        for (const auto& [memory, bound_memory] : bound_memory_) {
+            if (bound_memory.memory_state->Invalid()) {
+                return false;
             }
         }
+        return true;
+    }
 
-        if (current_offset != resource_size_) return false;
+    VkDeviceSize current_offset = 0u;
+    for (const auto& range : binding_map_) {
+        if (current_offset != range.first.begin || !range.second.memory_state || range.second.memory_state->Invalid()) {
+            return false;
+        }
+        current_offset = range.first.end;
     }
+    return current_offset == resource_size_;
+}
 
-    return true;
+bool vvl::BindableSparseMemoryTracker::IsPageAligned(VkDeviceSize resource_offset, VkDeviceSize size) const {
+    if (size == 0 || resource_offset >= resource_size_ || size > resource_size_ - resource_offset) {
+        return false;
+    }
+    // The last page of the resource can be bound up to the end of the resource
+    const VkDeviceSize end = resource_offset + size;
+    return (resource_offset % page_size_) == 0 && ((end % page_size_) == 0 || end == resource_size_);
+}
+
+void vvl::BindableSparseMemoryTracker::BindPages(StateObject* parent, std::shared_ptr<vvl::DeviceMemory>& memory_state,
+                                                 VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
+    const uint64_t first_page = resource_offset / page_size_;
+    const uint64_t last_page = (resource_offset + size + page_size_ - 1) / page_size_;
+    const uint64_t page_count = last_page - first_page;
+
+    // Unbinding (VK_NULL_HANDLE memory) puts the pages back to the unbound binding
+    uint32_t binding_index = 0;
+    if (memory_state) {
+        if (free_page_bindings_.empty()) {
+            binding_index = static_cast<uint32_t>(page_bindings_.size());
+            page_bindings_.emplace_back();
+        } else {
+            binding_index = free_page_bindings_.back();
+            free_page_bindings_.pop_back();
+        }
+        page_bindings_[binding_index] = PageBinding{MemoryBinding{memory_state, memory_offset, resource_offset}, page_count};
+
+        // Add before removing the replaced pages, rebinding pages of the same memory doesn't remove and add the parent again
+        auto [it, inserted] = bound_memory_.try_emplace(memory_state.get(), BoundMemory{memory_state, 0});
+        if (inserted) {
+            memory_state->AddParent(parent);
+        }
+        it->second.page_count += page_count;
+        bound_page_count_ += page_count;
+    }
+
+    page_table_.Set(first_page, last_page, binding_index, [&](uint32_t replaced_index, uint64_t replaced_count) {
+        if (replaced_index == 0) {
+            return;
+        }
+        bound_page_count_ -= replaced_count;
+
+        PageBinding& replaced = page_bindings_[replaced_index];
+        auto it = bound_memory_.find(replaced.binding.memory_state.get());
+        assert(it != bound_memory_.end());
+        it->second.page_count -= replaced_count;
+        if (it->second.page_count == 0) {
+            it->second.memory_state->RemoveParent(parent);
+            bound_memory_.erase(it);
+        }
+
+        replaced.page_count -= replaced_count;
+        if (replaced.page_count == 0) {
+            replaced.binding = MemoryBinding{};
+            free_page_bindings_.emplace_back(replaced_index);
+        }
+    });
+}
+
+// The parents of the memory don't change, the bindings are only moved to the other container
+void vvl::BindableSparseMemoryTracker::MoveToBindingMap() {
+    page_table_.ForEachRun(0, page_table_.PageCount(), [&](uint64_t run_begin, uint64_t run_end, uint32_t binding_index) {
+        if (binding_index != 0) {
+            const BufferRange resource_range(run_begin * page_size_, std::min(run_end * page_size_, resource_size_));
+            binding_map_.insert(BindingMap::value_type{resource_range, page_bindings_[binding_index].binding});
+        }
+    });
+    page_table_.Clear();
+    page_bindings_.clear();
+    free_page_bindings_.clear();
+    bound_memory_.clear();
+    bound_page_count_ = 0;
+    use_binding_map_ = true;
 }
 
 void vvl::BindableSparseMemoryTracker::BindMemory(StateObject* parent, std::shared_ptr<vvl::DeviceMemory>& memory_state,
                                                   VkDeviceSize memory_offset, VkDeviceSize resource_offset, VkDeviceSize size) {
+    auto guard = WriteLockGuard{binding_lock_};
+
+    if (!use_binding_map_) {
+        if (IsPageAligned(resource_offset, size)) {
+            BindPages(parent, memory_state, memory_offset, resource_offset, size);
+            return;
+        }
+        MoveToBindingMap();
+    }
+
     MemoryBinding memory_data{memory_state, memory_offset, resource_offset};
     BindingMap::value_type item{{resource_offset, resource_offset + size}, memory_data};
 
-    auto guard = WriteLockGuard{binding_lock_};
-
     // Since we don't know which ranges will be removed, we need to unbind everything and rebind later
     for (auto& value_pair : binding_map_) {
         if (value_pair.second.memory_state) value_pair.second.memory_state->RemoveParent(parent);
@@ -203,20 +332,16 @@ void vvl::BindableSparseMemoryTracker::BindMemory(StateObject* parent, std::shar
 BoundMemoryRange vvl::BindableSparseMemoryTracker::GetBoundMemoryRange(const MemoryRange& range) const {
     BoundMemoryRange mem_ranges;
     auto guard = ReadLockGuard{binding_lock_};
-    auto begin = binding_map_.lower_bound(range);
-    auto end = binding_map_.upper_bound(range);
-
-    for (auto it = begin; it != end; ++it) {
-        const auto& [resource_range, memory_data] = *it;
+    ForEachBinding(range, [&](const BufferRange& resource_range, const MemoryBinding& memory_data) {
         if (memory_data.memory_state && memory_data.memory_state->VkHandle() != VK_NULL_HANDLE) {
             const VkDeviceSize memory_range_start =
-                std::max(range.begin, memory_data.resource_offset) - memory_data.resource_offset + memory_data.memory_offset;
-            const VkDeviceSize memory_range_end = std::min(range.end, memory_data.resource_offset + resource_range.distance()) -
-                                                  memory_data.resource_offset + memory_data.memory_offset;
+                std::max(range.begin, resource_range.begin) - memory_data.resource_offset + memory_data.memory_offset;
+            const VkDeviceSize memory_range_end =
+                std::min(range.end, resource_range.end) - memory_data.resource_offset + memory_data.memory_offset;
 
             mem_ranges[memory_data.memory_state->VkHandle()].emplace_back(memory_range_start, memory_range_end);
         }
-    }
+    });
     return mem_ranges;
 }
 
@@ -224,52 +349,44 @@ BoundRanges vvl::BindableSparseMemoryTracker::GetBoundRanges(const BufferRange&
                                                              const std::vector<BufferRange>& buffer_ranges) const {
     BoundRanges memory_to_bound_ranges_map;
     auto guard = ReadLockGuard{binding_lock_};
-    auto begin = binding_map_.lower_bound(ranges_bounds);
-    auto end = binding_map_.upper_bound(ranges_bounds);
-
-    for (auto it = begin; it != end; ++it) {
-        const auto& [bounds_buffer_range, bounds_buffer_range_memory] = *it;
-
-        if (bounds_buffer_range_memory.memory_state && bounds_buffer_range_memory.memory_state->VkHandle() != VK_NULL_HANDLE) {
-            MemoryRange bounds_memory_range;
-            bounds_memory_range.begin = std::max(ranges_bounds.begin, bounds_buffer_range_memory.resource_offset) -
-                                        bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
-            bounds_memory_range.end =
-                std::min(ranges_bounds.end, bounds_buffer_range_memory.resource_offset + bounds_buffer_range.distance()) -
-                bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
-
-            std::pair<MemoryRange, BufferRange> bounds_mem_and_buffer_range;
-            bounds_mem_and_buffer_range.first = bounds_memory_range;
-            bounds_mem_and_buffer_range.second =
-                BufferRange(bounds_buffer_range_memory.resource_offset,
-                            bounds_buffer_range_memory.resource_offset + bounds_buffer_range.distance());
-
-            for (const BufferRange& buffer_range : buffer_ranges) {
-                if (!bounds_mem_and_buffer_range.second.intersects(buffer_range)) {
-                    continue;
-                }
-
-                MemoryRange memory_range;
-                memory_range.begin = std::max(buffer_range.begin, bounds_buffer_range_memory.resource_offset) -
-                                     bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
-                memory_range.end =
-                    std::min(buffer_range.end, bounds_buffer_range_memory.resource_offset + bounds_buffer_range.distance()) -
-                    bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
-
-                std::pair<MemoryRange, BufferRange> mem_and_buffer_range;
-                mem_and_buffer_range.first = bounds_mem_and_buffer_range.first & memory_range;
-                mem_and_buffer_range.second = bounds_mem_and_buffer_range.second & buffer_range;
-
-                std::vector<std::pair<MemoryRange, BufferRange>>& vk_memory_ranges_vec =
-                    memory_to_bound_ranges_map[bounds_buffer_range_memory.memory_state->VkHandle()];
-                auto insert_pos =
-                    std::lower_bound(vk_memory_ranges_vec.begin(), vk_memory_ranges_vec.end(), mem_and_buffer_range,
-                                     [](const std::pair<MemoryRange, BufferRange>& lhs,
-                                        const std::pair<MemoryRange, BufferRange>& rhs) { return lhs.first < rhs.first; });
-                vk_memory_ranges_vec.insert(insert_pos, mem_and_buffer_range);
+    ForEachBinding(ranges_bounds, [&](const BufferRange& bounds_buffer_range, const MemoryBinding& bounds_buffer_range_memory) {
+        if (!bounds_buffer_range_memory.memory_state || bounds_buffer_range_memory.memory_state->VkHandle() == VK_NULL_HANDLE) {
+            return;
+        }
+        MemoryRange bounds_memory_range;
+        bounds_memory_range.begin = std::max(ranges_bounds.begin, bounds_buffer_range.begin) -
+                                    bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
+        bounds_memory_range.end = std::min(ranges_bounds.end, bounds_buffer_range.end) -
+                                  bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
+
+        std::pair<MemoryRange, BufferRange> bounds_mem_and_buffer_range;
+        bounds_mem_and_buffer_range.first = bounds_memory_range;
+        bounds_mem_and_buffer_range.second = bounds_buffer_range;
+
+        for (const BufferRange& buffer_range : buffer_ranges) {
+            if (!bounds_mem_and_buffer_range.second.intersects(buffer_range)) {
+                continue;
             }
+
+            MemoryRange memory_range;
+            memory_range.begin = std::max(buffer_range.begin, bounds_buffer_range.begin) -
+                                 bounds_buffer_range_memory.resource_offset + bounds_buffer_range_memory.memory_offset;
+            memory_range.end = std::min(buffer_range.end, bounds_buffer_range.end) - bounds_buffer_range_memory.resource_offset +
+                               bounds_buffer_range_memory.memory_offset;
+
+            std::pair<MemoryRange, BufferRange> mem_and_buffer_range;
+            mem_and_buffer_range.first = bounds_mem_and_buffer_range.first & memory_range;
+            mem_and_buffer_range.second = bounds_mem_and_buffer_range.second & buffer_range;
+
+            std::vector<std::pair<MemoryRange, BufferRange>>& vk_memory_ranges_vec =
+                memory_to_bound_ranges_map[bounds_buffer_range_memory.memory_state->VkHandle()];
+            auto insert_pos =
+                std::lower_bound(vk_memory_ranges_vec.begin(), vk_memory_ranges_vec.end(), mem_and_buffer_range,
+                                 [](const std::pair<MemoryRange, BufferRange>& lhs,
+                                    const std::pair<MemoryRange, BufferRange>& rhs) { return lhs.first < rhs.first; });
+            vk_memory_ranges_vec.insert(insert_pos, mem_and_buffer_range);
         }
-    }
+    });
     return memory_to_bound_ranges_map;
 }
 
@@ -278,8 +395,14 @@ DeviceMemoryState vvl::BindableSparseMemoryTracker::GetBoundMemoryStates() const
 
     {
         auto guard = ReadLockGuard{binding_lock_};
-        for (auto& binding : binding_map_) {
-            if (binding.second.memory_state) dev_memory_states.emplace(binding.second.memory_state);
+        if (use_binding_map_) {
+            for (auto& binding : binding_map_) {
+                if (binding.second.memory_state) dev_memory_states.emplace(binding.second.memory_state);
+            }
+        } else {
+            for (const auto& [memory, bound_memory] : bound_memory_) {
+                dev_memory_states.emplace(bound_memory.memory_state);
+            }
         }
     }
 
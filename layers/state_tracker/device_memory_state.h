@@ -19,6 +19,7 @@
  */
 #pragma once
 #include "state_tracker/state_object.h"
+#include "containers/page_table.h"
 #include "containers/range_map.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include <optional>
@@ -159,10 +160,14 @@ class BindableLinearMemoryTracker : public BindableMemoryTracker {
 
 // Sparse bindable memory tracker
 // Does not contemplate the idea of multiplanar sparse images
+//
+// Sparse binds are multiples of the resource alignment, the sparse page size, so the bindings are kept in a PageTable with
+// one entry per page: binding a page or looking it up is O(1) no matter how many binds were done before, which matters for
+// virtual texturing that rebinds thousands of pages per frame. If a bind is not page aligned (invalid, or one of the image
+// binds whose size is not known) the tracker falls back to a range_map for the rest of the resource lifetime.
 class BindableSparseMemoryTracker : public BindableMemoryTracker {
   public:
-    BindableSparseMemoryTracker(const VkMemoryRequirements *requirements, bool is_resident)
-        : resource_size_(requirements->size), is_resident_(is_resident) {}
+    BindableSparseMemoryTracker(const VkMemoryRequirements *requirements, bool is_resident);
 
     const MemoryBinding *Binding() const override { return nullptr; }
 
@@ -185,6 +190,34 @@ class BindableSparseMemoryTracker : public BindableMemoryTracker {
     DeviceMemoryState GetBoundMemoryStates() const override;
 
   private:
+    // Calls func(resource_range, binding) for the bound ranges intersecting |range|, in increasing order.
+    // resource_range is the part of the bind still in place, it can be smaller than what was bound by BindMemory
+    template <typename Func>
+    void ForEachBinding(const BufferRange &range, Func &&func) const;
+
+    bool IsPageAligned(VkDeviceSize resource_offset, VkDeviceSize size) const;
+    void BindPages(StateObject *parent, std::shared_ptr<vvl::DeviceMemory> &memory_state, VkDeviceSize memory_offset,
+                   VkDeviceSize resource_offset, VkDeviceSize size);
+    void MoveToBindingMap();
+
+    // Each BindMemory is a binding, the pages point to the binding they are bound with. Index 0 is for unbound pages.
+    struct PageBinding {
+        MemoryBinding binding;
+        uint64_t page_count;
+    };
+    struct BoundMemory {
+        std::shared_ptr<vvl::DeviceMemory> memory_state;
+        uint64_t page_count;
+    };
+    PageTable<uint32_t> page_table_;
+    std::vector<PageBinding> page_bindings_;
+    std::vector<uint32_t> free_page_bindings_;
+    // The number of pages bound to each memory, a memory is a child of the resource while it has pages
+    vvl::unordered_map<const vvl::DeviceMemory *, BoundMemory> bound_memory_;
+    uint64_t bound_page_count_ = 0;
+    VkDeviceSize page_size_;
+    bool use_binding_map_;
+
     // This range map uses the range in resource space to know the size of the bound memory
     using BindingMap = sparse_container::range_map<VkDeviceSize, MemoryBinding>;
     BindingMap binding_map_;
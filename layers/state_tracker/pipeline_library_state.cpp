@@ -16,9 +16,16 @@
  */
 
 #include "state_tracker/pipeline_library_state.h"
+
+#include <algorithm>
+
 #include "state_tracker/pipeline_state.h"
 #include "state_tracker/shader_module.h"
 #include "containers/container_utils.h"
+#include "utils/cast_utils.h"
+#include "utils/hash_util.h"
+#include "utils/image_utils.h"
+#include "utils/vk_struct_compare.h"
 
 bool PipelineLibraryState::IsIndependentSets() const {
     if (const auto layout_state = parent.PipelineLayoutState()) {
@@ -162,32 +169,167 @@ PreRasterState::PreRasterState(const vvl::Pipeline& p, const vvl::DeviceState& s
     }
 }
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const vku::safe_VkPipelineColorBlendStateCreateInfo& cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(cbs);
+namespace {
+
+// The safe struct only copies the first VkSampleMask word, states needing more (VK_SAMPLE_COUNT_64_BIT) are not shared
+bool IsSampleMaskShareable(const VkPipelineMultisampleStateCreateInfo& ms) {
+    return !ms.pSampleMask || (SampleCountSize(ms.rasterizationSamples) + 31) / 32 <= 1;
+}
+
+// Floats are hashed and compared by their bits: NaN must match itself, or every lookup of a state with a NaN adds an entry
+uint32_t FloatBits(float value) { return vvl_bit_cast<uint32_t>(value); }
+
+void CombineStencilOpState(hash_util::HashCombiner& hc, const VkStencilOpState& state) {
+    hc << state.failOp << state.passOp << state.depthFailOp << state.compareOp << state.compareMask << state.writeMask
+       << state.reference;
+}
+
+bool StencilOpStateEqual(const VkStencilOpState& a, const VkStencilOpState& b) {
+    return a.failOp == b.failOp && a.passOp == b.passOp && a.depthFailOp == b.depthFailOp && a.compareOp == b.compareOp &&
+           a.compareMask == b.compareMask && a.writeMask == b.writeMask && a.reference == b.reference;
+}
+
+}  // namespace
+
+namespace vvl {
+
+size_t PipelineSubStateCache::ColorBlendStateHash::operator()(const VkPipelineColorBlendStateCreateInfo& cbs) const {
+    hash_util::HashCombiner hc;
+    hc << cbs.flags << cbs.logicOpEnable << cbs.logicOp << cbs.attachmentCount;
+    for (const float blend_constant : cbs.blendConstants) {
+        hc << FloatBits(blend_constant);
+    }
+    if (cbs.pAttachments) {
+        for (uint32_t i = 0; i < cbs.attachmentCount; ++i) {
+            const VkPipelineColorBlendAttachmentState& attachment = cbs.pAttachments[i];
+            hc << attachment.blendEnable << attachment.srcColorBlendFactor << attachment.dstColorBlendFactor
+               << attachment.colorBlendOp << attachment.srcAlphaBlendFactor << attachment.dstAlphaBlendFactor
+               << attachment.alphaBlendOp << attachment.colorWriteMask;
+        }
+    }
+    return hc.Value();
+}
+
+bool PipelineSubStateCache::ColorBlendStateEqual::operator()(const vku::safe_VkPipelineColorBlendStateCreateInfo& a,
+                                                             const VkPipelineColorBlendStateCreateInfo& b) const {
+    if (a.flags != b.flags || a.logicOpEnable != b.logicOpEnable || a.logicOp != b.logicOp ||
+        a.attachmentCount != b.attachmentCount || (a.pAttachments == nullptr) != (b.pAttachments == nullptr)) {
+        return false;
+    }
+    for (uint32_t i = 0; i < 4; ++i) {
+        if (FloatBits(a.blendConstants[i]) != FloatBits(b.blendConstants[i])) {
+            return false;
+        }
+    }
+    if (!a.pAttachments) {
+        return true;
+    }
+    for (uint32_t i = 0; i < a.attachmentCount; ++i) {
+        if (!ComparePipelineColorBlendAttachmentState(a.pAttachments[i], b.pAttachments[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t PipelineSubStateCache::MultisampleStateHash::operator()(const VkPipelineMultisampleStateCreateInfo& ms) const {
+    hash_util::HashCombiner hc;
+    hc << ms.flags << ms.rasterizationSamples << ms.sampleShadingEnable << FloatBits(ms.minSampleShading)
+       << ms.alphaToCoverageEnable << ms.alphaToOneEnable;
+    // An invalid rasterizationSamples has a size of 0, the mask is not read (like ComparePipelineMultisampleStateCreateInfo)
+    if (ms.pSampleMask && SampleCountSize(ms.rasterizationSamples) != 0) {
+        hc << ms.pSampleMask[0];
+    }
+    return hc.Value();
+}
+
+bool PipelineSubStateCache::MultisampleStateEqual::operator()(const vku::safe_VkPipelineMultisampleStateCreateInfo& a,
+                                                              const VkPipelineMultisampleStateCreateInfo& b) const {
+    if (a.flags != b.flags || a.rasterizationSamples != b.rasterizationSamples || a.sampleShadingEnable != b.sampleShadingEnable ||
+        FloatBits(a.minSampleShading) != FloatBits(b.minSampleShading) || a.alphaToCoverageEnable != b.alphaToCoverageEnable ||
+        a.alphaToOneEnable != b.alphaToOneEnable || (a.pSampleMask == nullptr) != (b.pSampleMask == nullptr)) {
+        return false;
+    }
+    // Only shareable states get here, they have at most one mask word
+    return !a.pSampleMask || SampleCountSize(a.rasterizationSamples) == 0 || a.pSampleMask[0] == b.pSampleMask[0];
+}
+
+size_t PipelineSubStateCache::DepthStencilStateHash::operator()(const VkPipelineDepthStencilStateCreateInfo& ds) const {
+    hash_util::HashCombiner hc;
+    hc << ds.flags << ds.depthTestEnable << ds.depthWriteEnable << ds.depthCompareOp << ds.depthBoundsTestEnable
+       << ds.stencilTestEnable << FloatBits(ds.minDepthBounds) << FloatBits(ds.maxDepthBounds);
+    CombineStencilOpState(hc, ds.front);
+    CombineStencilOpState(hc, ds.back);
+    return hc.Value();
 }
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+
+bool PipelineSubStateCache::DepthStencilStateEqual::operator()(const vku::safe_VkPipelineDepthStencilStateCreateInfo& a,
+                                                               const VkPipelineDepthStencilStateCreateInfo& b) const {
+    return a.flags == b.flags && a.depthTestEnable == b.depthTestEnable && a.depthWriteEnable == b.depthWriteEnable &&
+           a.depthCompareOp == b.depthCompareOp && a.depthBoundsTestEnable == b.depthBoundsTestEnable &&
+           a.stencilTestEnable == b.stencilTestEnable && FloatBits(a.minDepthBounds) == FloatBits(b.minDepthBounds) &&
+           FloatBits(a.maxDepthBounds) == FloatBits(b.maxDepthBounds) && StencilOpStateEqual(a.front, b.front) &&
+           StencilOpStateEqual(a.back, b.back);
+}
+
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> PipelineSubStateCache::Get(
     const VkPipelineColorBlendStateCreateInfo& cbs) {
-    return std::make_unique<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+    if (cbs.pNext) {
+        return std::make_shared<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs);
+    }
+    return color_blend_states_.LookUp(
+        cbs, [&cbs]() { return std::make_shared<const vku::safe_VkPipelineColorBlendStateCreateInfo>(&cbs); });
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const vku::safe_VkPipelineMultisampleStateCreateInfo& cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(cbs);
+
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> PipelineSubStateCache::Get(
+    const VkPipelineMultisampleStateCreateInfo& ms) {
+    if (ms.pNext || !IsSampleMaskShareable(ms)) {
+        return std::make_shared<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&ms);
+    }
+    return multisample_states_.LookUp(
+        ms, [&ms]() { return std::make_shared<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&ms); });
+}
+
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> PipelineSubStateCache::Get(
+    const VkPipelineDepthStencilStateCreateInfo& ds) {
+    if (ds.pNext) {
+        return std::make_shared<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&ds);
+    }
+    return depth_stencil_states_.LookUp(
+        ds, [&ds]() { return std::make_shared<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&ds); });
 }
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const VkPipelineMultisampleStateCreateInfo& cbs) {
-    return std::make_unique<const vku::safe_VkPipelineMultisampleStateCreateInfo>(&cbs);
+
+size_t PipelineSubStateCache::Size() const {
+    return color_blend_states_.Size() + multisample_states_.Size() + depth_stencil_states_.Size();
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const vku::safe_VkPipelineDepthStencilStateCreateInfo& cbs) {
-    // This is needlessly copied here. Might better to make this a plain pointer, with an optional "backing unique_ptr"
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(cbs);
+
+}  // namespace vvl
+
+// The safe overloads get the state of a pipeline the layer already copied, the raw ones the state of a graphics library create
+// info. Both look the state up by its Vulkan struct.
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+    const vvl::DeviceState& dev_data, const vku::safe_VkPipelineColorBlendStateCreateInfo& cbs) {
+    return dev_data.pipeline_sub_state_cache_.Get(*cbs.ptr());
+}
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+    const vvl::DeviceState& dev_data, const VkPipelineColorBlendStateCreateInfo& cbs) {
+    return dev_data.pipeline_sub_state_cache_.Get(cbs);
+}
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+    const vvl::DeviceState& dev_data, const vku::safe_VkPipelineMultisampleStateCreateInfo& cbs) {
+    return dev_data.pipeline_sub_state_cache_.Get(*cbs.ptr());
+}
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+    const vvl::DeviceState& dev_data, const VkPipelineMultisampleStateCreateInfo& cbs) {
+    return dev_data.pipeline_sub_state_cache_.Get(cbs);
+}
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+    const vvl::DeviceState& dev_data, const vku::safe_VkPipelineDepthStencilStateCreateInfo& cbs) {
+    return dev_data.pipeline_sub_state_cache_.Get(*cbs.ptr());
 }
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const VkPipelineDepthStencilStateCreateInfo& cbs) {
-    return std::make_unique<const vku::safe_VkPipelineDepthStencilStateCreateInfo>(&cbs);
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+    const vvl::DeviceState& dev_data, const VkPipelineDepthStencilStateCreateInfo& cbs) {
+    return dev_data.pipeline_sub_state_cache_.Get(cbs);
 }
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
     const vku::safe_VkPipelineShaderStageCreateInfo& cbs) {
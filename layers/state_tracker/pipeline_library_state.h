@@ -22,6 +22,7 @@
 #include "state_tracker/pipeline_layout_state.h"
 #include <vulkan/utility/vk_safe_struct.hpp>
 #include <vulkan/utility/vk_struct_helper.hpp>
+#include "utils/hash_util.h"
 #include "utils/vk_api_utils.h"
 
 // Graphics pipeline library (GPL) state as defined by VK_KHR_graphics_pipeline_library
@@ -130,18 +131,66 @@ struct PreRasterState : public PipelineLibraryState {
                                                     *task_shader_ci = nullptr, *mesh_shader_ci = nullptr;
 };
 
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
-    const VkPipelineColorBlendStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
-    const VkPipelineMultisampleStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs);
-std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
-    const VkPipelineDepthStencilStateCreateInfo &cbs);
+namespace vvl {
+
+// Games create thousands of pipelines with a handful of different multisample, depth stencil and color blend states. Each device
+// keeps the states of its live pipelines in weak dictionaries, so the pipelines with identical states share a single copy and a
+// state is freed with the last pipeline using it.
+// Float members are compared bit for bit, so a NaN matches itself. The states with a pNext chain are not shared, they are rare and
+// comparing the chains would need every extension struct.
+class PipelineSubStateCache {
+  public:
+    std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> Get(const VkPipelineColorBlendStateCreateInfo &cbs);
+    std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> Get(const VkPipelineMultisampleStateCreateInfo &ms);
+    std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> Get(const VkPipelineDepthStencilStateCreateInfo &ds);
+
+    // Number of entries, including the ones whose last pipeline was destroyed since the last purge
+    size_t Size() const;
+
+  private:
+    struct ColorBlendStateHash {
+        size_t operator()(const VkPipelineColorBlendStateCreateInfo &cbs) const;
+    };
+    struct ColorBlendStateEqual {
+        bool operator()(const vku::safe_VkPipelineColorBlendStateCreateInfo &a, const VkPipelineColorBlendStateCreateInfo &b) const;
+    };
+    struct MultisampleStateHash {
+        size_t operator()(const VkPipelineMultisampleStateCreateInfo &ms) const;
+    };
+    struct MultisampleStateEqual {
+        bool operator()(const vku::safe_VkPipelineMultisampleStateCreateInfo &a,
+                        const VkPipelineMultisampleStateCreateInfo &b) const;
+    };
+    struct DepthStencilStateHash {
+        size_t operator()(const VkPipelineDepthStencilStateCreateInfo &ds) const;
+    };
+    struct DepthStencilStateEqual {
+        bool operator()(const vku::safe_VkPipelineDepthStencilStateCreateInfo &a,
+                        const VkPipelineDepthStencilStateCreateInfo &b) const;
+    };
+
+    hash_util::WeakDictionary<vku::safe_VkPipelineColorBlendStateCreateInfo, ColorBlendStateHash, ColorBlendStateEqual>
+        color_blend_states_;
+    hash_util::WeakDictionary<vku::safe_VkPipelineMultisampleStateCreateInfo, MultisampleStateHash, MultisampleStateEqual>
+        multisample_states_;
+    hash_util::WeakDictionary<vku::safe_VkPipelineDepthStencilStateCreateInfo, DepthStencilStateHash, DepthStencilStateEqual>
+        depth_stencil_states_;
+};
+
+}  // namespace vvl
+
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+    const vvl::DeviceState &dev_data, const vku::safe_VkPipelineColorBlendStateCreateInfo &cbs);
+std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> ToSafeColorBlendState(
+    const vvl::DeviceState &dev_data, const VkPipelineColorBlendStateCreateInfo &cbs);
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+    const vvl::DeviceState &dev_data, const vku::safe_VkPipelineMultisampleStateCreateInfo &cbs);
+std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ToSafeMultisampleState(
+    const vvl::DeviceState &dev_data, const VkPipelineMultisampleStateCreateInfo &cbs);
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+    const vvl::DeviceState &dev_data, const vku::safe_VkPipelineDepthStencilStateCreateInfo &cbs);
+std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ToSafeDepthStencilState(
+    const vvl::DeviceState &dev_data, const VkPipelineDepthStencilStateCreateInfo &cbs);
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(
     const vku::safe_VkPipelineShaderStageCreateInfo &cbs);
 std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> ToShaderStageCI(const VkPipelineShaderStageCreateInfo &cbs);
@@ -155,10 +204,10 @@ struct FragmentShaderState : public PipelineLibraryState {
                         std::shared_ptr<const vvl::RenderPass> rp, spirv::StatelessData *stateless_data)
         : FragmentShaderState(pipeline_state, dev_data, rp, create_info.subpass, create_info.layout) {
         if (create_info.pMultisampleState) {
-            ms_state = ToSafeMultisampleState(*create_info.pMultisampleState);
+            ms_state = ToSafeMultisampleState(dev_data, *create_info.pMultisampleState);
         }
         if (create_info.pDepthStencilState) {
-            ds_state = ToSafeDepthStencilState(*create_info.pDepthStencilState);
+            ds_state = ToSafeDepthStencilState(dev_data, *create_info.pDepthStencilState);
         }
         FragmentShaderState::SetFragmentShaderInfo(pipeline_state, *this, dev_data, create_info, stateless_data);
     }
@@ -169,8 +218,8 @@ struct FragmentShaderState : public PipelineLibraryState {
     uint32_t subpass = 0;
 
     std::shared_ptr<const vvl::PipelineLayout> pipeline_layout;
-    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
-    std::unique_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ds_state;
+    std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
+    std::shared_ptr<const vku::safe_VkPipelineDepthStencilStateCreateInfo> ds_state;
 
     std::shared_ptr<const vvl::ShaderModule> fragment_shader;
     std::unique_ptr<const vku::safe_VkPipelineShaderStageCreateInfo> fragment_shader_ci;
@@ -194,11 +243,12 @@ struct FragmentOutputState : public PipelineLibraryState {
     // get stripped out. If this is a "normal" pipeline, then we want to keep the logic from vku::safe_VkGraphicsPipelineCreateInfo
     // that strips out pointers that should be ignored.
     template <typename CreateInfo>
-    FragmentOutputState(const vvl::Pipeline &p, const CreateInfo &create_info, std::shared_ptr<const vvl::RenderPass> rp)
+    FragmentOutputState(const vvl::Pipeline &p, const vvl::DeviceState &dev_data, const CreateInfo &create_info,
+                        std::shared_ptr<const vvl::RenderPass> rp)
         : FragmentOutputState(p, rp, create_info.subpass) {
         if (create_info.pColorBlendState) {
             const auto &cbci = *create_info.pColorBlendState;
-            color_blend_state = ToSafeColorBlendState(cbci);
+            color_blend_state = ToSafeColorBlendState(dev_data, cbci);
             // In case of being dynamic state
             if (cbci.pAttachments && cbci.attachmentCount) {
                 attachment_states.reserve(cbci.attachmentCount);
@@ -207,7 +257,7 @@ struct FragmentOutputState : public PipelineLibraryState {
         }
 
         if (create_info.pMultisampleState) {
-            ms_state = ToSafeMultisampleState(*create_info.pMultisampleState);
+            ms_state = ToSafeMultisampleState(dev_data, *create_info.pMultisampleState);
         }
 
         const auto flags2 = vku::FindStructInPNextChain<VkPipelineCreateFlags2CreateInfoKHR>(create_info.pNext);
@@ -222,8 +272,8 @@ struct FragmentOutputState : public PipelineLibraryState {
     std::shared_ptr<const vvl::RenderPass> rp_state;
     uint32_t subpass = 0;
 
-    std::unique_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> color_blend_state;
-    std::unique_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
+    std::shared_ptr<const vku::safe_VkPipelineColorBlendStateCreateInfo> color_blend_state;
+    std::shared_ptr<const vku::safe_VkPipelineMultisampleStateCreateInfo> ms_state;
 
     AttachmentStateVector attachment_states;
 
@@ -18,6 +18,7 @@
  */
 #include "state_tracker/pipeline_state.h"
 #include <vulkan/vulkan_core.h>
+#include <cstring>
 #include "error_message/error_location.h"
 #include "generated/dynamic_state_helper.h"
 #include "state_tracker/descriptor_sets.h"
@@ -26,6 +27,7 @@
 #include "state_tracker/render_pass_state.h"
 #include "state_tracker/state_object.h"
 #include "chassis/chassis_modification_state.h"
+#include "profiling/memory_report.h"
 #include "utils/descriptor_utils.h"
 
 namespace vvl {
@@ -807,7 +809,7 @@ std::shared_ptr<FragmentOutputState> Pipeline::CreateFragmentOutputState(
     const auto lib_type = GetGraphicsLibType(create_info);
     if (lib_type & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT) {
         // Creating a fragment output graphics library
-        return std::make_shared<FragmentOutputState>(p, create_info, rp);
+        return std::make_shared<FragmentOutputState>(p, state, create_info, rp);
     } else if (p.library_create_info) {
         // Linking it in for final pipeline
         //
@@ -820,7 +822,7 @@ std::shared_ptr<FragmentOutputState> Pipeline::CreateFragmentOutputState(
         }
     } else if ((lib_type == static_cast<VkGraphicsPipelineLibraryFlagsEXT>(0)) && EnablesRasterizationStates(p.pre_raster_state)) {
         // Not a graphics library (normal pipeline creation)
-        return std::make_shared<FragmentOutputState>(p, safe_create_info, rp);
+        return std::make_shared<FragmentOutputState>(p, state, safe_create_info, rp);
     }
 
     // Creating another pipeline library using this library
@@ -1068,6 +1070,73 @@ void Pipeline::Destroy() {
     StateObject::Destroy();
 }
 
+// The entry point name and the specialization info copied with a shader stage
+static size_t ShaderStageCreateInfoMemoryUsage(const vku::safe_VkPipelineShaderStageCreateInfo& stage_ci) {
+    size_t bytes = stage_ci.pName ? strlen(stage_ci.pName) + 1 : 0;
+    if (const auto* specialization_info = stage_ci.pSpecializationInfo) {
+        bytes += sizeof(*specialization_info) + specialization_info->mapEntryCount * sizeof(VkSpecializationMapEntry) +
+                 specialization_info->dataSize;
+    }
+    return bytes;
+}
+
+size_t Pipeline::HeapMemoryUsage() const {
+    // The copy of the create info, without its pNext chains
+    size_t bytes = shader_stages_ci.size() * sizeof(vku::safe_VkPipelineShaderStageCreateInfo);
+    for (const auto& stage_ci : shader_stages_ci) {
+        bytes += ShaderStageCreateInfoMemoryUsage(stage_ci);
+    }
+    if (const auto* gfx = std::get_if<vku::safe_VkGraphicsPipelineCreateInfo>(&create_info)) {
+        if (const auto* vi = gfx->pVertexInputState) {
+            bytes += sizeof(*vi) + vi->vertexBindingDescriptionCount * sizeof(*vi->pVertexBindingDescriptions) +
+                     vi->vertexAttributeDescriptionCount * sizeof(*vi->pVertexAttributeDescriptions);
+        }
+        if (gfx->pInputAssemblyState) {
+            bytes += sizeof(*gfx->pInputAssemblyState);
+        }
+        if (gfx->pTessellationState) {
+            bytes += sizeof(*gfx->pTessellationState);
+        }
+        if (const auto* vp = gfx->pViewportState) {
+            bytes += sizeof(*vp) + (vp->pViewports ? vp->viewportCount * sizeof(VkViewport) : 0) +
+                     (vp->pScissors ? vp->scissorCount * sizeof(VkRect2D) : 0);
+        }
+        if (gfx->pRasterizationState) {
+            bytes += sizeof(*gfx->pRasterizationState);
+        }
+        if (const auto* ms = gfx->pMultisampleState) {
+            bytes += sizeof(*ms) + (ms->pSampleMask ? (ms->rasterizationSamples + 31) / 32 * sizeof(VkSampleMask) : 0);
+        }
+        if (gfx->pDepthStencilState) {
+            bytes += sizeof(*gfx->pDepthStencilState);
+        }
+        if (const auto* cb = gfx->pColorBlendState) {
+            bytes += sizeof(*cb) + cb->attachmentCount * sizeof(*cb->pAttachments);
+        }
+        if (const auto* ds = gfx->pDynamicState) {
+            bytes += sizeof(*ds) + ds->dynamicStateCount * sizeof(VkDynamicState);
+        }
+    } else if (const auto* rt = std::get_if<vku::safe_VkRayTracingPipelineCreateInfoCommon>(&create_info)) {
+        bytes += rt->groupCount * sizeof(*rt->pGroups);
+        if (const auto* ds = rt->pDynamicState) {
+            bytes += sizeof(*ds) + ds->dynamicStateCount * sizeof(VkDynamicState);
+        }
+    }
+
+    bytes += MemoryReport::VectorBytes(stage_states) + MemoryReport::MapBytes(fs_writable_output_location_list) +
+             MemoryReport::MapBytes(active_slots);
+    for (const auto& slot : active_slots) {
+        bytes += MemoryReport::MapBytes(slot.second);
+    }
+    // The SPIR-V passed inline belongs to the pipeline, the other stages share the state of their VkShaderModule
+    for (const ShaderStageState& stage_state : stage_states) {
+        if (stage_state.spirv_state && (!stage_state.module_state || stage_state.module_state->VkHandle() == VK_NULL_HANDLE)) {
+            bytes += stage_state.spirv_state->HeapMemoryUsage();
+        }
+    }
+    return bytes;
+}
+
 }  // namespace vvl
 
 bool IsPipelineLayoutSetCompatible(uint32_t set, const vvl::PipelineLayout* a, const vvl::PipelineLayout* b) {
@@ -173,6 +173,7 @@ class Pipeline : public StateObject, public SubStateManager<PipelineSubState> {
              spirv::StatelessData *stateless_data);
 
     void Destroy() override;
+    size_t HeapMemoryUsage() const override;
     VkPipeline VkHandle() const { return handle_.Cast<VkPipeline>(); }
 
     void SetHandle(VkPipeline p) { handle_.handle = CastToUint64(p); }
@@ -0,0 +1,109 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "state_tracker/queue_retire_scheduler.h"
+#include "state_tracker/queue_state.h"
+#include "containers/container_utils.h"
+
+#include <algorithm>
+
+#include "profiling/profiling.h"
+
+vvl::QueueRetireScheduler::~QueueRetireScheduler() {
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        // All queues must be destroyed (and so cancelled) before the scheduler goes away
+        assert(ready_queues_.empty());
+        assert(running_queues_.empty());
+        exit_ = true;
+        workers = std::move(workers_);
+    }
+    work_cond_.notify_all();
+    for (std::thread &worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+void vvl::QueueRetireScheduler::Schedule(Queue &queue) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (exit_) {
+        return;
+    }
+    ready_queues_.push_back(&queue);
+    WakeOrAddWorker();
+}
+
+void vvl::QueueRetireScheduler::Cancel(const Queue &queue) {
+    std::unique_lock<std::mutex> guard(lock_);
+    ready_queues_.erase(std::remove(ready_queues_.begin(), ready_queues_.end(), &queue), ready_queues_.end());
+    running_cond_.wait(guard, [this, &queue]() { return !vvl::Contains(running_queues_, &queue); });
+}
+
+void vvl::QueueRetireScheduler::BeginBlocking() {
+    std::lock_guard<std::mutex> guard(lock_);
+    blocked_workers_++;
+    // The queue we are waiting on might be sitting in the ready list with no worker left to run it
+    if (!ready_queues_.empty()) {
+        WakeOrAddWorker();
+    }
+}
+
+void vvl::QueueRetireScheduler::EndBlocking() {
+    std::lock_guard<std::mutex> guard(lock_);
+    assert(blocked_workers_ > 0);
+    blocked_workers_--;
+}
+
+void vvl::QueueRetireScheduler::WakeOrAddWorker() {
+    if (idle_workers_ > 0) {
+        work_cond_.notify_one();
+        return;
+    }
+    const uint32_t active_workers = static_cast<uint32_t>(workers_.size()) - blocked_workers_;
+    if (active_workers < kMaxActiveWorkers) {
+        workers_.emplace_back(&QueueRetireScheduler::WorkerFunc, this);
+    }
+    // Otherwise one of the active workers picks up the queue when it is done with its current one
+}
+
+void vvl::QueueRetireScheduler::WorkerFunc() {
+    VVL_TracySetThreadName("QueueRetireWorker");
+
+    std::unique_lock<std::mutex> guard(lock_);
+    while (!exit_) {
+        if (ready_queues_.empty()) {
+            idle_workers_++;
+            work_cond_.wait(guard, [this]() { return exit_ || !ready_queues_.empty(); });
+            idle_workers_--;
+            continue;
+        }
+        Queue *queue = ready_queues_.front();
+        ready_queues_.pop_front();
+        running_queues_.push_back(queue);
+        guard.unlock();
+
+        queue->RetireReadySubmissions();
+
+        guard.lock();
+        // The queue can be scheduled again (and picked up by another worker) between the end of
+        // RetireReadySubmissions and this point, so only remove one entry for this worker
+        running_queues_.erase(std::find(running_queues_.begin(), running_queues_.end(), queue));
+        running_cond_.notify_all();
+    }
+}
@@ -0,0 +1,80 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+class Queue;
+
+// Runs the retirement of queue submissions for all queues of a device on a small shared set of worker threads.
+//
+// A queue is scheduled when it has submissions that are known to be finished (Queue::Notify). A worker then
+// retires that queue's ready submissions in order, so each queue is processed by at most one worker at a time.
+// Queues without pending work cost no thread.
+//
+// Retiring a submission can block: a semaphore wait has to wait until another queue retires the matching signal.
+// Workers report this with BeginBlocking/EndBlocking, and the scheduler adds a worker if ready queues would
+// otherwise have nobody to run them. This is what guarantees forward progress for cross-queue dependencies.
+// In steady state the number of threads stays close to kMaxActiveWorkers instead of one per queue.
+class QueueRetireScheduler {
+  public:
+    QueueRetireScheduler() = default;
+    QueueRetireScheduler(const QueueRetireScheduler &) = delete;
+    QueueRetireScheduler &operator=(const QueueRetireScheduler &) = delete;
+    ~QueueRetireScheduler();
+
+    // Queue::Lock() must be held by the caller. This makes scheduling atomic with respect to Queue::Destroy.
+    void Schedule(Queue &queue);
+
+    // Remove the queue from the ready list and wait for a worker that is currently running it to let go
+    void Cancel(const Queue &queue);
+
+    // Called by a worker before/after it blocks waiting for the progress of other queues or the host
+    void BeginBlocking();
+    void EndBlocking();
+
+  private:
+    static constexpr uint32_t kMaxActiveWorkers = 2;
+
+    void WorkerFunc();
+    // lock_ must be held
+    void WakeOrAddWorker();
+
+    std::mutex lock_;
+    // wakes up idle workers when a queue gets scheduled
+    std::condition_variable work_cond_;
+    // wakes up Cancel() when a worker finishes running a queue
+    std::condition_variable running_cond_;
+
+    std::deque<Queue *> ready_queues_;
+    // Queues currently run by a worker. May briefly contain the same queue twice,
+    // see QueueRetireScheduler::WorkerFunc.
+    std::vector<const Queue *> running_queues_;
+    std::vector<std::thread> workers_;
+    uint32_t idle_workers_ = 0;
+    uint32_t blocked_workers_ = 0;
+    bool exit_ = false;
+};
+
+}  // namespace vvl
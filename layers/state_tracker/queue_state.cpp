@@ -120,9 +120,7 @@ uint64_t vvl::Queue::PreSubmit(std::vector<vvl::QueueSubmission>&& submissions)
 
         submissions_.insert(submissions_.end(), std::make_move_iterator(submissions.begin()),
                             std::make_move_iterator(submissions.end()));
-        if (!thread_) {
-            thread_ = std::make_unique<std::thread>(&Queue::ThreadFunc, this);
-        }
+        ScheduleRetireIfReady();
     }
     return last_batch_seq;
 }
@@ -159,11 +157,19 @@ void vvl::Queue::Notify(uint64_t until_seq) {
     if (request_seq_ < until_seq) {
         request_seq_ = until_seq;
     }
-    cond_.notify_one();
+    ScheduleRetireIfReady();
+}
+
+void vvl::Queue::ScheduleRetireIfReady() {
+    if (retire_scheduled_ || destroyed_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+        return;
+    }
+    retire_scheduled_ = true;
+    // Scheduling under our lock means Destroy() can't miss it, see QueueRetireScheduler::Schedule
+    device_state_.queue_retire_scheduler.Schedule(*this);
 }
 
 void vvl::Queue::Wait(const Location& loc, uint64_t until_seq) {
-    std::shared_future<void> waiter;
     {
         auto guard = Lock();
         if (until_seq == kU64Max) {
@@ -172,12 +178,9 @@ void vvl::Queue::Wait(const Location& loc, uint64_t until_seq) {
         if (submissions_.empty() || until_seq < submissions_.begin()->seq) {
             return;
         }
-        uint64_t index = until_seq - submissions_.begin()->seq;
-        assert(index < submissions_.size());
-        waiter = submissions_[static_cast<size_t>(index)].waiter;
+        assert(until_seq - submissions_.begin()->seq < submissions_.size());
     }
-    auto wait_status = waiter.wait_until(GetCondWaitTimeout());
-    if (wait_status != std::future_status::ready) {
+    if (!retired_seq_.WaitUntil(until_seq, GetCondWaitTimeout())) {
         device_state_.LogError("INTERNAL-ERROR-VkQueue-state-timeout", Handle(), loc,
                                "The Validation Layers hit a timeout waiting for queue state to update."
                                " seq=%" PRIu64 " until=%" PRIu64,
@@ -296,16 +299,17 @@ void vvl::Queue::UpdatePresentOnlyQueueProgress(const DeviceState& device_state)
 }
 
 void vvl::Queue::Destroy() {
-    std::unique_ptr<std::thread> dead_thread;
+    bool first_destroy = false;
     {
         auto guard = Lock();
-        exit_thread_ = true;
-        cond_.notify_all();
-        dead_thread = std::move(thread_);
+        first_destroy = !destroyed_;
+        destroyed_ = true;
     }
-    if (dead_thread && dead_thread->joinable()) {
-        dead_thread->join();
-        dead_thread.reset();
+    // Only the first call can touch the scheduler, ~Queue can run after the device state is gone
+    if (first_destroy) {
+        device_state_.queue_retire_scheduler.Cancel(*this);
+        // The remaining submissions will never retire, don't leave anyone waiting on them
+        retired_seq_.Advance(kU64Max);
     }
     for (auto& item : sub_states_) {
         item.second->Destroy();
@@ -313,23 +317,6 @@ void vvl::Queue::Destroy() {
     StateObject::Destroy();
 }
 
-vvl::QueueSubmission* vvl::Queue::NextSubmission() {
-    QueueSubmission* result = nullptr;
-    // Find if the next submission is ready so that the thread function doesn't need to worry
-    // about locking.
-    auto guard = Lock();
-    while (!exit_thread_ && (submissions_.empty() || request_seq_ < submissions_.front().seq)) {
-        // The queue thread must wait forever if nothing is happening, until we tell it to exit
-        cond_.wait(guard);
-    }
-    if (!exit_thread_) {
-        result = &submissions_.front();
-        // NOTE: the submission must remain on the dequeue until we're done processing it so that
-        // anyone waiting for it can find the correct waiter
-    }
-    return result;
-}
-
 void vvl::Queue::Retire(QueueSubmission& submission) {
     submission.EndUse();
     for (auto& wait : submission.wait_semaphores) {
@@ -351,26 +338,29 @@ void vvl::Queue::Retire(QueueSubmission& submission) {
     }
 }
 
-void vvl::Queue::ThreadFunc() {
-    VVL_TracySetThreadName(__FUNCTION__);
-
-    QueueSubmission* submission = nullptr;
-
+void vvl::Queue::RetireReadySubmissions() {
     // Roll this queue forward, one submission at a time.
     while (true) {
-        submission = NextSubmission();
-        if (submission == nullptr) {
-            break;
+        QueueSubmission* submission = nullptr;
+        {
+            auto guard = Lock();
+            if (destroyed_ || submissions_.empty() || request_seq_ < submissions_.front().seq) {
+                retire_scheduled_ = false;
+                return;
+            }
+            // NOTE: the submission must remain on the dequeue until we're done processing it so that
+            // Wait() can tell it's not retired yet
+            submission = &submissions_.front();
         }
         Retire(*submission);
         // wake up anyone waiting for this submission to be retired
         {
             std::shared_ptr<Fence> fence;
-            std::promise<void> completed;
+            uint64_t retired_seq = 0;
             {
                 auto guard = Lock();
                 fence = std::move(submission->fence);
-                completed = std::move(submission->completed);
+                retired_seq = submission->seq;
                 submissions_.pop_front();
             }
 
@@ -381,7 +371,7 @@ void vvl::Queue::ThreadFunc() {
             }
 
             // Unblock waiting QueueWaitIdle/DeviceWaitIdle
-            completed.set_value();
+            retired_seq_.Advance(retired_seq);
         }
     }
 }
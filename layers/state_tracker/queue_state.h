@@ -24,11 +24,9 @@
 #include "error_message/error_location.h"
 #include "chassis/dispatch_object.h"
 #include "vk_layer_config.h"
-#include <condition_variable>
+#include "utils/lock_utils.h"
 #include <deque>
-#include <future>
 #include <string>
-#include <thread>
 #include <vector>
 
 namespace vvl {
@@ -59,7 +57,7 @@ struct CommandBufferSubmission {
 };
 
 struct QueueSubmission {
-    QueueSubmission(const Location &loc_) : loc(loc_), completed(), waiter(completed.get_future()) {}
+    QueueSubmission(const Location &loc_) : loc(loc_) {}
 
     bool is_last_submission{false};
     std::vector<vvl::CommandBufferSubmission> cb_submissions{};
@@ -78,8 +76,6 @@ struct QueueSubmission {
     LocationCapture loc;
     uint64_t seq{0};
     uint32_t perf_submit_pass{0};
-    std::promise<void> completed;
-    std::shared_future<void> waiter;
 
     void AddCommandBuffer(std::shared_ptr<vvl::CommandBuffer> cb_state, std::vector<std::string> initial_label_stack) {
         cb_submissions.emplace_back(std::move(cb_state), std::move(initial_label_stack));
@@ -99,7 +95,7 @@ struct QueueSubmission {
     void BeginUse();
 };
 
-// This timeout is for all queue threads to update their state after we know
+// This timeout is for the queue retire workers to update their state after we know
 // (via being in a PostRecord call) that a fence, semaphore or wait for idle has completed.
 //
 // NOTE 2025-07-07: we did not have bugs related to timeouts for quite some time.
@@ -155,14 +151,17 @@ class Queue : public StateObject, public SubStateManager<QueueSubState> {
     // Called from the various PostCallRecordQueueSubmit() methods
     void PostSubmit();
 
-    // Tell the queue thread that submissions up to and including the submission with
-    // sequence number until_seq have finished. kU64Max means to finish all submissions.
+    // Tell the queue that submissions up to and including the submission with sequence number
+    // until_seq have finished, and schedule their retirement. kU64Max means to finish all submissions.
     void Notify(uint64_t until_seq = kU64Max);
 
-    // Wait for the queue thread to finish processing submissions with sequence numbers
+    // Wait for the retire workers to finish processing submissions with sequence numbers
     // up to and including until_seq. kU64Max means to finish all submissions.
     void Wait(const Location &loc, uint64_t until_seq = kU64Max);
 
+    // Called by a QueueRetireScheduler worker. Retires, in order, all submissions up to the last Notify().
+    void RetireReadySubmissions();
+
     // Helper that combines Notify and Wait
     void NotifyAndWait(const Location &loc, uint64_t until_seq = kU64Max);
 
@@ -207,27 +206,29 @@ class Queue : public StateObject, public SubStateManager<QueueSubState> {
     const std::deque<QueueSubmission> &Submissions() { return submissions_; }
 
   protected:
-    // called when the worker thread decides a submissions has finished executing
+    // called when a retire worker decides a submissions has finished executing
     void Retire(QueueSubmission &submission);
 
   private:
     DeviceState& device_state_;
     const VkQueueFamilyProperties queue_family_properties_;
 
-    void ThreadFunc();
-    QueueSubmission *NextSubmission();
+    // lock_ must be held
+    void ScheduleRetireIfReady();
 
     // state related to submitting to the queue, all data members must
     // be accessed with lock_ held
-    std::unique_ptr<std::thread> thread_;
     std::deque<QueueSubmission> submissions_;
     std::atomic<uint64_t> seq_{0};
     uint64_t request_seq_{0};
     uint64_t first_seq_to_post_process_{0};
-    bool exit_thread_{false};
+    // The queue is in the scheduler's ready list or being run by a worker
+    bool retire_scheduled_{false};
+    bool destroyed_{false};
     mutable std::mutex lock_;
-    // condition to wake up the queue's thread
-    std::condition_variable cond_;
+
+    // Sequence number of the last retired submission. Wait() blocks on it.
+    WaitableCounter retired_seq_;
 
     // This is an early-exit hint for FindTimelineWaitWithoutResolvingSignal.
     // Concurrent updates are safe: the counter can temporarily be larger than the
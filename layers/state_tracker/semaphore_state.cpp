@@ -66,7 +66,8 @@ vvl::Semaphore::Semaphore(DeviceState& device, VkSemaphore handle, const VkSemap
       current_payload_(type_create_info ? type_create_info->initialValue : 0),
       next_binary_payload_(current_payload_ + 1),
       completed_op_(type == VK_SEMAPHORE_TYPE_TIMELINE ? kSignal : kNone),
-      completed_payload_(current_payload_) {
+      completed_payload_(current_payload_),
+      retired_payload_(current_payload_) {
 }
 
 const VulkanTypedHandle* vvl::Semaphore::InUse() const {
@@ -446,7 +447,6 @@ bool vvl::Semaphore::CanRetireTimelineWait(const vvl::Queue* current_queue, uint
 }
 
 void vvl::Semaphore::RetireWait(vvl::Queue* current_queue, uint64_t payload, const Location& loc, bool queue_thread) {
-    std::shared_future<void> waiter;
     bool retire_external_payload = false;
     uint64_t external_payload = 0;
     {
@@ -497,12 +497,9 @@ void vvl::Semaphore::RetireWait(vvl::Queue* current_queue, uint64_t payload, con
         }
 
         // Wait for some other queue or a host operation to retire
-        assert(timepoint.waiter.valid());
-        // the current timepoint should get destroyed while we're waiting, so copy out the waiter.
-        waiter = timepoint.waiter;
     }
 
-    WaitTimePoint(std::move(waiter), payload, !queue_thread, loc);
+    WaitTimePoint(payload, !queue_thread, loc);
 
     if (retire_external_payload) {
         auto guard = WriteLock();
@@ -540,13 +537,14 @@ void vvl::Semaphore::RetireTimePoint(uint64_t payload, OpType completed_op, cons
     auto it = timeline_.begin();
     while (it != timeline_.end() && it->first <= payload) {
         assert(it->first > completed_payload_);
-        it->second.completed.set_value();
         ++it;
     }
     timeline_.erase(timeline_.begin(), it);
     completed_op_ = completed_op;
     completed_payload_ = payload;
     completed_queue_ = completed_op_queue;
+    // Wake up anyone waiting on the retired timepoints
+    retired_payload_.Advance(payload);
 
     // Update the current payload only if the given payload is larger.
     // vkSignalSemaphore updates the current payload immediately, so it can be
@@ -577,19 +575,23 @@ void vvl::Semaphore::RetireTimePoint(uint64_t payload, OpType completed_op, cons
     }
 }
 
-void vvl::Semaphore::WaitTimePoint(std::shared_future<void>&& waiter, uint64_t payload, bool unblock_validation_object,
-                                   const Location& loc) {
+void vvl::Semaphore::WaitTimePoint(uint64_t payload, bool unblock_validation_object, const Location& loc) {
     if (unblock_validation_object) {
         device_.BeginBlockingOperation();
+    } else {
+        // Let the scheduler run other queues (including the one we wait for) while this worker is blocked
+        device_.queue_retire_scheduler.BeginBlocking();
     }
 
-    auto result = waiter.wait_until(GetCondWaitTimeout());
+    const bool retired = retired_payload_.WaitUntil(payload, GetCondWaitTimeout());
 
     if (unblock_validation_object) {
         device_.EndBlockingOperation();
+    } else {
+        device_.queue_retire_scheduler.EndBlocking();
     }
 
-    if (result != std::future_status::ready) {
+    if (!retired) {
         device_.LogError(
             "INTERNAL-ERROR-VkSemaphore-state-timeout", Handle(), loc,
             "The Validation Layers hit a timeout waiting for timeline semaphore state to update. completed_.payload=%" PRIu64
@@ -19,10 +19,10 @@
 #pragma once
 #include "state_tracker/state_object.h"
 #include "state_tracker/submission_reference.h"
+#include "containers/flat_queue_map.h"
 #include "error_message/error_location.h"
-#include <future>
+#include "utils/lock_utils.h"
 #include <optional>
-#include <map>
 #include <shared_mutex>
 
 namespace vvl {
@@ -51,10 +51,7 @@ class Semaphore : public RefcountedStateObject {
         std::optional<SubmissionReference> signal_submit;
         small_vector<SubmissionReference, 1, uint32_t> wait_submits;
         std::optional<Func> acquire_command;
-        std::promise<void> completed;
-        std::shared_future<void> waiter;
 
-        TimePoint() : completed(), waiter(completed.get_future()) {}
         bool HasSignaler() const { return signal_submit.has_value() || acquire_command.has_value(); }
         bool HasWaiters() const { return !wait_submits.empty(); }
         void Notify() const;
@@ -158,9 +155,9 @@ class Semaphore : public RefcountedStateObject {
     // Mark timepoints up to and including payload as completed (notify waiters) and remove them from timeline
     void RetireTimePoint(uint64_t payload, OpType completed_op, const Queue *completed_op_queue);
 
-    // Waits for the waiter. Unblock parameter must be true if the caller is a validation object and false otherwise.
+    // Waits until the timepoint is retired. Unblock parameter must be true if the caller is a validation object and false otherwise.
     // (validation object has to use {Begin/End}BlockingOperation() when waiting for the timepoint)
-    void WaitTimePoint(std::shared_future<void> &&waiter, uint64_t payload, bool unblock_validation_object, const Location &loc);
+    void WaitTimePoint(uint64_t payload, bool unblock_validation_object, const Location &loc);
 
   private:
     mutable std::shared_mutex lock_;
@@ -177,12 +174,16 @@ class Semaphore : public RefcountedStateObject {
 
     // Set of pending operations ordered by payload.
     // Timeline operations can be added in any order and multiple wait operations
-    // can use the same payload value.
-    std::map<uint64_t, TimePoint> timeline_;
+    // can use the same payload value. In practice payloads grow and timepoints are
+    // retired from the front, which is what flat_queue_map is optimized for.
+    vvl::flat_queue_map<uint64_t, TimePoint> timeline_;
 
     // The recently completed semaphore operation
     OpType completed_op_ = kNone;
     uint64_t completed_payload_ = 0;
+    // Mirrors completed_payload_ for threads waiting on a timepoint to be retired.
+    // Timepoints are retired in payload order, so reaching the payload means the timepoint is retired.
+    WaitableCounter retired_payload_;
     const Queue* completed_queue_ = nullptr;
 
     // Empty if there are no pending signals. Used only for timeline semaphores
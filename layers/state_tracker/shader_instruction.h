@@ -121,6 +121,9 @@ class Instruction {
     // There really should be no need to access the raw bytes
     const uint32_t* GetRawBytes() const { return words_.data(); }
 
+    // Words of the long instructions that did not fit in the instruction itself
+    size_t HeapMemoryUsage() const { return words_.capacity() > word_vector_length ? words_.capacity() * sizeof(uint32_t) : 0; }
+
   private:
     void SetResultTypeIndex();
     void UpdateDebugInfo();
@@ -27,6 +27,7 @@
 
 #include <vulkan/utility/vk_format_utils.h>
 #include "layer_options.h"
+#include "profiling/memory_report.h"
 #include "utils/assert_utils.h"
 #include "utils/hash_util.h"
 #include "utils/shader_utils.h"
@@ -584,6 +585,18 @@ bool EntryPoint::HasBuiltIn(spv::BuiltIn built_in) const {
     return false;
 }
 
+size_t EntryPoint::HeapMemoryUsage() const {
+    using vvl::MemoryReport;
+    size_t bytes = MemoryReport::StringBytes(name);
+    bytes += MemoryReport::MapBytes(accessible.variables) + MemoryReport::MapBytes(accessible.access_chains) +
+             MemoryReport::MapBytes(accessible.memory_accesses) + MemoryReport::MapBytes(accessible.graph_constant);
+    bytes += MemoryReport::VectorBytes(resource_interface_variables) + MemoryReport::VectorBytes(stage_interface_variables) +
+             MemoryReport::VectorBytes(built_in_variables) + MemoryReport::VectorBytes(user_defined_interface_variables);
+    bytes += MemoryReport::MapBytes(resource_interface_variable_map) + MemoryReport::MapBytes(input_interface_slots) +
+             MemoryReport::MapBytes(output_interface_slots);
+    return bytes;
+}
+
 std::string EntryPoint::Describe() const {
     std::stringstream ss;
     ss << "[";
@@ -1463,6 +1476,38 @@ Module::StaticData::StaticData(const Module& module_state, bool parse, Stateless
     }
 }
 
+size_t Module::HeapMemoryUsage() const {
+    using vvl::MemoryReport;
+    const StaticData& data = static_data_;
+    size_t bytes = MemoryReport::VectorBytes(words_) + MemoryReport::VectorBytes(data.instructions);
+    for (const Instruction& insn : data.instructions) {
+        bytes += insn.HeapMemoryUsage();
+    }
+    bytes += MemoryReport::MapBytes(data.definitions) + MemoryReport::MapBytes(data.decorations) +
+             MemoryReport::MapBytes(data.execution_modes) + MemoryReport::MapBytes(data.id_to_spec_id) +
+             MemoryReport::MapBytes(data.capability_list) + MemoryReport::MapBytes(data.type_struct_map) +
+             MemoryReport::MapBytes(data.image_write_load_id_map);
+    for (const auto& decoration : data.decorations) {
+        bytes += MemoryReport::MapBytes(decoration.second.member_decorations);
+    }
+    bytes += MemoryReport::VectorBytes(data.decoration_inst) + MemoryReport::VectorBytes(data.variable_inst) +
+             MemoryReport::VectorBytes(data.explicit_memory_inst) + MemoryReport::VectorBytes(data.cooperative_matrix_inst) +
+             MemoryReport::VectorBytes(data.cooperative_vector_inst) + MemoryReport::VectorBytes(data.emit_mesh_tasks_inst) +
+             MemoryReport::VectorBytes(data.constant_size_of_inst) + MemoryReport::VectorBytes(data.array_length_inst) +
+             MemoryReport::VectorBytes(data.vector_type_inst) +
+             MemoryReport::VectorBytes(data.descriptor_indexing_spec_const_ac_inst);
+    // The control block of the shared_ptr is next to the object
+    bytes += MemoryReport::VectorBytes(data.type_structs);
+    for (const auto& type_struct : data.type_structs) {
+        bytes += sizeof(TypeStructInfo) + 2 * sizeof(void*) + MemoryReport::VectorBytes(type_struct->members);
+    }
+    bytes += MemoryReport::VectorBytes(data.entry_points);
+    for (const auto& entry_point : data.entry_points) {
+        bytes += sizeof(EntryPoint) + 2 * sizeof(void*) + entry_point->HeapMemoryUsage();
+    }
+    return bytes;
+}
+
 std::shared_ptr<const TypeStructInfo> Module::GetTypeStructInfo(const Instruction* insn) const {
     while (true) {
         if (insn->Opcode() == spv::OpVariable) {
@@ -642,6 +642,8 @@ struct EntryPoint {
     EntryPoint(const Module &module_state, const Instruction &entrypoint_insn, const ParsedInfo &parsed);
 
     bool HasBuiltIn(spv::BuiltIn built_in) const;
+    // Memory of the lookups and interface variables, for the memory_report_frames setting
+    size_t HeapMemoryUsage() const;
 
     // Used to provide a better, consistent error message
     const bool only_entry_point;
@@ -819,6 +821,9 @@ struct Module {
 
     const std::vector<Instruction> &GetInstructions() const { return static_data_.instructions; }
 
+    // The SPIR-V words and everything parsed from them, for the memory_report_frames setting
+    size_t HeapMemoryUsage() const;
+
     const DecorationSet &GetDecorationSet(uint32_t id) const {
         // return the actual decorations for this id, or a default empty set.
         const auto it = static_data_.decorations.find(id);
@@ -904,6 +909,8 @@ struct ShaderModule : public StateObject {
 
     VkShaderModule VkHandle() const { return handle_.Cast<VkShaderModule>(); }
 
+    size_t HeapMemoryUsage() const override { return spirv ? spirv->HeapMemoryUsage() : 0; }
+
     // If null, means this is a empty object and no shader backing it
     // TODO - This (and vvl::ShaderObject) could be unique, but need handle multiple ValidationObjects
     // https://github.com/KhronosGroup/Vulkan-ValidationLayers/pull/6265/files
@@ -19,6 +19,7 @@
 #include <vulkan/vulkan_core.h>
 #include "shader_module.h"
 #include "state_tracker/state_tracker.h"
+#include "profiling/memory_report.h"
 #include "utils/descriptor_utils.h"
 
 namespace vvl {
@@ -50,4 +51,12 @@ ShaderObject::ShaderObject(DeviceState& dev_data, const VkShaderCreateInfoEXT& c
     }
 }
 
+size_t ShaderObject::HeapMemoryUsage() const {
+    size_t bytes = stage.spirv_state ? stage.spirv_state->HeapMemoryUsage() : 0;
+    bytes += MemoryReport::VectorBytes(linked_shaders) + MemoryReport::MapBytes(active_slots);
+    // The create info keeps its own copy of the code
+    bytes += create_info.codeSize;
+    return bytes;
+}
+
 }  // namespace vvl
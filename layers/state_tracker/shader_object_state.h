@@ -59,6 +59,7 @@ struct ShaderObject : public StateObject, public SubStateManager<ShaderObjectSub
     const uint32_t max_active_slot = 0;  // the highest set number in active_slots for pipeline layout compatibility checks
 
     VkShaderEXT VkHandle() const { return handle_.Cast<VkShaderEXT>(); }
+    size_t HeapMemoryUsage() const override;
     bool IsGraphicsShaderState() const { return create_info.stage != VK_SHADER_STAGE_COMPUTE_BIT; };
 };
 
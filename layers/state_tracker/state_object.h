@@ -78,6 +78,9 @@ class StateObject: public std::enable_shared_from_this<StateObject>, public Type
 
     virtual const VulkanTypedHandle* InUse() const;
 
+    // Memory owned by the object besides its own size, an estimate for the memory_report_frames setting
+    virtual size_t HeapMemoryUsage() const { return 0; }
+
     virtual bool AddParent(StateObject *parent_node);
     virtual void RemoveParent(StateObject *parent_node);
 
@@ -50,6 +50,8 @@
 #include "state_tracker/wsi_state.h"
 #include "state_tracker/descriptor_mode.h"
 #include "chassis/chassis_modification_state.h"
+#include "profiling/api_timing.h"
+#include "profiling/memory_report.h"
 #include "spirv-tools/optimizer.hpp"
 #include "utils/assert_utils.h"
 #include "utils/descriptor_utils.h"
@@ -1546,6 +1548,55 @@ void DeviceState::DestroyObjectMaps() {
     video_session_parameters_map_.clear();
 }
 
+template <typename State>
+void DeviceState::ReportStateMemoryUsage(MemoryReport& report, const char* category) const {
+    const auto states = GetStateMap<State>().snapshot();
+    // The map entry, the state and the control block of its shared_ptr
+    uint64_t bytes = states.size() * (sizeof(states[0]) + MemoryReport::kNodeOverhead + sizeof(State) + 2 * sizeof(void*));
+    for (const auto& entry : states) {
+        bytes += entry.second->HeapMemoryUsage();
+    }
+    report.Add(String(container_type), category, states.size(), bytes);
+}
+
+void DeviceState::ReportMemoryUsage(MemoryReport& report) {
+    ReportStateMemoryUsage<vvl::Queue>(report, "Queue");
+    ReportStateMemoryUsage<vvl::RenderPass>(report, "RenderPass");
+    ReportStateMemoryUsage<vvl::DescriptorSetLayout>(report, "DescriptorSetLayout");
+    ReportStateMemoryUsage<vvl::Sampler>(report, "Sampler");
+    ReportStateMemoryUsage<vvl::ImageView>(report, "ImageView");
+    ReportStateMemoryUsage<vvl::Image>(report, "Image");
+    ReportStateMemoryUsage<vvl::Tensor>(report, "Tensor");
+    ReportStateMemoryUsage<vvl::TensorView>(report, "TensorView");
+    ReportStateMemoryUsage<vvl::BufferView>(report, "BufferView");
+    ReportStateMemoryUsage<vvl::Buffer>(report, "Buffer");
+    ReportStateMemoryUsage<vvl::PipelineCache>(report, "PipelineCache");
+    ReportStateMemoryUsage<vvl::Pipeline>(report, "Pipeline");
+    ReportStateMemoryUsage<vvl::DataGraphPipelineSession>(report, "DataGraphPipelineSession");
+    ReportStateMemoryUsage<vvl::ShaderObject>(report, "ShaderObject");
+    ReportStateMemoryUsage<vvl::DeviceMemory>(report, "DeviceMemory");
+    ReportStateMemoryUsage<vvl::Framebuffer>(report, "Framebuffer");
+    ReportStateMemoryUsage<vvl::ShaderModule>(report, "ShaderModule");
+    ReportStateMemoryUsage<vvl::DescriptorUpdateTemplate>(report, "DescriptorUpdateTemplate");
+    ReportStateMemoryUsage<vvl::Swapchain>(report, "Swapchain");
+    ReportStateMemoryUsage<vvl::DescriptorPool>(report, "DescriptorPool");
+    ReportStateMemoryUsage<vvl::DescriptorSet>(report, "DescriptorSet");
+    ReportStateMemoryUsage<vvl::CommandBuffer>(report, "CommandBuffer");
+    ReportStateMemoryUsage<vvl::CommandPool>(report, "CommandPool");
+    ReportStateMemoryUsage<vvl::PipelineLayout>(report, "PipelineLayout");
+    ReportStateMemoryUsage<vvl::Fence>(report, "Fence");
+    ReportStateMemoryUsage<vvl::QueryPool>(report, "QueryPool");
+    ReportStateMemoryUsage<vvl::Semaphore>(report, "Semaphore");
+    ReportStateMemoryUsage<vvl::Event>(report, "Event");
+    ReportStateMemoryUsage<vvl::SamplerYcbcrConversion>(report, "SamplerYcbcrConversion");
+    ReportStateMemoryUsage<vvl::VideoSession>(report, "VideoSession");
+    ReportStateMemoryUsage<vvl::VideoSessionParameters>(report, "VideoSessionParameters");
+    ReportStateMemoryUsage<vvl::AccelerationStructureNV>(report, "AccelerationStructureNV");
+    ReportStateMemoryUsage<vvl::AccelerationStructureKHR>(report, "AccelerationStructureKHR");
+    ReportStateMemoryUsage<vvl::IndirectExecutionSet>(report, "IndirectExecutionSet");
+    ReportStateMemoryUsage<vvl::IndirectCommandsLayout>(report, "IndirectCommandsLayout");
+}
+
 void DeviceState::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                              const RecordObject& record_obj) {
     if (!device) {
@@ -2292,6 +2343,9 @@ void DeviceState::PostCallRecordResetCommandPool(VkDevice device, VkCommandPool
     // Reset all of the CBs allocated from this pool
     if (auto pool = Get<CommandPool>(commandPool)) {
         pool->Reset(record_obj.location);
+        if (flags & VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT) {
+            pool->arena_block_cache->Trim();
+        }
     }
 }
 
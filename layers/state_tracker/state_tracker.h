@@ -25,9 +25,11 @@
 #include "chassis/validation_object.h"
 #include "utils/descriptor_utils.h"
 #include "utils/hash_vk_types.h"
-#include "state_tracker/descriptor_sets.h"      // DescriptorSetLayoutDict can't be forward declared
-#include "state_tracker/video_session_state.h"  // TODO - Remove from this header
+#include "state_tracker/descriptor_sets.h"         // DescriptorSetLayoutDict can't be forward declared
+#include "state_tracker/pipeline_library_state.h"  // PipelineSubStateCache can't be forward declared
+#include "state_tracker/video_session_state.h"     // TODO - Remove from this header
 #include "state_tracker/special_supported.h"
+#include "state_tracker/queue_retire_scheduler.h"
 #include "device_state.h"
 #include "chassis/dispatch_object.h"
 #include "error_message/logging.h"
@@ -557,6 +559,10 @@ class DeviceState : public vvl::BaseDevice {
     // Helper to clean up the state object maps in the correct order
     void DestroyObjectMaps();
 
+    // Adds the state objects of one type to the memory report
+    template <typename State>
+    void ReportStateMemoryUsage(MemoryReport& report, const char* category) const;
+
   public:
     DeviceState(DispatchDevice* dev, InstanceState* instance);
     ~DeviceState();
@@ -793,6 +799,7 @@ class DeviceState : public vvl::BaseDevice {
                                            const RecordObject& record_obj) override;
 
     virtual void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    void ReportMemoryUsage(MemoryReport& report) override;
 
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                     const RecordObject& record_obj) override;
@@ -2115,6 +2122,8 @@ class DeviceState : public vvl::BaseDevice {
         uint32_t queue_count;
     };
     std::vector<DeviceQueueInfo> device_queue_info_list;
+    // Retires queue submissions for all queues of this device. Must outlive the queues (see DestroyObjectMaps).
+    vvl::QueueRetireScheduler queue_retire_scheduler;
     // If vkGetBufferDeviceAddress is called, keep track of buffer <-> address mapping.
     BufferAddressRangeMap buffer_address_map_;
     mutable std::shared_mutex buffer_address_lock_;
@@ -2164,6 +2173,10 @@ class DeviceState : public vvl::BaseDevice {
     // Canonical ids of the set layouts created from *this* device.
     vvl::DescriptorSetLayoutDict descriptor_set_layout_canonical_ids_;
 
+    // Multisample, depth stencil and color blend states shared by the pipelines of *this* device.
+    // Mutable as the pipeline states only get a const DeviceState, the cache is thread safe.
+    mutable vvl::PipelineSubStateCache pipeline_sub_state_cache_;
+
     void UpdateCommandBufferHeapReservedAddressMap(vvl::CommandBuffer* cb_state, const vvl::range<VkDeviceAddress>& new_range,
                                                    bool is_sampler);
     void RemoveCommandBufferHeapReservedAddressMap(vvl::CommandBuffer* cb_state);
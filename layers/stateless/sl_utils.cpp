@@ -16,6 +16,7 @@
  * limitations under the License.
  */
 
+#include "containers/small_vector.h"
 #include "error_message/error_location.h"
 #include "stateless/stateless_validation.h"
 #include "sl_vuid_maps.h"
@@ -231,6 +232,26 @@ bool Context::ValidatePnextStructExtension(const Location& loc, const VkBaseOutS
     return skip;
 }
 
+// Brent's cycle detection, constant memory and no allocation no matter how long the chain is
+static bool PNextChainHasCycle(const VkBaseOutStructure* chain) {
+    const VkBaseOutStructure* anchor = chain;
+    const VkBaseOutStructure* current = chain;
+    uint32_t power = 1;
+    uint32_t length = 0;
+    while (current != nullptr) {
+        current = current->pNext;
+        if (current == anchor) {
+            return true;
+        }
+        if (++length == power) {
+            anchor = current;
+            power *= 2;
+            length = 0;
+        }
+    }
+    return false;
+}
+
 bool Context::ValidateStructPnext(const Location& loc, const void* next, size_t allowed_type_count,
                                   const VkStructureType* allowed_types, uint32_t header_version, const char* pnext_vuid,
                                   const char* stype_vuid, const bool is_const_param) const {
@@ -241,8 +262,8 @@ bool Context::ValidateStructPnext(const Location& loc, const void* next, size_t
     }
 
     if (next != nullptr) {
-        vvl::unordered_set<const void*> cycle_check;
-        vvl::unordered_set<VkStructureType, vvl::hash<int>> unique_stype_check;
+        // This runs for nearly every struct of every call, so avoid heap allocations for the typical short chain
+        small_vector<VkStructureType, 16> seen_stypes;
         const char* disclaimer =
             "This error is based on the Valid Usage documentation for version %" PRIu32
             " of the Vulkan header.\nIt is possible that "
@@ -260,16 +281,23 @@ bool Context::ValidateStructPnext(const Location& loc, const void* next, size_t
             const VkStructureType* end = allowed_types + allowed_type_count;
             const VkBaseOutStructure* current = reinterpret_cast<const VkBaseOutStructure*>(next);
 
+            if (PNextChainHasCycle(current)) {
+                // Nothing below (including printing the chain) would terminate
+                return log.LogError("UNASSIGNED-GeneralParameterError-pNextCycle", error_obj.handle, pNext_loc,
+                                    "chain contains a cycle, a structure points back to an earlier structure in the chain.");
+            }
+
             while (current != nullptr) {
                 if ((loc.function != Func::vkCreateInstance || (current->sType != VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO)) &&
                     (loc.function != Func::vkCreateDevice || (current->sType != VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO))) {
-                    if (unique_stype_check.find(current->sType) != unique_stype_check.end() && !IsDuplicatePnext(current->sType)) {
+                    if (std::find(seen_stypes.begin(), seen_stypes.end(), current->sType) != seen_stypes.end() &&
+                        !IsDuplicatePnext(current->sType)) {
                         // stype_vuid will only be null if there are no listed pNext and will hit disclaimer check
                         skip |= log.LogError(stype_vuid, error_obj.handle, pNext_loc,
                                              "chain contains duplicate structure types: %s appears multiple times.\n%s",
                                              string_VkStructureName(current->sType), PrintPNextChain(loc.structure, next).c_str());
                     } else {
-                        unique_stype_check.insert(current->sType);
+                        seen_stypes.emplace_back(current->sType);
                     }
 
                     if (std::find(start, end, current->sType) == end) {
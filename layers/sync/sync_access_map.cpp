@@ -16,6 +16,7 @@
  */
 
 #include "sync_access_map.h"
+#include "profiling/memory_report.h"
 
 namespace syncval {
 
@@ -34,6 +35,14 @@ AccessMap::const_iterator AccessMap::LowerBound(ResourceAddress range_begin) con
     return it;
 }
 
+size_t AccessMap::MemoryUsage() const {
+    size_t bytes = impl_map_.size() * (sizeof(value_type) + vvl::MemoryReport::kNodeOverhead);
+    for (const auto& entry : impl_map_) {
+        bytes += entry.second.HeapMemoryUsage();
+    }
+    return bytes;
+}
+
 AccessMap::iterator AccessMap::Erase(const iterator& pos) {
     assert(pos != end());
     return impl_map_.erase(pos);
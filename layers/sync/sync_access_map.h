@@ -72,6 +72,8 @@ class AccessMap {
     iterator LowerBound(ResourceAddress range_begin);
     const_iterator LowerBound(ResourceAddress range_begin) const;
     size_t Size() const { return impl_map_.size(); }
+    // Estimated memory of the map and of its access states
+    size_t MemoryUsage() const;
 
     void Clear() { impl_map_.clear(); }
     iterator Erase(const iterator& pos);
@@ -1032,6 +1032,17 @@ void AccessState::UpdateStats(AccessContextStats& stats) const {
 #endif
 }
 
+size_t AccessState::HeapMemoryUsage() const {
+    size_t bytes = 0;
+    if (last_read_count > 1) {
+        bytes += sizeof(ReadState) * last_read_count;
+    }
+    if (first_accesses_.size() > first_accesses_.kSmallCapacity) {
+        bytes += sizeof(FirstAccess) * first_accesses_.capacity();
+    }
+    return bytes;
+}
+
 bool AccessState::IsRAWHazard(const SyncAccessInfo& usage_info) const {
     assert(IsRead(usage_info.access_index));
     // Only RAW vs. last_write if it doesn't happen-after any other read because either:
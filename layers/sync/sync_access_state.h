@@ -446,6 +446,8 @@ class AccessState {
     void GatherReferencedTags(ResourceUsageTagSet& used) const;
 
     void UpdateStats(AccessContextStats& stats) const;
+    // Memory of the reads and first accesses not stored in the state itself
+    size_t HeapMemoryUsage() const;
 
   private:
     AccessState() = default;  // not accessible, use DefaultAccessState instead
@@ -282,6 +282,7 @@ CommandBufferContext::CommandBufferContext(const SyncValidator& sync_validator,
 CommandBufferContext::CommandBufferContext(SyncValidator& sync_validator, vvl::CommandBuffer* cb_state)
     : CommandBufferContext(sync_validator, cb_state->GetQueueFlags(), cb_state->Handle()) {
     cb_state_ = cb_state;
+    access_log_ = NewAccessLog();
     sync_state_.stats.AddCommandBufferContext();
 }
 
@@ -315,8 +316,16 @@ CommandBufferContext::~CommandBufferContext() {
     sync_state_.stats.RemoveHandleRecord((uint32_t)handles_.size());
 }
 
+// The previous log can still be referenced by submitted batches, a new one is started
+std::shared_ptr<AccessLog> CommandBufferContext::NewAccessLog() const {
+    if (cb_state_) {
+        return std::make_shared<AccessLog>(cb_state_->command_pool.arena_block_cache);
+    }
+    return std::make_shared<AccessLog>();
+}
+
 void CommandBufferContext::Reset() {
-    access_log_ = std::make_shared<AccessLog>();
+    access_log_ = NewAccessLog();
     cbs_referenced_ = std::make_shared<CommandBufferSet>();
     if (cb_state_) {
         cbs_referenced_->push_back(cb_state_->shared_from_this());
@@ -1391,7 +1400,7 @@ void CommandBufferContext::ResolveExecutedCommandBuffer(const AccessContext& rec
 
 void CommandBufferContext::ImportRecordedAccessLog(const CommandBufferContext& recorded_context) {
     cbs_referenced_->emplace_back(recorded_context.GetCBStateShared());
-    access_log_->insert(access_log_->end(), recorded_context.access_log_->cbegin(), recorded_context.access_log_->cend());
+    access_log_->Append(*recorded_context.access_log_);
 
     // Adjust command indices for the log records added from recorded_context.
     const auto& recorded_label_commands = recorded_context.cb_state_->GetLabelCommands();
@@ -1560,6 +1569,16 @@ void CommandBufferContext::UpdateStats(AccessStats& access_stats) const {
 #endif
 }
 
+size_t CommandBufferContext::AccessMapsMemoryUsage() const {
+    size_t bytes = cb_access_context_.GetAccessMap().MemoryUsage();
+    for (const auto& render_pass_context : render_pass_contexts_) {
+        for (const AccessContext& subpass_access_context : render_pass_context->GetSubpassContexts()) {
+            bytes += subpass_access_context.GetAccessMap().MemoryUsage();
+        }
+    }
+    return bytes;
+}
+
 CommandBufferSubState::CommandBufferSubState(SyncValidator& dev, vvl::CommandBuffer& cb)
     : vvl::CommandBufferSubState(cb), cb_context(dev, &cb) {
     cb_context.SetSelfReference();
@@ -154,7 +154,66 @@ struct ResourceUsageInfoProvider {
     virtual ResourceUsageInfo GetResourceUsageInfo(ResourceUsageTagEx tag_ex) const = 0;
 };
 
-using AccessLog = std::vector<ResourceUsageRecord>;
+// Usage records indexed by tag.
+// The records are stored in chunks taken from an arena, logging does not move the records already there. The log of a command
+// buffer takes its blocks from the command pool and gives them back when the last batch referencing it is gone, so recording
+// again reuses the memory of a previous recording instead of growing a vector on the heap.
+class AccessLog {
+  public:
+    static constexpr size_t kChunkSize = 32;
+
+    AccessLog() : arena_(kDefaultBlockSize), chunks_(vvl::ArenaAllocator<ResourceUsageRecord*>(arena_)) {}
+    explicit AccessLog(std::shared_ptr<vvl::ArenaBlockCache> block_cache)
+        : arena_(std::move(block_cache)), chunks_(vvl::ArenaAllocator<ResourceUsageRecord*>(arena_)) {}
+    AccessLog(const AccessLog& other) : AccessLog() { Append(other); }
+    AccessLog& operator=(const AccessLog&) = delete;
+    ~AccessLog() {
+        for (size_t index = 0; index < size_; index++) {
+            (*this)[index].~ResourceUsageRecord();
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    ResourceUsageRecord& operator[](size_t index) {
+        assert(index < size_);
+        return chunks_[index / kChunkSize][index % kChunkSize];
+    }
+    const ResourceUsageRecord& operator[](size_t index) const {
+        assert(index < size_);
+        return chunks_[index / kChunkSize][index % kChunkSize];
+    }
+    ResourceUsageRecord& back() { return (*this)[size_ - 1]; }
+    const ResourceUsageRecord& back() const { return (*this)[size_ - 1]; }
+
+    template <typename... Args>
+    ResourceUsageRecord& emplace_back(Args&&... args) {
+        if (size_ == chunks_.size() * kChunkSize) {
+            void* chunk = arena_.Allocate(sizeof(ResourceUsageRecord) * kChunkSize, alignof(ResourceUsageRecord));
+            chunks_.emplace_back(static_cast<ResourceUsageRecord*>(chunk));
+        }
+        ResourceUsageRecord* record =
+            new (chunks_[size_ / kChunkSize] + size_ % kChunkSize) ResourceUsageRecord(std::forward<Args>(args)...);
+        size_++;
+        return *record;
+    }
+
+    void Append(const AccessLog& other) {
+        for (size_t index = 0; index < other.size(); index++) {
+            emplace_back(other[index]);
+        }
+    }
+
+  private:
+    // For the logs not owned by a command buffer (present and acquire operations, proxy contexts)
+    static constexpr size_t kDefaultBlockSize = 4 * 1024;
+
+    vvl::Arena arena_;
+    vvl::ArenaVector<ResourceUsageRecord*> chunks_;
+    size_t size_ = 0;
+};
+
 using CommandBufferSet = std::vector<std::shared_ptr<const vvl::CommandBuffer>>;
 
 struct SyncEnvironment {
@@ -272,6 +331,8 @@ class CommandBufferContext final : public ResourceUsageInfoProvider, public Debu
     std::vector<vvl::LabelCommand>& GetProxyLabelCommands() { return proxy_label_commands_; }
 
     void UpdateStats(AccessStats& access_stats) const;
+    // Estimated memory of the access maps of the command buffer and of its subpasses
+    size_t AccessMapsMemoryUsage() const;
 
   private:
     CommandBufferContext(const SyncValidator& sync_validator, VkQueueFlags queue_flags, VulkanTypedHandle handle);
@@ -293,6 +354,8 @@ class CommandBufferContext final : public ResourceUsageInfoProvider, public Debu
 
     void CheckCommandTagDebugCheckpoint();
 
+    std::shared_ptr<AccessLog> NewAccessLog() const;
+
   private:
     const SyncValidator& sync_state_;
     const ErrorMessages& error_messages_;
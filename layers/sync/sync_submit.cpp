@@ -589,7 +589,6 @@ void QueueBatchContext::LogPresentOperations(const PresentedImages& presented_im
         batch.submit_index = submit_index;
         batch.base_tag = tag_range_.begin;
         batch_log_.Insert(batch, tag_range_, access_log);
-        access_log->reserve(tag_range_.size());
         assert(tag_range_.size() == presented_images.size());
         for (const auto& presented : presented_images) {
             access_log->emplace_back(PresentResourceRecord(static_cast<const PresentedImageRecord>(presented)));
@@ -24,6 +24,8 @@
 #include "sync/sync_validation.h"
 #include "sync/sync_event.h"
 #include "sync/sync_image.h"
+#include "profiling/api_timing.h"
+#include "profiling/memory_report.h"
 #include "state_tracker/buffer_state.h"
 #include "state_tracker/ray_tracing_state.h"
 #include "state_tracker/render_pass_state.h"
@@ -701,6 +703,26 @@ void SyncValidator::FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, con
     text::ToLower(debug_cmdbuf_pattern);
 }
 
+void SyncValidator::ReportMemoryUsage(vvl::MemoryReport& report) {
+    const char* owner = vvl::String(container_type);
+
+    uint64_t cb_count = 0;
+    uint64_t cb_bytes = 0;
+    device_state->ForEachShared<vvl::CommandBuffer>([&cb_count, &cb_bytes](const std::shared_ptr<vvl::CommandBuffer>& cb) {
+        auto guard = cb->ReadLock();
+        cb_bytes += GetCommandBufferContext(*cb).AccessMapsMemoryUsage();
+        cb_count++;
+    });
+    report.Add(owner, "CommandBufferAccessMaps", cb_count, cb_bytes);
+
+    const std::vector<BatchContextPtr> batches = GetAllQueueBatchContexts();
+    uint64_t batch_bytes = 0;
+    for (const auto& batch : batches) {
+        batch_bytes += batch->GetAccessContext().GetAccessMap().MemoryUsage();
+    }
+    report.Add(owner, "QueueBatchAccessMaps", batches.size(), batch_bytes);
+}
+
 void SyncValidator::PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                                const RecordObject& record_obj) {
     queue_states_.clear();
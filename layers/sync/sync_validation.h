@@ -129,6 +129,7 @@ class SyncValidator : public vvl::DeviceProxy {
                                           const RecordObject& record_obj) override;
 
     void FinishDeviceSetup(const VkDeviceCreateInfo* pCreateInfo, const Location& loc) override;
+    void ReportMemoryUsage(vvl::MemoryReport& report) override;
 
     void PreCallRecordDestroyDevice(VkDevice device, const VkAllocationCallbacks* pAllocator,
                                     const RecordObject& record_obj) override;
@@ -98,6 +98,114 @@ ThreadInfo GetThreadInfo(uint32_t internal_thread_id) {
     return it != thread_id_map.end() ? it->second : ThreadInfo{};
 }
 
+namespace epoch {
+
+// 0 is reserved as the "not in a critical section" announcement
+static std::atomic<uint64_t> global_epoch{1};
+
+// One record per live thread that ever entered a critical section. Records are never freed, a thread that exits
+// hands its record over to the next new thread, so the list is as long as the peak number of threads.
+struct alignas(kObjectUseDataAlignment) ThreadRecord {
+    std::atomic<uint64_t> active_epoch{0};
+    std::atomic<bool> in_use{true};
+    ThreadRecord* next = nullptr;
+};
+static std::atomic<ThreadRecord*> thread_records{nullptr};
+
+static ThreadRecord* AcquireThreadRecord() {
+    for (ThreadRecord* record = thread_records.load(); record; record = record->next) {
+        bool expected = false;
+        if (!record->in_use.load(std::memory_order_relaxed) && record->in_use.compare_exchange_strong(expected, true)) {
+            return record;
+        }
+    }
+    auto* record = new ThreadRecord();
+    record->next = thread_records.load();
+    while (!thread_records.compare_exchange_weak(record->next, record)) {
+    }
+    return record;
+}
+
+struct ThreadRecordOwner {
+    ThreadRecord* record = AcquireThreadRecord();
+    ~ThreadRecordOwner() {
+        record->active_epoch.store(0);
+        record->in_use.store(false);
+    }
+};
+
+static ThreadRecord& GetThreadRecord() {
+    thread_local ThreadRecordOwner owner;
+    return *owner.record;
+}
+
+void Enter() {
+    // Sequentially consistent store: the announcement must be visible before this thread reads any object table
+    GetThreadRecord().active_epoch.store(global_epoch.load());
+}
+
+void Exit() { GetThreadRecord().active_epoch.store(0); }
+
+uint64_t Retire() { return global_epoch.fetch_add(1); }
+
+uint64_t MinActive() {
+    uint64_t min_epoch = UINT64_MAX;
+    for (ThreadRecord* record = thread_records.load(); record; record = record->next) {
+        const uint64_t active_epoch = record->active_epoch.load();
+        if (active_epoch != 0 && active_epoch < min_epoch) {
+            min_epoch = active_epoch;
+        }
+    }
+    return min_epoch;
+}
+
+}  // namespace epoch
+
+void ObjectUseDataSlab::Shard::ReclaimRetired() {
+    const uint64_t min_active_epoch = epoch::MinActive();
+    // Destroys from several threads can land in this shard, so the retired list is only mostly ordered by epoch
+    while (!retired_slots.empty() && retired_slots.front().epoch < min_active_epoch) {
+        free_slots.push_back(retired_slots.front().use_data);
+        retired_slots.pop_front();
+    }
+}
+
+ObjectUseData* ObjectUseDataSlab::Allocate() {
+    const uint32_t shard_index = GetCurrentInternalThreadId() % kShardCount;
+    Shard& shard = shards_[shard_index];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    if (shard.free_slots.empty() && !shard.retired_slots.empty()) {
+        shard.ReclaimRetired();
+    }
+    ObjectUseData* use_data = nullptr;
+    if (!shard.free_slots.empty()) {
+        use_data = shard.free_slots.back();
+        shard.free_slots.pop_back();
+        use_data->Reset();
+    } else {
+        if (shard.block_used == kBlockSize) {
+            shard.blocks.emplace_back(std::make_unique<ObjectUseData[]>(kBlockSize));
+            shard.block_used = 0;
+        }
+        use_data = &shard.blocks.back()[shard.block_used++];
+        use_data->slab_shard = shard_index;
+    }
+    return use_data;
+}
+
+void ObjectUseDataSlab::Retire(ObjectUseData* use_data) {
+    // The caller already removed the slot from its object table
+    const uint64_t retire_epoch = epoch::Retire();
+    Shard& shard = shards_[use_data->slab_shard];
+    std::lock_guard<std::mutex> guard(shard.lock);
+    shard.retired_slots.push_back({retire_epoch, use_data});
+}
+
+ThreadUseFrame& ThreadUseFrame::Get() {
+    thread_local ThreadUseFrame frame;
+    return frame;
+}
+
 ReadLockGuard Device::ReadLock() const { return ReadLockGuard(validation_object_mutex, std::defer_lock); }
 
 WriteLockGuard Device::WriteLock() { return WriteLockGuard(validation_object_mutex, std::defer_lock); }
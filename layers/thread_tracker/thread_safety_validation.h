@@ -19,10 +19,15 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #include "chassis/validation_object.h"
+#include "utils/cast_utils.h"
 
 namespace threadsafety {
 
@@ -102,14 +107,126 @@ class alignas(kObjectUseDataAlignment) ObjectUseData {
 
     uint32_t GetStoredInternalThreadId() const { return thread_and_func.load() & 0xffffffff; }
 
+    // Return to the "no current use" state before the slot is handed out for a new object
+    void Reset() {
+        thread_and_func.store(0);
+        writer_reader_count.store(0);
+    }
+
     // 32-bit internal thread id and vvl::Func
     std::atomic<uint64_t> thread_and_func{};
 
+    // Shard of the ObjectUseDataSlab the slot was carved from, Reset() keeps it
+    uint32_t slab_shard = 0;
+
   private:
     // Need to update write and read counts atomically. Writer in high 32 bits, reader in low 32 bits.
     std::atomic<uint64_t> writer_reader_count{};
 };
 
+// Epoch based reclamation for ObjectUseData slots.
+// A thread is inside a critical section while it holds ObjectUseData pointers it got from an object table. On entry
+// it announces the global epoch it observed. A slot removed from the table at epoch E can only be reused once every
+// thread inside a critical section announced an epoch greater than E, because those threads entered after the slot
+// was unreachable. Threads outside a critical section never hold a pointer, so they don't delay reclamation.
+namespace epoch {
+void Enter();
+void Exit();
+// Advance the global epoch and return the epoch an object removed from its table just before belongs to
+uint64_t Retire();
+// Smallest epoch announced by a thread inside a critical section, or UINT64_MAX if there is none
+uint64_t MinActive();
+}  // namespace epoch
+
+// Stable-address storage for ObjectUseData.
+// Slots are carved out of fixed size blocks that are never moved or freed while the owning Counter is alive,
+// so the object table can hand out raw pointers and StartRead/StartWrite/FinishRead/FinishWrite don't pay for
+// shared_ptr reference counting on every call.
+//
+// A slot released by DestroyObject is only recycled once no thread can still be using it (see epoch above). If the
+// app races a use of the handle against its destruction (which is what we are here to report), the late Finish* call
+// still lands on the retired slot instead of the use data of an unrelated new object.
+//
+// Creates pick the shard of the calling thread and destroys return the slot to the shard it came from, so threads
+// creating and destroying their own objects don't serialize on one lock.
+class ObjectUseDataSlab {
+  public:
+    ObjectUseDataSlab() = default;
+    ObjectUseDataSlab(const ObjectUseDataSlab&) = delete;
+    ObjectUseDataSlab& operator=(const ObjectUseDataSlab&) = delete;
+
+    ObjectUseData* Allocate();
+    void Retire(ObjectUseData* use_data);
+
+  private:
+    static constexpr uint32_t kBlockSize = 256;
+    static constexpr uint32_t kShardCount = 8;
+
+    struct RetiredSlot {
+        uint64_t epoch;
+        ObjectUseData* use_data;
+    };
+
+    struct alignas(kObjectUseDataAlignment) Shard {
+        std::mutex lock;
+        std::vector<std::unique_ptr<ObjectUseData[]>> blocks;
+        uint32_t block_used = kBlockSize;
+        std::vector<ObjectUseData*> free_slots;
+        std::deque<RetiredSlot> retired_slots;
+
+        void ReclaimRetired();
+    };
+
+    Shard shards_[kShardCount];
+};
+
+// The ObjectUseData found by each Start* of the API call the thread is in, so the matching Finish* doesn't have to
+// look the object up again. Holding any entry keeps the thread inside an epoch critical section.
+class ThreadUseFrame {
+  public:
+    static ThreadUseFrame& Get();
+
+    // Pin/Unpin nest, the thread leaves the critical section when the last pin is released
+    void Pin() {
+        if (pin_count_++ == 0) {
+            epoch::Enter();
+        }
+    }
+    void Unpin() {
+        assert(pin_count_ > 0);
+        if (--pin_count_ == 0) {
+            epoch::Exit();
+        }
+    }
+
+    // Takes over one pin of the caller until the entry is popped
+    void Push(const void* counter, uint64_t object, ObjectUseData* use_data) { entries_.push_back({counter, object, use_data}); }
+
+    // Returns nullptr if Start* didn't find the object, otherwise the caller owns the pin of the entry
+    ObjectUseData* Pop(const void* counter, uint64_t object) {
+        for (size_t i = entries_.size(); i-- > 0;) {
+            if (entries_[i].counter == counter && entries_[i].object == object) {
+                ObjectUseData* use_data = entries_[i].use_data;
+                entries_[i] = entries_.back();
+                entries_.pop_back();
+                return use_data;
+            }
+        }
+        return nullptr;
+    }
+
+  private:
+    ThreadUseFrame() { entries_.reserve(16); }
+
+    struct Entry {
+        const void* counter;
+        uint64_t object;
+        ObjectUseData* use_data;
+    };
+    std::vector<Entry> entries_;
+    uint32_t pin_count_ = 0;
+};
+
 template <typename T>
 class Counter {
   public:
@@ -118,11 +235,20 @@ class Counter {
         this->logger = logger;
     }
 
-    void CreateObject(T object) { object_table.insert(object, std::make_shared<ObjectUseData>()); }
+    void CreateObject(T object) {
+        ObjectUseData* use_data = use_data_slab.Allocate();
+        if (!object_table.insert(object, use_data)) {
+            // Already tracked (e.g. display handles returned again by a query)
+            use_data_slab.Retire(use_data);
+        }
+    }
 
     void DestroyObject(T object) {
         if (object) {
-            object_table.erase(object);
+            auto iter = object_table.pop(object);
+            if (iter != object_table.end()) {
+                use_data_slab.Retire(iter->second);
+            }
         }
     }
 
@@ -130,10 +256,14 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
+        ThreadUseFrame& frame = ThreadUseFrame::Get();
+        frame.Pin();
+        ObjectUseData* use_data = FindObject(object, loc);
         if (!use_data) {
+            frame.Unpin();
             return;
         }
+        frame.Push(this, CastToUint64(object), use_data);
         const uint32_t current_internal_tid = GetCurrentInternalThreadId();
         const auto [prev_read, prev_write] = use_data->AddWriter();
 
@@ -152,19 +282,31 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        if (auto use_data = FindObject(object, loc)) {
+        ThreadUseFrame& frame = ThreadUseFrame::Get();
+        if (ObjectUseData* use_data = frame.Pop(this, CastToUint64(object))) {
+            use_data->RemoveWriter();
+            frame.Unpin();
+            return;
+        }
+        frame.Pin();
+        if (ObjectUseData* use_data = FindObject(object, loc)) {
             use_data->RemoveWriter();
         }
+        frame.Unpin();
     }
 
     void StartRead(T object, const Location& loc) {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        auto use_data = FindObject(object, loc);
+        ThreadUseFrame& frame = ThreadUseFrame::Get();
+        frame.Pin();
+        ObjectUseData* use_data = FindObject(object, loc);
         if (!use_data) {
+            frame.Unpin();
             return;
         }
+        frame.Push(this, CastToUint64(object), use_data);
         const uint32_t current_internal_tid = GetCurrentInternalThreadId();
         const auto [prev_read, prev_write] = use_data->AddReader();
 
@@ -184,13 +326,21 @@ class Counter {
         if (object == VK_NULL_HANDLE) {
             return;
         }
-        if (auto use_data = FindObject(object, loc)) {
+        ThreadUseFrame& frame = ThreadUseFrame::Get();
+        if (ObjectUseData* use_data = frame.Pop(this, CastToUint64(object))) {
+            use_data->RemoveReader();
+            frame.Unpin();
+            return;
+        }
+        frame.Pin();
+        if (ObjectUseData* use_data = FindObject(object, loc)) {
             use_data->RemoveReader();
         }
+        frame.Unpin();
     }
 
   private:
-    std::shared_ptr<ObjectUseData> FindObject(T object, const Location& loc) {
+    ObjectUseData* FindObject(T object, const Location& loc) {
         assert(object_table.contains(object));
         auto iter = object_table.find(object);
         if (iter != object_table.end()) {
@@ -204,7 +354,7 @@ class Counter {
         }
     }
 
-    void ReportError(const char* vuid, const std::shared_ptr<ObjectUseData>& use_data, T object, const Location& loc) {
+    void ReportError(const char* vuid, const ObjectUseData* use_data, T object, const Location& loc) {
         const uint64_t value = use_data->thread_and_func.load();
         const uint32_t other_internal_tid = value & 0xffffffff;
         const vvl::Func other_func = static_cast<vvl::Func>(value >> 32);
@@ -240,7 +390,8 @@ class Counter {
   private:
     VulkanObjectType object_type{};
     Logger* logger{};
-    vvl::concurrent_unordered_map<T, std::shared_ptr<ObjectUseData>, 6> object_table;
+    ObjectUseDataSlab use_data_slab;
+    vvl::concurrent_unordered_map<T, ObjectUseData*, 6> object_table;
 };
 
 #define WRAPPER(type)                                                                               \
@@ -18,12 +18,16 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string_view>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 #include "containers/custom_containers.h"
 
@@ -157,6 +161,72 @@ class Dictionary {
     Dict dict;
 };
 
+// Like Dictionary, but only holds weak references: an entry goes away with the last user of its value, so the dictionary doesn't
+// keep every value ever seen alive.
+//
+// LookUp takes a key that Hasher and KeyEqual can use as is (for instance the Vulkan struct a safe struct is made from), and only
+// calls |make| to build the value when there is no match. A hit doesn't allocate and only takes the lock in shared mode.
+// KeyEqual is called as KeyEqual()(value, key).
+template <typename T, typename Hasher, typename KeyEqual>
+class WeakDictionary {
+  public:
+    using Def = T;
+    using Id = std::shared_ptr<const Def>;
+
+    template <typename Key, typename Make>
+    Id LookUp(const Key &key, Make &&make) {
+        const size_t hash = Hasher()(key);
+        {
+            std::shared_lock<std::shared_mutex> guard(lock);
+            if (Id id = Find(hash, key)) {
+                return id;
+            }
+        }
+        Id from_input = make();
+        std::unique_lock<std::shared_mutex> guard(lock);
+        // Another thread may have added the same value while we were building ours
+        if (Id id = Find(hash, key)) {
+            return id;
+        }
+        // Expired entries are dropped once the dictionary had as many inserts as it has entries
+        if (++inserts_since_purge > std::max<size_t>(kMinPurgeInterval, dict.size())) {
+            Purge();
+        }
+        dict.emplace(hash, from_input);
+        return from_input;
+    }
+
+    size_t Size() const {
+        std::shared_lock<std::shared_mutex> guard(lock);
+        return dict.size();
+    }
+
+  private:
+    static constexpr size_t kMinPurgeInterval = 64;
+
+    template <typename Key>
+    Id Find(size_t hash, const Key &key) const {
+        const auto [begin, end] = dict.equal_range(hash);
+        for (auto it = begin; it != end; ++it) {
+            if (Id id = it->second.lock(); id && KeyEqual()(*id, key)) {
+                return id;
+            }
+        }
+        return nullptr;
+    }
+
+    void Purge() {
+        for (auto it = dict.begin(); it != dict.end();) {
+            it = it->second.expired() ? dict.erase(it) : std::next(it);
+        }
+        inserts_since_purge = 0;
+    }
+
+    mutable std::shared_mutex lock;
+    std::unordered_multimap<size_t, std::weak_ptr<const Def>> dict;
+    size_t inserts_since_purge = 0;
+};
+
 uint32_t VuidHash(std::string_view vuid);
 
 uint32_t Hash32(const void *info, const size_t info_size);
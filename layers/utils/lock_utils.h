@@ -18,7 +18,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <vulkan/utility/vk_concurrent_unordered_map.hpp>
 
@@ -38,3 +43,47 @@ class LockedSharedPtr : public std::shared_ptr<T> {
   private:
     Guard guard_;
 };
+
+namespace vvl {
+
+// A value that only moves forward and that threads can block on until it reaches a target.
+// One counter per object stands in for a std::promise/std::shared_future pair per event
+// (per queue submission, per semaphore timepoint): advancing it does not allocate and
+// waiters on any target value share the same condition variable.
+class WaitableCounter {
+  public:
+    explicit WaitableCounter(uint64_t initial_value = 0) : value_(initial_value) {}
+    WaitableCounter(const WaitableCounter &) = delete;
+    WaitableCounter &operator=(const WaitableCounter &) = delete;
+
+    uint64_t Load() const { return value_.load(std::memory_order_acquire); }
+
+    // Raise the value to at least new_value and wake up waiters. Never lowers the value.
+    void Advance(uint64_t new_value) {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            if (new_value <= value_.load(std::memory_order_relaxed)) {
+                return;
+            }
+            value_.store(new_value, std::memory_order_release);
+        }
+        cond_.notify_all();
+    }
+
+    // Returns false if the deadline was hit before the value reached target
+    template <typename Clock, typename Duration>
+    bool WaitUntil(uint64_t target, const std::chrono::time_point<Clock, Duration> &deadline) {
+        if (Load() >= target) {
+            return true;
+        }
+        std::unique_lock<std::mutex> guard(lock_);
+        return cond_.wait_until(guard, deadline, [this, target]() { return value_.load(std::memory_order_relaxed) >= target; });
+    }
+
+  private:
+    std::atomic<uint64_t> value_;
+    std::mutex lock_;
+    std::condition_variable cond_;
+};
+
+}  // namespace vvl
@@ -0,0 +1,119 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/thread_pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "profiling/profiling.h"
+
+vvl::ThreadPool::ThreadPool(uint32_t thread_count) {
+    if (thread_count == 0) {
+        // The thread calling ParallelFor also runs tasks, leave a hardware thread for it.
+        // Upper limit is to not end up with dozens of mostly idle threads on large machines.
+        const uint32_t hardware_threads = std::thread::hardware_concurrency();
+        thread_count = std::clamp(hardware_threads, 2u, 9u) - 1;
+    }
+    workers_.reserve(thread_count);
+    for (uint32_t i = 0; i < thread_count; i++) {
+        workers_.emplace_back(&ThreadPool::WorkerFunc, this);
+    }
+}
+
+vvl::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        assert(jobs_.empty());
+        exit_ = true;
+    }
+    work_cond_.notify_all();
+    for (std::thread &worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+bool vvl::ThreadPool::ClaimIndex(Job &job, uint32_t &index) {
+    if (job.next_index >= job.count) {
+        return false;
+    }
+    index = job.next_index++;
+    if (job.next_index == job.count) {
+        // Nothing left for the workers to pick up
+        jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));
+    }
+    return true;
+}
+
+void vvl::ThreadPool::FinishIndex(Job &job) {
+    job.finished_count++;
+    if (job.finished_count == job.count) {
+        done_cond_.notify_all();
+    }
+}
+
+void vvl::ThreadPool::ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1 || workers_.empty()) {
+        for (uint32_t i = 0; i < count; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    Job job;
+    job.func = &func;
+    job.count = count;
+
+    std::unique_lock<std::mutex> guard(lock_);
+    jobs_.push_back(&job);
+    work_cond_.notify_all();
+
+    uint32_t index = 0;
+    while (ClaimIndex(job, index)) {
+        guard.unlock();
+        func(index);
+        guard.lock();
+        FinishIndex(job);
+    }
+    // The job lives on our stack, the workers must be done with it before we return
+    done_cond_.wait(guard, [&job]() { return job.finished_count == job.count; });
+}
+
+void vvl::ThreadPool::WorkerFunc() {
+    VVL_TracySetThreadName("ThreadPoolWorker");
+
+    std::unique_lock<std::mutex> guard(lock_);
+    while (true) {
+        work_cond_.wait(guard, [this]() { return exit_ || !jobs_.empty(); });
+        if (exit_) {
+            return;
+        }
+        Job &job = *jobs_.front();
+        uint32_t index = 0;
+        [[maybe_unused]] const bool claimed = ClaimIndex(job, index);
+        assert(claimed);  // jobs_ only has jobs with unclaimed indices
+
+        guard.unlock();
+        (*job.func)(index);
+        guard.lock();
+        FinishIndex(job);
+    }
+}
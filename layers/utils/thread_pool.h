@@ -0,0 +1,70 @@
+/* Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vvl {
+
+// Fixed set of worker threads to split CPU heavy validation into independent tasks.
+// Several threads can call ParallelFor at the same time, their tasks share the workers.
+class ThreadPool {
+  public:
+    // thread_count of zero picks a count based on the number of hardware threads
+    explicit ThreadPool(uint32_t thread_count = 0);
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ~ThreadPool();
+
+    // Calls func(i) for every i in [0, count) and returns when all calls are done.
+    // The calling thread runs tasks too, so a busy pool can't stall the caller.
+    void ParallelFor(uint32_t count, const std::function<void(uint32_t)> &func);
+
+    uint32_t ThreadCount() const { return static_cast<uint32_t>(workers_.size()); }
+
+  private:
+    struct Job {
+        const std::function<void(uint32_t)> *func = nullptr;
+        uint32_t count = 0;
+        // guarded by lock_
+        uint32_t next_index = 0;
+        uint32_t finished_count = 0;
+    };
+
+    void WorkerFunc();
+    // lock_ must be held. Returns false if all indices of the job are already claimed.
+    bool ClaimIndex(Job &job, uint32_t &index);
+    // lock_ must be held
+    void FinishIndex(Job &job);
+
+    std::mutex lock_;
+    // wakes up workers when a job is added
+    std::condition_variable work_cond_;
+    // wakes up ParallelFor callers when a task of their job is finished
+    std::condition_variable done_cond_;
+    // Jobs that still have unclaimed indices
+    std::deque<Job *> jobs_;
+    std::vector<std::thread> workers_;
+    bool exit_ = false;
+};
+
+}  // namespace vvl
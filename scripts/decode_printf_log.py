@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 The Khronos Group Inc.
+# Copyright (c) 2026 Valve Corporation
+# Copyright (c) 2026 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Turns the file written with the printf_binary_log_file setting into the text DebugPrintf would have printed.
+# The file layout is documented with the BinaryLog class in layers/gpuav/debug_printf/debug_printf.cpp
+
+import argparse
+import re
+import struct
+import sys
+
+BINARY_LOG_MAGIC = 0x504C5656
+BINARY_LOG_VERSION = 1
+CHUNK_FORMAT_STRING = 1
+CHUNK_RECORDS = 2
+
+# Matches OutputRecord in debug_printf.cpp
+RECORD_SIZE_OFFSET = 0
+RECORD_SHADER_ID_OFFSET = 1
+RECORD_FORMAT_STRING_ID_OFFSET = 6
+RECORD_DOUBLE_BITMASK_OFFSET = 7
+RECORD_SIGNED_8_BITMASK_OFFSET = 8
+RECORD_SIGNED_16_BITMASK_OFFSET = 9
+RECORD_VALUES_OFFSET = 10
+
+FLOAT_TYPES = 'fFaAeEgG'
+SINT_TYPES = 'di'
+
+class Substring:
+    def __init__(self, string, needs_value=False, type='', is_64_bit=False, is_pointer=False):
+        self.string = string
+        self.needs_value = needs_value
+        self.type = type  # 'f', 's' or 'u'
+        self.is_64_bit = is_64_bit
+        self.is_pointer = is_pointer
+
+def NumericType(specifier):
+    if specifier in SINT_TYPES:
+        return 's'
+    if specifier in FLOAT_TYPES:
+        return 'f'
+    return 'u'
+
+# Same splitting as ParseFormatString() in debug_printf.cpp, each substring prints at most one value
+def ParseFormatString(format_string):
+    types = 'dioxXaAeEfFgGvpu'
+    parsed = []
+    pos = 0
+    begin = 0
+    length = len(format_string)
+    while begin < length:
+        percent = format_string.find('%', pos)
+        if percent == -1:
+            parsed.append(Substring(format_string[begin:]))
+            break
+        pos = percent + 1
+        if pos < length and format_string[pos] == '%':
+            pos += 1
+            continue
+        type_pos = next((i for i in range(pos, length) if format_string[i] in types), -1)
+        if type_pos == -1:
+            pos = length
+            continue
+        pos = type_pos
+        if format_string[pos] == 'v':
+            specifier = format_string[percent:pos]
+            vec_size = int(format_string[pos + 1])
+            pos += 2
+            specifier += format_string[pos]
+            is_64_bit = False
+            if pos + 1 < length and format_string[pos + 1] == 'l':
+                is_64_bit = True
+                specifier += 'l'
+                pos += 1
+            elif format_string[pos] == 'l':
+                is_64_bit = True
+                specifier += format_string[pos + 1]
+                pos += 1
+            numeric_type = NumericType(specifier[-1])
+            parsed.append(Substring(format_string[begin:percent] + specifier, True, numeric_type, is_64_bit))
+            for _ in range(vec_size - 1):
+                parsed.append(Substring(', ' + specifier, True, numeric_type, is_64_bit))
+        else:
+            is_64_bit = False
+            is_pointer = False
+            if format_string[pos - 1] == 'l':
+                is_64_bit = True
+            elif pos + 1 < length and format_string[pos + 1] == 'l':
+                is_64_bit = True
+                pos += 1
+            if format_string[pos] == 'p':
+                is_64_bit = True
+                is_pointer = True
+            # the type is looked up at the final position, which is the 'l' of "%ul"
+            parsed.append(Substring(format_string[begin:pos + 1], True, NumericType(format_string[pos]), is_64_bit, is_pointer))
+        begin = pos + 1
+    return parsed
+
+SPECIFIER = re.compile(r'%%|%([-+ #0]*[0-9]*(?:\.[0-9]*)?)(l?)v?[0-9]?(l?)([diouxXaAeEfFgGp])(l?)')
+
+# Formats a substring with a single value like snprintf does in the layer
+def FormatSubstring(substring, value):
+    if not substring.needs_value:
+        return substring.string.replace('%%', '%')
+    match = None
+    for m in SPECIFIER.finditer(substring.string):
+        if m.group(0) != '%%':
+            match = m
+            break
+    if match is None:
+        return substring.string.replace('%%', '%')
+    prefix = substring.string[:match.start()].replace('%%', '%')
+    suffix = substring.string[match.end():].replace('%%', '%')
+    flags, _, _, conversion, trailing_l = match.groups()
+
+    if conversion == 'p':
+        text = '0x%x' % value
+    elif conversion in 'aA':
+        text = float(value).hex()
+        text = text.upper() if conversion == 'A' else text
+    else:
+        # The layer prints "%ul" with PRIx64
+        if conversion == 'u' and trailing_l and substring.is_64_bit:
+            conversion = 'x'
+        if conversion in 'ui':
+            conversion = 'd'
+        text = ('%' + flags + conversion) % value
+    return prefix + text + suffix
+
+def ReadValue(substring, substring_i, record, value_i):
+    dword = record[value_i]
+    if substring.type == 'f':
+        if record[RECORD_DOUBLE_BITMASK_OFFSET] & (1 << substring_i):
+            return struct.unpack('<d', struct.pack('<II', dword, record[value_i + 1]))[0], 2
+        return struct.unpack('<f', struct.pack('<I', dword))[0], 1
+    if substring.is_64_bit:
+        value = dword | (record[value_i + 1] << 32)
+        if substring.type == 's' and value >= (1 << 63):
+            value -= 1 << 64
+        return value, 2
+    if substring.type == 's':
+        if record[RECORD_SIGNED_8_BITMASK_OFFSET] & (1 << substring_i):
+            return struct.unpack('<b', struct.pack('<B', dword & 0xFF))[0], 1
+        if record[RECORD_SIGNED_16_BITMASK_OFFSET] & (1 << substring_i):
+            return struct.unpack('<h', struct.pack('<H', dword & 0xFFFF))[0], 1
+        return struct.unpack('<i', struct.pack('<I', dword))[0], 1
+    return dword, 1
+
+def DecodeRecord(record, format_strings, parsed_cache):
+    key = (record[RECORD_SHADER_ID_OFFSET], record[RECORD_FORMAT_STRING_ID_OFFSET])
+    if key not in parsed_cache:
+        parsed_cache[key] = ParseFormatString(format_strings.get(key, ''))
+    message = ''
+    value_i = RECORD_VALUES_OFFSET
+    for substring_i, substring in enumerate(parsed_cache[key]):
+        if substring.needs_value:
+            value, dwords = ReadValue(substring, substring_i, record, value_i)
+            value_i += dwords
+            message += FormatSubstring(substring, value)
+        else:
+            message += FormatSubstring(substring, None)
+    return message
+
+def Decode(data, out):
+    words = struct.unpack('<%dI' % (len(data) // 4), data[:len(data) // 4 * 4])
+    if len(words) < 2 or words[0] != BINARY_LOG_MAGIC:
+        sys.exit('Not a DebugPrintf binary log')
+    if words[1] != BINARY_LOG_VERSION:
+        sys.exit(f'Unsupported DebugPrintf binary log version {words[1]}')
+
+    format_strings = {}
+    parsed_cache = {}
+    i = 2
+    while i < len(words):
+        chunk = words[i]
+        if chunk == CHUNK_FORMAT_STRING:
+            shader_id, string_id, byte_length = words[i + 1:i + 4]
+            start = (i + 4) * 4
+            format_strings[(shader_id, string_id)] = data[start:start + byte_length].decode('utf-8', errors='replace')
+            i += 4 + (byte_length + 3) // 4
+        elif chunk == CHUNK_RECORDS:
+            dword_count = words[i + 1]
+            records = words[i + 2:i + 2 + dword_count]
+            record_i = 0
+            while record_i < len(records) and records[record_i + RECORD_SIZE_OFFSET]:
+                size = records[record_i + RECORD_SIZE_OFFSET]
+                out.write(DecodeRecord(records[record_i:record_i + size], format_strings, parsed_cache))
+                record_i += size
+            i += 2 + dword_count
+        else:
+            sys.exit(f'Unknown chunk {chunk} at byte offset {i * 4}, the file might be truncated')
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Decode a DebugPrintf binary log (printf_binary_log_file setting)')
+    parser.add_argument('file', help='Binary log written by the validation layer')
+    parser.add_argument('--output', help='Write the messages to this file instead of stdout')
+    args = parser.parse_args(argv)
+
+    with open(args.file, 'rb') as f:
+        data = f.read()
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8') as out:
+            Decode(data, out)
+    else:
+        Decode(data, sys.stdout)
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -243,6 +243,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
             #include "layer_options.h"
 
             #include "profiling/profiling.h"
+            #include "profiling/api_timing.h"
 
             ''')
 
@@ -344,7 +345,33 @@ class LayerChassisOutputGenerator(BaseGenerator):
             # Generate pre-call validation source code
             dispatch = 'device_dispatch' if not command.instance else 'instance_dispatch'
             out.append(f'{{\nVVL_ZoneScopedN("PreCallValidate_{command.name}");')
-            if not command.instance:
+            # With parallel_submit_validation the validation objects validate the submit concurrently
+            parallel_validate = "QueueSubmit" in command.name
+            if parallel_validate:
+                out.append(f'''
+                    if ({dispatch}->submit_validation_pool) {{
+                        skip = {dispatch}->ValidateInParallel({dispatch}->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}],
+                                                              [&](vvl::BaseDevice& vo) {{
+                            auto lock = vo.ReadLock();
+                            vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::{command.name}, vo.container_type);
+                            return vo.PreCallValidate{command.name[2:]}({paramsList}, error_obj);
+                        }});
+                        if (skip) {return_map[command.returnType]}
+                    }} else {{
+                ''')
+            # With validation_sampling_period the expensive validation objects skip the commands of the recordings that were not
+            # sampled, the others validate every recording
+            sampled_validate = command.name.startswith('vkCmd') or command.name == 'vkEndCommandBuffer'
+            if sampled_validate:
+                out.append(f'''
+                           const bool sampled = {dispatch}->IsValidationSampled({command.params[0].name});
+                           for (const auto& vo : {dispatch}->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{
+                                if (!vo || (!sampled && vvl::DispatchDevice::IsSampledValidationObject(*vo))) {{
+                                    continue;
+                                }}
+                                auto lock = vo->ReadLock();
+                            ''')
+            elif not command.instance:
                 out.append(f'''
                            for (const auto& vo : {dispatch}->intercept_vectors[InterceptIdPreCallValidate{command.name[2:]}]) {{
                                 if (!vo) {{
@@ -360,9 +387,12 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 }}
                             ''')
 
+            out.append(f'vvl::ApiTimer timer(vvl::ApiTimer::PreCallValidate, vvl::Func::{command.name}, vo->container_type);\n')
             out.append(f'skip |= vo->PreCallValidate{command.name[2:]}({paramsList}, error_obj);\n')
             out.append(f'if (skip) {return_map[command.returnType]}\n')
             out.append('   }\n')
+            if parallel_validate:
+                out.append('}\n')
             out.append('}\n')
 
             # Generate pre-call state recording source code
@@ -389,6 +419,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                                 }}
                             ''')
 
+            out.append(f'vvl::ApiTimer timer(vvl::ApiTimer::PreCallRecord, vvl::Func::{command.name}, vo->container_type);\n')
             out.append(f'vo->PreCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
             out.append('   }\n')
             if "QueueSubmit" in command.name:
@@ -414,6 +445,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
 
             # Tracy profiler
             out.append(f'{{\nVVL_ZoneScopedN("Dispatch_{command.name}");\n')
+            out.append(f'vvl::ApiTimer timer(vvl::ApiTimer::Dispatch, vvl::Func::{command.name}, LayerObjectTypeMaxEnum);\n')
 
             if "QueueSubmit" in command.name:
                 out.append(f'''
@@ -441,6 +473,21 @@ class LayerChassisOutputGenerator(BaseGenerator):
             if command.name in post_dispatch_debug_utils_functions:
                 out.append(f'    {post_dispatch_debug_utils_functions[command.name]}\n')
 
+            # Keep the validation sampling state of the command buffers for as long as they live
+            validation_sampling_functions = {
+                'vkAllocateCommandBuffers' : ('result == VK_SUCCESS', f'{dispatch}->AddSampledCommandBuffers(*pAllocateInfo, pCommandBuffers);'),
+                'vkFreeCommandBuffers' : ('true', f'{dispatch}->RemoveSampledCommandBuffers(commandBufferCount, pCommandBuffers);'),
+                'vkDestroyCommandPool' : ('true', f'{dispatch}->RemoveSampledCommandPool(commandPool);'),
+            }
+            if command.name in validation_sampling_functions:
+                condition, call = validation_sampling_functions[command.name]
+                condition = f'{dispatch}->validation_sampling_period > 1' + ('' if condition == 'true' else f' && {condition}')
+                out.append(f'''
+                    if ({condition}) {{
+                        {call}
+                    }}
+                ''')
+
             if command.returnType == 'VkResult':
                 out.append('record_obj.result = result;\n')
             elif command.returnType == 'VkDeviceAddress':
@@ -494,6 +541,7 @@ class LayerChassisOutputGenerator(BaseGenerator):
                 else:
                     out.append('vvl::BaseDevice::BlockingOperationGuard lock(vo);\n')
 
+            out.append(f'vvl::ApiTimer timer(vvl::ApiTimer::PostCallRecord, vvl::Func::{command.name}, vo->container_type);\n')
             out.append(f'vo->PostCallRecord{command.name[2:]}({paramsList}, record_obj);\n')
             out.append('    }\n')
             if "QueueSubmit" in command.name:
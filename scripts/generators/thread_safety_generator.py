@@ -212,7 +212,10 @@ class ThreadSafetyOutputGenerator(BaseGenerator):
                         out.append('}\n')
             else:
                 if param.type in self.vk.handles and param.type != 'VkPhysicalDevice':
-                    if param.length and ('pPipelines' != param.name) and ('pShaders' != param.name or 'Create' not in command.name):
+                    if param.length and param.pointer and not param.const and createObject(command.name):
+                        # Handles being created are not in the object table yet (and Finish would see different values)
+                        pass
+                    elif param.length and ('pPipelines' != param.name) and ('pShaders' != param.name or 'Create' not in command.name):
                         # Add pointer dereference for array counts that are pointer values
                         dereference = ''
                         for candidate in command.params:
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#include <stdlib.h>
+#define VVL_BENCHMARK_ENVIRON _environ
+#else
+#include <unistd.h>
+extern char **environ;
+#define VVL_BENCHMARK_ENVIRON environ
+#endif
+
+namespace {
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations;
+    double real_time_ns;  // per iteration
+    double cpu_time_ns;   // per iteration
+    uint64_t items_per_iteration;
+    uint32_t threads;
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+std::vector<BenchmarkResult> results;
+std::string device_name;
+std::atomic<uint64_t> allocation_count{0};
+
+double GetMinTime() {
+    if (const char *min_time = std::getenv("VVL_BENCHMARK_MIN_TIME")) {
+        const double seconds = std::atof(min_time);
+        if (seconds > 0.0) {
+            return seconds;
+        }
+    }
+    return 0.5;
+}
+
+std::string JsonString(const std::string &str) {
+    std::string escaped = "\"";
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", c);
+            escaped += code;
+        } else {
+            escaped += c;
+        }
+    }
+    escaped += '"';
+    return escaped;
+}
+
+// The environment variables are how the layer settings, the layers and the driver are picked for a run,
+// they are saved with the results to know what was measured.
+std::vector<std::string> GetVulkanEnvironment() {
+    std::vector<std::string> vulkan_environment;
+    for (char **var = VVL_BENCHMARK_ENVIRON; var && *var; ++var) {
+        if (std::string(*var).rfind("VK_", 0) == 0) {
+            vulkan_environment.emplace_back(*var);
+        }
+    }
+    std::sort(vulkan_environment.begin(), vulkan_environment.end());
+    return vulkan_environment;
+}
+
+// Same layout as the --benchmark_out_format=json output of Google Benchmark
+void WriteJson(const char *path) {
+    std::ofstream out(path);
+    if (!out) {
+        std::fprintf(stderr, "Failed to open benchmark output file %s\n", path);
+        return;
+    }
+
+    char date[64] = {};
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    out << "{\n  \"context\": {\n";
+    out << "    \"date\": " << JsonString(date) << ",\n";
+    out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+#if defined(NDEBUG)
+    out << "    \"library_build_type\": \"release\",\n";
+#else
+    out << "    \"library_build_type\": \"debug\",\n";
+#endif
+    out << "    \"device_name\": " << JsonString(device_name) << ",\n";
+    out << "    \"vulkan_environment\": [";
+    const std::vector<std::string> vulkan_environment = GetVulkanEnvironment();
+    for (size_t i = 0; i < vulkan_environment.size(); ++i) {
+        out << (i == 0 ? "\n      " : ",\n      ") << JsonString(vulkan_environment[i]);
+    }
+    out << (vulkan_environment.empty() ? "]\n" : "\n    ]\n");
+    out << "  },\n  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult &result = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\n";
+        out << "      \"name\": " << JsonString(result.name) << ",\n";
+        out << "      \"family_index\": " << i << ",\n";
+        out << "      \"per_family_instance_index\": 0,\n";
+        out << "      \"run_name\": " << JsonString(result.name) << ",\n";
+        out << "      \"run_type\": \"iteration\",\n";
+        out << "      \"repetitions\": 1,\n";
+        out << "      \"repetition_index\": 0,\n";
+        out << "      \"threads\": " << result.threads << ",\n";
+        out << "      \"iterations\": " << result.iterations << ",\n";
+        out << "      \"real_time\": " << result.real_time_ns << ",\n";
+        out << "      \"cpu_time\": " << result.cpu_time_ns << ",\n";
+        out << "      \"time_unit\": \"ns\",\n";
+        // User counters are written next to items_per_second, like benchmark::State::counters
+        for (const auto &[counter_name, value] : result.counters) {
+            out << "      " << JsonString(counter_name) << ": " << value << ",\n";
+        }
+        out << "      \"items_per_second\": " << (result.items_per_iteration * 1e9 / result.real_time_ns) << "\n";
+        out << "    }";
+    }
+    out << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+class BenchmarkEnvironment : public ::testing::Environment {
+  public:
+    void TearDown() override {
+        if (const char *path = std::getenv("VVL_BENCHMARK_OUT")) {
+            WriteJson(path);
+        }
+    }
+};
+
+[[maybe_unused]] const auto *benchmark_environment = ::testing::AddGlobalTestEnvironment(new BenchmarkEnvironment);
+
+}  // namespace
+
+// The array and nothrow forms call these ones
+void *operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void *ptr = std::malloc(size != 0 ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+uint64_t VkBenchmark::GetAllocationCount() { return allocation_count.load(std::memory_order_relaxed); }
+
+uint64_t VkBenchmark::GetResidentMemory() {
+#if defined(__linux__) || defined(__ANDROID__)
+    // The second field of statm is the resident set size, in pages
+    FILE *statm = std::fopen("/proc/self/statm", "r");
+    if (!statm) {
+        return 0;
+    }
+    unsigned long long size = 0, resident = 0;
+    const int read = std::fscanf(statm, "%llu %llu", &size, &resident);
+    std::fclose(statm);
+    return read == 2 ? resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+void VkBenchmark::Run(const std::function<void()> &func, uint64_t items_per_iteration) {
+    const ::testing::TestInfo *test_info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::string name = std::string(test_info->test_suite_name()) + "." + test_info->name();
+    const uint32_t threads = thread_count_ != 0 ? thread_count_ : 1;
+    if (thread_count_ != 0) {
+        name += "/threads:" + std::to_string(thread_count_);
+        thread_count_ = 0;
+    }
+    if (m_device && device_name.empty()) {
+        device_name = m_device->Physical().Properties().deviceName;
+    }
+
+    // Warm up, the first calls create the layer state (command buffer access contexts, ...) the other iterations reuse
+    func();
+
+    const double min_time_ns = GetMinTime() * 1e9;
+    const uint64_t max_iterations = 1'000'000'000;
+    uint64_t iterations = 1;
+    while (true) {
+        const std::clock_t cpu_start = std::clock();
+        const auto real_start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; ++i) {
+            func();
+        }
+        const auto real_end = std::chrono::steady_clock::now();
+        const std::clock_t cpu_end = std::clock();
+
+        const double real_time_ns = std::chrono::duration<double, std::nano>(real_end - real_start).count();
+        if (real_time_ns >= min_time_ns || iterations >= max_iterations) {
+            // std::clock() is the process time, it includes the time spent by the layer's own threads
+            const double cpu_time_ns = double(cpu_end - cpu_start) * 1e9 / CLOCKS_PER_SEC;
+            results.emplace_back(BenchmarkResult{name, iterations, real_time_ns / iterations, cpu_time_ns / iterations,
+                                                 items_per_iteration, threads, std::move(counters_)});
+            counters_.clear();
+            std::printf("%-60s %14.0f ns %14.0f ns %12llu %14.0f items/s\n", name.c_str(), real_time_ns / iterations,
+                        cpu_time_ns / iterations, static_cast<unsigned long long>(iterations),
+                        items_per_iteration * 1e9 / (real_time_ns / iterations));
+            for (const auto &[counter_name, value] : results.back().counters) {
+                std::printf("    %s = %.0f\n", counter_name.c_str(), value);
+            }
+            return;
+        }
+
+        // Same growth as Google Benchmark, aim a bit over the minimum time but don't grow more than 10x at once
+        const double multiplier = real_time_ns > 0.0 ? std::min(10.0, min_time_ns * 1.4 / real_time_ns) : 10.0;
+        iterations = std::min(max_iterations, std::max(iterations + 1, static_cast<uint64_t>(iterations * multiplier)));
+    }
+}
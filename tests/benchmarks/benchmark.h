@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../framework/layer_validation_tests.h"
+
+// Benchmarks of the CPU time spent in the layer, meant to run on the Test ICD so the driver cost is close to zero.
+//
+// Each TEST_F is one benchmark: it sets up the objects it needs, then calls Run() with the code to time.
+// Run() repeats that code until it has taken at least VVL_BENCHMARK_MIN_TIME seconds (0.5 by default) and reports the time
+// per iteration. When VVL_BENCHMARK_OUT is set, all results are written to that file in the Google Benchmark JSON format, so
+// the existing tools (compare.py, ...) can be used to track regressions between builds or validation settings.
+class VkBenchmark : public VkLayerTest {
+  protected:
+    // |items_per_iteration| is the number of calls (draws, writes, ...) done by one call to |func|, used to report a rate
+    void Run(const std::function<void()> &func, uint64_t items_per_iteration = 1);
+
+    // Adds a user counter to the result of the next Run(), for what is not a time (memory used, ...)
+    void SetCounter(const std::string &name, double value) { counters_.emplace_back(name, value); }
+
+    // The next Run() is one point of a thread scaling benchmark, named "<test>/threads:<count>" like Google Benchmark's
+    // ->Threads(), so a test can call Run() once per thread count
+    void SetThreads(uint32_t thread_count) { thread_count_ = thread_count; }
+
+    // Resident memory of the process in bytes, 0 if it can't be known on this platform
+    static uint64_t GetResidentMemory();
+
+    // Calls to the global operator new since the start of the process.
+    // The benchmark executable replaces operator new to count them. The layer allocations are included where the shared
+    // library uses the operator new of the executable (Linux and Android), otherwise only the test side ones are counted.
+    static uint64_t GetAllocationCount();
+
+  private:
+    std::vector<std::pair<std::string, double>> counters_;
+    uint32_t thread_count_ = 0;
+};
@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "benchmark.h"
+#include "../framework/descriptor_helper.h"
+#include "../framework/pipeline_helper.h"
+#include "../framework/ray_tracing_objects.h"
+
+class BenchmarkCore : public VkBenchmark {};
+
+TEST_F(BenchmarkCore, DrawManyDescriptorSets) {
+    TEST_DESCRIPTION("Record draws, each binding 4 descriptor sets");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    const uint32_t set_count = 4;
+    const uint32_t draw_count = 1000;
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    std::vector<std::unique_ptr<OneOffDescriptorSet>> descriptor_sets;
+    std::vector<const vkt::DescriptorSetLayout *> set_layouts;
+    std::vector<VkDescriptorSet> sets;
+    for (uint32_t i = 0; i < set_count; ++i) {
+        descriptor_sets.emplace_back(std::make_unique<OneOffDescriptorSet>(
+            m_device,
+            std::vector<VkDescriptorSetLayoutBinding>{{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}}));
+        descriptor_sets.back()->WriteDescriptorBufferInfo(0, buffer, 0, VK_WHOLE_SIZE);
+        descriptor_sets.back()->UpdateDescriptorSets();
+        set_layouts.emplace_back(&descriptor_sets.back()->layout_);
+        sets.emplace_back(descriptor_sets.back()->set_);
+    }
+
+    CreatePipelineHelper pipe(*this);
+    pipe.pipeline_layout_ = vkt::PipelineLayout(*m_device, set_layouts);
+    pipe.CreateGraphicsPipeline();
+
+    Run(
+        [&]() {
+            m_command_buffer.Begin();
+            m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+            vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe);
+            for (uint32_t i = 0; i < draw_count; ++i) {
+                vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe.pipeline_layout_, 0, set_count,
+                                          sets.data(), 0, nullptr);
+                vk::CmdDraw(m_command_buffer, 3, 1, 0, 0);
+            }
+            m_command_buffer.EndRenderPass();
+            m_command_buffer.End();
+        },
+        draw_count);
+}
+
+TEST_F(BenchmarkCore, UpdateDescriptorSets) {
+    TEST_DESCRIPTION("Write uniform buffer descriptors in one vkUpdateDescriptorSets call");
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t descriptor_count = 64;
+    const uint32_t set_count = 16;
+
+    vkt::Buffer buffer(*m_device, 256 * descriptor_count, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+    std::vector<std::unique_ptr<OneOffDescriptorSet>> descriptor_sets;
+    for (uint32_t i = 0; i < set_count; ++i) {
+        descriptor_sets.emplace_back(std::make_unique<OneOffDescriptorSet>(
+            m_device, std::vector<VkDescriptorSetLayoutBinding>{
+                          {0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, descriptor_count, VK_SHADER_STAGE_ALL, nullptr}}));
+    }
+
+    std::vector<VkDescriptorBufferInfo> buffer_infos(descriptor_count);
+    for (uint32_t i = 0; i < descriptor_count; ++i) {
+        buffer_infos[i] = {buffer, 256 * VkDeviceSize(i), 256};
+    }
+    std::vector<VkWriteDescriptorSet> writes(set_count);
+    for (uint32_t i = 0; i < set_count; ++i) {
+        writes[i] = vku::InitStructHelper();
+        writes[i].dstSet = descriptor_sets[i]->set_;
+        writes[i].dstBinding = 0;
+        writes[i].descriptorCount = descriptor_count;
+        writes[i].descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        writes[i].pBufferInfo = buffer_infos.data();
+    }
+
+    Run([&]() { vk::UpdateDescriptorSets(device(), size32(writes), writes.data(), 0, nullptr); },
+        uint64_t(set_count) * descriptor_count);
+}
+
+TEST_F(BenchmarkCore, CreateGraphicsPipeline) {
+    TEST_DESCRIPTION("Create and destroy a graphics pipeline without a pipeline cache");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    Run([&]() {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 1, &pipe.gp_ci_, nullptr, &pipeline);
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    });
+}
+
+TEST_F(BenchmarkCore, GraphicsPipelineMemory) {
+    TEST_DESCRIPTION("Keep many graphics pipelines with few or all different blend states alive, report the memory per pipeline");
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    const uint32_t pipeline_count = 2000;
+    const uint32_t blend_state_count = 4;
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    // Both sets of pipelines are kept alive until the end, so the second one can't reuse the memory freed by the first one
+    std::vector<VkPipeline> pipelines(2 * pipeline_count, VK_NULL_HANDLE);
+    auto create_pipelines = [&](VkPipeline *first_pipeline, const std::function<void(uint32_t)> &set_blend_state) {
+        const uint64_t memory_before = GetResidentMemory();
+        for (uint32_t i = 0; i < pipeline_count; ++i) {
+            set_blend_state(i);
+            vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 1, &pipe.gp_ci_, nullptr, &first_pipeline[i]);
+        }
+        const uint64_t memory_after = GetResidentMemory();
+        return (memory_before != 0 && memory_after > memory_before) ? double(memory_after - memory_before) / pipeline_count : 0.0;
+    };
+
+    // Pipelines share their color blend state when it is identical. With a different blend state for each pipeline nothing is
+    // shared, which is what every pipeline cost before the states were shared.
+    const double shared_bytes = create_pipelines(
+        pipelines.data(), [&](uint32_t i) { pipe.cb_attachments_.colorWriteMask = (i % blend_state_count) + 1; });
+    const double unshared_bytes = create_pipelines(pipelines.data() + pipeline_count,
+                                                   [&](uint32_t i) { pipe.cb_ci_.blendConstants[0] = float(i + 1); });
+    pipe.cb_ci_.blendConstants[0] = 0.0f;
+    if (shared_bytes != 0.0 && unshared_bytes != 0.0) {
+        SetCounter("bytes_per_pipeline", shared_bytes);
+        SetCounter("bytes_per_pipeline_unshared", unshared_bytes);
+    }
+
+    Run([&]() {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateGraphicsPipelines(device(), VK_NULL_HANDLE, 1, &pipe.gp_ci_, nullptr, &pipeline);
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    });
+
+    for (VkPipeline pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
+
+TEST_F(BenchmarkCore, CreateComputePipeline) {
+    TEST_DESCRIPTION("Create and destroy a compute pipeline without a pipeline cache");
+    RETURN_IF_SKIP(Init());
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.CreateComputePipeline();
+
+    Run([&]() {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 1, &pipe.cp_ci_, nullptr, &pipeline);
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    });
+}
+
+TEST_F(BenchmarkCore, CreateSpecializedComputePipeline) {
+    TEST_DESCRIPTION("Create and destroy a compute pipeline using specialization constants, the specialized shader is reused");
+    RETURN_IF_SKIP(Init());
+
+    const char *cs_source = R"glsl(
+        #version 450
+        layout(constant_id = 0) const uint SIZE = 4;
+        layout(local_size_x_id = 1) in;
+        layout(set = 0, binding = 0) buffer SSBO { uint a[]; };
+        shared uint scratch[SIZE];
+        void main() {
+            scratch[gl_LocalInvocationIndex % SIZE] = gl_LocalInvocationIndex;
+            barrier();
+            a[gl_GlobalInvocationID.x] = scratch[(gl_LocalInvocationIndex + 1) % SIZE];
+        }
+    )glsl";
+
+    const uint32_t data[2] = {16, 64};
+    const VkSpecializationMapEntry entries[2] = {{0, 0, sizeof(uint32_t)}, {1, sizeof(uint32_t), sizeof(uint32_t)}};
+    VkSpecializationInfo specialization_info = {2, entries, sizeof(data), data};
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.dsl_bindings_[0] = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+    pipe.cs_ = VkShaderObj(*m_device, cs_source, VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0, SPV_SOURCE_GLSL,
+                           &specialization_info);
+    pipe.CreateComputePipeline();
+
+    Run([&]() {
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 1, &pipe.cp_ci_, nullptr, &pipeline);
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    });
+}
+
+TEST_F(BenchmarkCore, ImageBarriers) {
+    TEST_DESCRIPTION("Record pipeline barriers transitioning image subresources back and forth");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    AddRequiredFeature(vkt::Feature::synchronization2);
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t barrier_count = 1000;
+    const uint32_t mip_levels = 8;
+
+    VkImageCreateInfo image_ci = vkt::Image::ImageCreateInfo2D(
+        256, 256, mip_levels, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    vkt::Image image(*m_device, image_ci);
+
+    VkImageMemoryBarrier2 barriers[2] = {vku::InitStructHelper(), vku::InitStructHelper()};
+    barriers[0].srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barriers[0].srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barriers[0].dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barriers[0].dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+    barriers[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barriers[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[0].image = image;
+    barriers[0].subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    barriers[1] = barriers[0];
+    barriers[1].srcAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+    barriers[1].dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barriers[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    barriers[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+
+    Run(
+        [&]() {
+            m_command_buffer.Begin();
+            for (uint32_t i = 0; i < barrier_count; ++i) {
+                // Walk the mips so the layout map sees many subresources instead of a single one
+                VkImageMemoryBarrier2 barrier = barriers[(i / mip_levels) % 2];
+                barrier.subresourceRange.baseMipLevel = i % mip_levels;
+                if (i < mip_levels) {
+                    barrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+                }
+                m_command_buffer.Barrier(barrier);
+            }
+            m_command_buffer.End();
+        },
+        barrier_count);
+}
+
+TEST_F(BenchmarkCore, SparseBufferPageBinds) {
+    TEST_DESCRIPTION("Rebind scattered pages of a sparse buffer then record copies across them, like a virtual texture update");
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(Init());
+
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    const uint32_t page_count = 1024;
+    const uint32_t half_page_count = page_count / 2;
+    const uint32_t binds_per_frame = 256;
+    const uint32_t copy_count = 1000;
+
+    VkBufferCreateInfo buffer_ci =
+        vkt::Buffer::CreateInfo(0x10000, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    buffer_ci.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    VkMemoryRequirements page_mem_reqs;
+    {
+        vkt::Buffer probe(*m_device, buffer_ci, vkt::no_mem);
+        vk::GetBufferMemoryRequirements(device(), probe, &page_mem_reqs);
+    }
+    const VkDeviceSize page_size = page_mem_reqs.alignment;
+    buffer_ci.size = page_size * page_count;
+    vkt::Buffer buffer_sparse(*m_device, buffer_ci, vkt::no_mem);
+
+    VkMemoryRequirements buffer_mem_reqs;
+    vk::GetBufferMemoryRequirements(device(), buffer_sparse, &buffer_mem_reqs);
+    VkMemoryAllocateInfo buffer_mem_alloc =
+        vkt::DeviceMemory::GetResourceAllocInfo(*m_device, buffer_mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::DeviceMemory buffer_mem(*m_device, buffer_mem_alloc);
+
+    // Pages are bound to scattered places in memory, so neighbour pages are separate bindings.
+    // The first half of the buffer is copied to the second half, each half stays in its own half of the memory.
+    auto get_memory_offset = [&](uint32_t page, uint32_t frame) {
+        const uint32_t half_begin = page < half_page_count ? 0 : half_page_count;
+        return page_size * (half_begin + (page * 7 + frame) % half_page_count);
+    };
+    std::vector<VkSparseMemoryBind> binds(page_count);
+    for (uint32_t i = 0; i < page_count; ++i) {
+        binds[i].resourceOffset = page_size * i;
+        binds[i].size = page_size;
+        binds[i].memory = buffer_mem;
+        binds[i].memoryOffset = get_memory_offset(i, 0);
+    }
+
+    VkSparseBufferMemoryBindInfo buffer_bind_info = {buffer_sparse, page_count, binds.data()};
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = 1;
+    bind_info.pBufferBinds = &buffer_bind_info;
+
+    VkQueue sparse_queue = m_device->QueuesWithSparseCapability()[0]->handle();
+    vkt::Fence fence(*m_device);
+    vk::QueueBindSparse(sparse_queue, 1, &bind_info, fence);
+    ASSERT_EQ(VK_SUCCESS, fence.Wait(kWaitTimeout));
+    fence.Reset();
+
+    std::vector<VkBufferCopy> copies(copy_count);
+    for (uint32_t i = 0; i < copy_count; ++i) {
+        const uint32_t src_page = (i * 13) % half_page_count;
+        copies[i] = {page_size * src_page, page_size * (src_page + half_page_count), 256};
+    }
+
+    // Every frame moves a window of pages to other places of the memory
+    std::vector<VkSparseMemoryBind> frame_binds(binds_per_frame);
+    uint32_t frame = 0;
+    Run(
+        [&]() {
+            for (uint32_t i = 0; i < binds_per_frame; ++i) {
+                const uint32_t page = (frame * binds_per_frame + i * 37) % page_count;
+                frame_binds[i] = binds[page];
+                frame_binds[i].memoryOffset = get_memory_offset(page, frame + 1);
+            }
+            ++frame;
+            buffer_bind_info.bindCount = binds_per_frame;
+            buffer_bind_info.pBinds = frame_binds.data();
+            vk::QueueBindSparse(sparse_queue, 1, &bind_info, fence);
+            fence.Wait(kWaitTimeout);
+            fence.Reset();
+
+            m_command_buffer.Begin();
+            vk::CmdCopyBuffer(m_command_buffer, buffer_sparse, buffer_sparse, size32(copies), copies.data());
+            m_command_buffer.End();
+        },
+        binds_per_frame);
+}
+
+TEST_F(BenchmarkCore, DestroyCommandPoolAmongMany) {
+    TEST_DESCRIPTION("Create and destroy a small command pool while many command buffers are allocated from other pools");
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t pool_count = 16;
+    const uint32_t command_buffers_per_pool = 2048;
+    const uint32_t frame_command_buffer_count = 8;
+
+    std::vector<std::unique_ptr<vkt::CommandPool>> pools;
+    std::vector<std::vector<VkCommandBuffer>> command_buffers(pool_count);
+    for (uint32_t i = 0; i < pool_count; ++i) {
+        pools.emplace_back(std::make_unique<vkt::CommandPool>(*m_device, m_device->graphics_queue_node_index_));
+        command_buffers[i].resize(command_buffers_per_pool);
+        VkCommandBufferAllocateInfo allocate_info = vku::InitStructHelper();
+        allocate_info.commandPool = *pools[i];
+        allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount = command_buffers_per_pool;
+        vk::AllocateCommandBuffers(device(), &allocate_info, command_buffers[i].data());
+    }
+
+    VkCommandPoolCreateInfo pool_ci = vku::InitStructHelper();
+    pool_ci.queueFamilyIndex = m_device->graphics_queue_node_index_;
+    std::vector<VkCommandBuffer> frame_command_buffers(frame_command_buffer_count);
+    Run([&]() {
+        VkCommandPool pool = VK_NULL_HANDLE;
+        vk::CreateCommandPool(device(), &pool_ci, nullptr, &pool);
+        VkCommandBufferAllocateInfo allocate_info = vku::InitStructHelper();
+        allocate_info.commandPool = pool;
+        allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount = frame_command_buffer_count;
+        vk::AllocateCommandBuffers(device(), &allocate_info, frame_command_buffers.data());
+        vk::DestroyCommandPool(device(), pool, nullptr);
+    });
+
+    for (uint32_t i = 0; i < pool_count; ++i) {
+        vk::FreeCommandBuffers(device(), *pools[i], command_buffers_per_pool, command_buffers[i].data());
+    }
+}
+
+TEST_F(BenchmarkCore, ThreadSafetyRecordingScaling) {
+    // Every recorded command does a StartWrite/FinishWrite pair on the command buffer and its pool, from each thread on
+    // its own objects. The calls per second should grow with the thread count, a shared lock or cache line in the
+    // thread safety object tracking shows up as a flat or falling rate.
+    TEST_DESCRIPTION("Record commands into separate command buffers from 1 to 16 threads at the same time");
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t max_thread_count = 16;
+    const uint32_t commands_per_thread = 20'000;
+
+    std::vector<std::unique_ptr<vkt::CommandPool>> pools;
+    std::vector<std::unique_ptr<vkt::CommandBuffer>> command_buffers;
+    for (uint32_t i = 0; i < max_thread_count; ++i) {
+        pools.emplace_back(std::make_unique<vkt::CommandPool>(*m_device, m_device->graphics_queue_node_index_,
+                                                              VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT));
+        command_buffers.emplace_back(std::make_unique<vkt::CommandBuffer>(*m_device, *pools.back()));
+    }
+
+    const VkViewport viewport = {0.0f, 0.0f, 16.0f, 16.0f, 0.0f, 1.0f};
+    auto record = [&](uint32_t thread_index) {
+        vkt::CommandBuffer &cb = *command_buffers[thread_index];
+        cb.Begin();
+        for (uint32_t i = 0; i < commands_per_thread; ++i) {
+            vk::CmdSetViewport(cb, 0, 1, &viewport);
+        }
+        cb.End();
+    };
+
+    for (const uint32_t thread_count : {1u, 2u, 4u, 8u, 16u}) {
+        SetThreads(thread_count);
+        Run(
+            [&]() {
+                std::vector<std::thread> threads;
+                threads.reserve(thread_count);
+                for (uint32_t i = 0; i < thread_count; ++i) {
+                    threads.emplace_back(record, i);
+                }
+                for (auto &thread : threads) {
+                    thread.join();
+                }
+            },
+            thread_count * commands_per_thread);
+    }
+}
+
+TEST_F(BenchmarkCore, BuildManyBottomLevelAccelerationStructures) {
+    TEST_DESCRIPTION("Record one vkCmdBuildAccelerationStructuresKHR building thousands of small bottom level structures");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredExtensions(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t build_count = 5000;
+
+    // The acceleration structures, scratch buffers and geometries are all created up front, only the recording is timed
+    std::vector<vkt::as::BuildGeometryInfoKHR> builds;
+    builds.reserve(build_count);
+    std::vector<VkAccelerationStructureBuildGeometryInfoKHR> build_infos;
+    std::vector<const VkAccelerationStructureGeometryKHR *> geometries;
+    std::vector<VkAccelerationStructureBuildRangeInfoKHR> build_ranges;
+    std::vector<const VkAccelerationStructureBuildRangeInfoKHR *> build_range_ptrs;
+    geometries.reserve(build_count);
+    build_ranges.reserve(build_count);
+    for (uint32_t i = 0; i < build_count; ++i) {
+        builds.emplace_back(vkt::as::blueprint::BuildGeometryInfoSimpleOnDeviceBottomLevel(*m_device));
+        builds.back().SetupBuild(true);
+        // The blueprint has a single geometry
+        geometries.emplace_back(&builds.back().GetGeometries()[0].GetVkObj());
+        build_ranges.emplace_back(builds.back().GetGeometries()[0].GetFullBuildRange());
+        build_range_ptrs.emplace_back(&build_ranges.back());
+
+        VkAccelerationStructureBuildGeometryInfoKHR build_info = builds.back().GetInfo();
+        build_info.geometryCount = 1;
+        build_info.pGeometries = nullptr;
+        build_info.ppGeometries = &geometries.back();
+        build_infos.emplace_back(build_info);
+    }
+
+    Run(
+        [&]() {
+            m_command_buffer.Begin();
+            vk::CmdBuildAccelerationStructuresKHR(m_command_buffer, build_count, build_infos.data(), build_range_ptrs.data());
+            m_command_buffer.End();
+        },
+        build_count);
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmark.h"
+#include "../framework/gpu_av_helper.h"
+#include "../framework/pipeline_helper.h"
+
+class BenchmarkGpuAV : public VkBenchmark {
+  public:
+    void InitGpuAV();
+};
+
+static const std::array gpu_av_enables = {VK_VALIDATION_FEATURE_ENABLE_GPU_ASSISTED_EXT};
+
+void BenchmarkGpuAV::InitGpuAV() {
+    VkValidationFeaturesEXT validation_features = vku::InitStructHelper();
+    validation_features.enabledValidationFeatureCount = size32(gpu_av_enables);
+    validation_features.pEnabledValidationFeatures = gpu_av_enables.data();
+
+    AddRequiredExtensions(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::runtimeDescriptorArray);
+    AddRequiredFeature(vkt::Feature::shaderStorageBufferArrayNonUniformIndexing);
+    RETURN_IF_SKIP(InitFramework(&validation_features));
+    if (!CanEnableGpuAV(*this)) {
+        GTEST_SKIP() << "Requirements for GPU-AV are not met";
+    }
+    RETURN_IF_SKIP(InitState());
+}
+
+// Something instrumented on almost every line, |count| times
+static std::string MakeLargeShader(uint32_t count) {
+    std::string source = R"glsl(
+        #version 450
+        #extension GL_EXT_nonuniform_qualifier : enable
+        #extension GL_EXT_buffer_reference : enable
+        layout(buffer_reference, std430) buffer Ptr { uint v[]; };
+        layout(set = 0, binding = 0) buffer SSBO { uint index; Ptr ptr; uint data[]; } ssbo[];
+        void main() {
+            uint acc = 0;
+    )glsl";
+    for (uint32_t i = 0; i < count; ++i) {
+        const std::string n = std::to_string(i);
+        source += "acc += ssbo[nonuniformEXT(acc % 4)].data[acc + " + n + "];\n";
+        source += "ssbo[" + std::to_string(i % 4) + "].ptr.v[acc % " + std::to_string(i + 1) + "] = acc;\n";
+        source += "if (acc > " + n + ") { acc ^= ssbo[0].index; }\n";
+    }
+    source += "ssbo[0].data[0] = acc;\n}\n";
+    return source;
+}
+
+TEST_F(BenchmarkGpuAV, InstrumentShaderCorpus) {
+    TEST_DESCRIPTION("Create compute pipelines from shaders of different sizes, each creation instruments the shader again");
+    RETURN_IF_SKIP(InitGpuAV());
+
+    const std::vector<std::string> corpus = {
+        R"glsl(
+            #version 450
+            layout(set = 0, binding = 0) buffer SSBO { uint a[]; };
+            void main() { a[gl_GlobalInvocationID.x] = a[gl_GlobalInvocationID.x + 1]; }
+        )glsl",
+        MakeLargeShader(16),
+        MakeLargeShader(128),
+        MakeLargeShader(1024),
+    };
+
+    std::vector<std::unique_ptr<CreateComputePipelineHelper>> pipes;
+    for (const std::string &source : corpus) {
+        auto pipe = std::make_unique<CreateComputePipelineHelper>(*this);
+        pipe->dsl_bindings_[0] = {0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4, VK_SHADER_STAGE_COMPUTE_BIT, nullptr};
+        pipe->cs_ = VkShaderObj(*m_device, source.c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+        pipe->CreateComputePipeline();
+        pipes.emplace_back(std::move(pipe));
+    }
+
+    Run(
+        [&]() {
+            for (const auto &pipe : pipes) {
+                VkPipeline pipeline = VK_NULL_HANDLE;
+                vk::CreateComputePipelines(device(), VK_NULL_HANDLE, 1, &pipe->cp_ci_, nullptr, &pipeline);
+                vk::DestroyPipeline(device(), pipeline, nullptr);
+            }
+        },
+        pipes.size());
+}
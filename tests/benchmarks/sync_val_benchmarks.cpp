@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <array>
+#include <vector>
+#include "benchmark.h"
+
+class BenchmarkSyncVal : public VkBenchmark {
+  public:
+    void InitSyncVal();
+};
+
+static const std::array syncval_enables = {VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT};
+
+void BenchmarkSyncVal::InitSyncVal() {
+    VkValidationFeaturesEXT validation_features = vku::InitStructHelper();
+    validation_features.enabledValidationFeatureCount = size32(syncval_enables);
+    validation_features.pEnabledValidationFeatures = syncval_enables.data();
+
+    AddRequiredExtensions(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    AddRequiredFeature(vkt::Feature::synchronization2);
+    RETURN_IF_SKIP(InitFramework(&validation_features));
+    RETURN_IF_SKIP(InitState());
+}
+
+TEST_F(BenchmarkSyncVal, QueueSubmit) {
+    TEST_DESCRIPTION("Submit command buffers full of copies, waiting on the previous submission every few submits");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    const uint32_t copy_count = 256;
+    const uint32_t submit_count = 16;
+
+    vkt::Buffer buffer(*m_device, 2 * copy_count * 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkMemoryBarrier2 barrier = vku::InitStructHelper();
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT | VK_ACCESS_2_TRANSFER_WRITE_BIT;
+
+    // Recorded once, the benchmark measures the submit time validation
+    vkt::CommandBuffer command_buffer(*m_device, m_command_pool);
+    command_buffer.Begin();
+    for (uint32_t i = 0; i < copy_count; ++i) {
+        const VkBufferCopy region = {256 * VkDeviceSize(i), 256 * VkDeviceSize(copy_count + i), 256};
+        vk::CmdCopyBuffer(command_buffer, buffer, buffer, 1, &region);
+        command_buffer.Barrier(barrier);
+    }
+    command_buffer.End();
+
+    vkt::Fence fence(*m_device);
+    Run(
+        [&]() {
+            for (uint32_t i = 0; i < submit_count - 1; ++i) {
+                m_default_queue->Submit(command_buffer);
+            }
+            // The fence wait lets syncval trim the queue state, otherwise each iteration would be slower than the previous one
+            m_default_queue->Submit(command_buffer, fence);
+            fence.Wait(kWaitTimeout);
+            fence.Reset();
+        },
+        submit_count);
+}
+
+TEST_F(BenchmarkSyncVal, RecordCopiesAndBarriers) {
+    TEST_DESCRIPTION("Record small buffer copies separated by memory barriers");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    const uint32_t copy_count = 1000;
+
+    vkt::Buffer buffer(*m_device, 2 * copy_count * 16, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    VkMemoryBarrier2 barrier = vku::InitStructHelper();
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+
+    Run(
+        [&]() {
+            m_command_buffer.Begin();
+            for (uint32_t i = 0; i < copy_count; ++i) {
+                const VkBufferCopy region = {16 * VkDeviceSize(i), 16 * VkDeviceSize(i + 1), 16};
+                vk::CmdCopyBuffer(m_command_buffer, buffer, buffer, 1, &region);
+                m_command_buffer.Barrier(barrier);
+            }
+            m_command_buffer.End();
+        },
+        copy_count);
+}
+
+TEST_F(BenchmarkSyncVal, ImageBarriers) {
+    TEST_DESCRIPTION("Record layout transitions of image subresources");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    const uint32_t barrier_count = 1000;
+    const uint32_t layer_count = 16;
+
+    VkImageCreateInfo image_ci = vkt::Image::ImageCreateInfo2D(
+        64, 64, 1, layer_count, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    vkt::Image image(*m_device, image_ci);
+
+    VkImageMemoryBarrier2 barrier = vku::InitStructHelper();
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.image = image;
+
+    Run(
+        [&]() {
+            m_command_buffer.Begin();
+            for (uint32_t i = 0; i < barrier_count; ++i) {
+                barrier.oldLayout = i < layer_count ? VK_IMAGE_LAYOUT_UNDEFINED : VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                barrier.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, i % layer_count, 1};
+                m_command_buffer.Barrier(barrier);
+            }
+            m_command_buffer.End();
+        },
+        barrier_count);
+}
+
+TEST_F(BenchmarkSyncVal, RerecordAllocations) {
+    TEST_DESCRIPTION("Reset and record again a command buffer of copies and barriers, report the heap allocations per recording");
+    RETURN_IF_SKIP(InitSyncVal());
+
+    const uint32_t copy_count = 1000;
+    const uint32_t rerecord_count = 16;
+
+    vkt::Buffer buffer(*m_device, 2 * copy_count * 16, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    const VkPushConstantRange push_constant_range = {VK_SHADER_STAGE_COMPUTE_BIT, 0, 16};
+    vkt::PipelineLayout pipeline_layout(*m_device, {}, {push_constant_range});
+    const uint32_t push_constants[4] = {};
+
+    VkMemoryBarrier2 barrier = vku::InitStructHelper();
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_TRANSFER_READ_BIT;
+
+    auto record = [&]() {
+        m_command_buffer.Begin();
+        for (uint32_t i = 0; i < copy_count; ++i) {
+            vk::CmdPushConstants(m_command_buffer, pipeline_layout, VK_SHADER_STAGE_COMPUTE_BIT, 0, sizeof(push_constants),
+                                 push_constants);
+            const VkBufferCopy region = {16 * VkDeviceSize(i), 16 * VkDeviceSize(i + 1), 16};
+            vk::CmdCopyBuffer(m_command_buffer, buffer, buffer, 1, &region);
+            m_command_buffer.Barrier(barrier);
+        }
+        m_command_buffer.End();
+    };
+
+    // The first recordings fill the block cache of the command pool, the next ones should take their memory from it
+    record();
+    record();
+    const uint64_t allocations_before = GetAllocationCount();
+    for (uint32_t i = 0; i < rerecord_count; ++i) {
+        record();
+    }
+    SetCounter("allocations_per_rerecord", double(GetAllocationCount() - allocations_before) / rerecord_count);
+
+    Run(record, copy_count);
+}
@@ -14,6 +14,7 @@
 
 #include <vulkan/vulkan_core.h>
 #include "../framework/layer_validation_tests.h"
+#include "../framework/shader_helper.h"
 
 // Tests to detect significant performance regressions.
 // The heuristic is that each individual test should not get "stuck" for too long.
@@ -61,3 +62,120 @@ TEST_F(PerformanceCore, SignalSemaphoreFromHostManyTimes) {
     }
     m_device->Wait();
 }
+
+TEST_F(PerformanceCore, TimelineSemaphorePingPongBetweenQueues) {
+    // Each submission waits on the timeline value signaled by the other queue, so the semaphore
+    // timeline keeps a few thousand pending timepoints that are retired from the front.
+    // In case of a regression (e.g. per-timepoint allocations or linear lookups) this gets much slower.
+    TEST_DESCRIPTION("Signal and wait on a timeline semaphore from two queues many times");
+    AddRequiredFeature(vkt::Feature::timelineSemaphore);
+    AddRequiredFeature(vkt::Feature::synchronization2);
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    RETURN_IF_SKIP(Init());
+    if (!m_second_queue) {
+        GTEST_SKIP() << "Test requires two queues";
+    }
+
+    vkt::Semaphore semaphore(*m_device, VK_SEMAPHORE_TYPE_TIMELINE);
+
+    const uint64_t N = 10'000;
+    for (uint64_t i = 1; i <= N; i++) {
+        // first queue signals odd values, second queue signals even values
+        m_default_queue->Submit2(vkt::no_cmd, vkt::TimelineWait(semaphore, 2 * i - 2), vkt::TimelineSignal(semaphore, 2 * i - 1));
+        m_second_queue->Submit2(vkt::no_cmd, vkt::TimelineWait(semaphore, 2 * i - 1), vkt::TimelineSignal(semaphore, 2 * i));
+    }
+    m_device->Wait();
+}
+
+TEST_F(PerformanceCore, CreateComputePipelinesWithPNextChain) {
+    // Stateless validation walks the pNext chain of every create info (and of every nested struct).
+    // In case of a regression this test becomes dominated by per-struct allocations or lookups.
+    TEST_DESCRIPTION("Create many compute pipelines with a pNext chain in large batches");
+    SetTargetApiVersion(VK_API_VERSION_1_3);
+    RETURN_IF_SKIP(Init());
+
+    VkShaderObj cs(*m_device, kMinimalShaderGlsl, VK_SHADER_STAGE_COMPUTE_BIT);
+    const vkt::PipelineLayout pipeline_layout(*m_device);
+
+    constexpr uint32_t batch_size = 1'000;
+    constexpr uint32_t batch_count = 5;
+
+    std::vector<VkPipelineCreationFeedback> feedbacks(batch_size);
+    std::vector<VkPipelineCreationFeedbackCreateInfo> feedback_infos(batch_size);
+    std::vector<VkComputePipelineCreateInfo> create_infos(batch_size);
+    for (uint32_t i = 0; i < batch_size; i++) {
+        feedback_infos[i] = vku::InitStructHelper();
+        feedback_infos[i].pPipelineCreationFeedback = &feedbacks[i];
+        create_infos[i] = vku::InitStructHelper(&feedback_infos[i]);
+        create_infos[i].stage = cs.GetStageCreateInfo();
+        create_infos[i].layout = pipeline_layout;
+    }
+
+    std::vector<VkPipeline> pipelines(batch_size);
+    for (uint32_t batch = 0; batch < batch_count; batch++) {
+        vk::CreateComputePipelines(device(), VK_NULL_HANDLE, batch_size, create_infos.data(), nullptr, pipelines.data());
+        for (VkPipeline pipeline : pipelines) {
+            vk::DestroyPipeline(device(), pipeline, nullptr);
+        }
+    }
+}
+
+TEST_F(PerformanceCore, CopyBufferManyRegions) {
+    // Destination regions of a copy must not overlap each other.
+    // In case of a regression this test has quadratic complexity in the region count.
+    TEST_DESCRIPTION("Record vkCmdCopyBuffer with 10k regions many times");
+    RETURN_IF_SKIP(Init());
+
+    constexpr uint32_t region_count = 10'000;
+    constexpr VkDeviceSize region_size = 16;
+    vkt::Buffer src_buffer(*m_device, region_count * region_size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::Buffer dst_buffer(*m_device, region_count * region_size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    std::vector<VkBufferCopy> regions(region_count);
+    for (uint32_t i = 0; i < region_count; i++) {
+        // Reverse the order, so regions are not already sorted
+        regions[i].srcOffset = i * region_size;
+        regions[i].dstOffset = (region_count - 1 - i) * region_size;
+        regions[i].size = region_size;
+    }
+
+    m_command_buffer.Begin();
+    for (uint32_t i = 0; i < 20; i++) {
+        vk::CmdCopyBuffer(m_command_buffer, src_buffer, dst_buffer, region_count, regions.data());
+    }
+    m_command_buffer.End();
+}
+
+TEST_F(PerformanceCore, CopyImageManyRegionsSameImage) {
+    // Like a texture atlas update: sources and destinations of a copy within the same image must not overlap.
+    // In case of a regression this test has quadratic complexity in the region count.
+    TEST_DESCRIPTION("Record vkCmdCopyImage with 10k regions within the same image many times");
+    RETURN_IF_SKIP(Init());
+
+    constexpr uint32_t tiles_per_row = 100;
+    constexpr uint32_t tile_size = 2;
+    constexpr uint32_t half_width = 256;
+    vkt::Image image(*m_device, 2 * half_width, half_width, VK_FORMAT_R8G8B8A8_UNORM,
+                     VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    image.SetLayout(VK_IMAGE_LAYOUT_GENERAL);
+
+    // Copy the tiles of the left half of the image to the right half
+    std::vector<VkImageCopy> regions(tiles_per_row * tiles_per_row);
+    for (uint32_t y = 0; y < tiles_per_row; y++) {
+        for (uint32_t x = 0; x < tiles_per_row; x++) {
+            VkImageCopy& region = regions[y * tiles_per_row + x];
+            region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+            region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+            region.srcOffset = {int32_t(x * tile_size), int32_t(y * tile_size), 0};
+            region.dstOffset = {int32_t(half_width + x * tile_size), int32_t(y * tile_size), 0};
+            region.extent = {tile_size, tile_size, 1};
+        }
+    }
+
+    m_command_buffer.Begin();
+    for (uint32_t i = 0; i < 20; i++) {
+        vk::CmdCopyImage(m_command_buffer, image, VK_IMAGE_LAYOUT_GENERAL, image, VK_IMAGE_LAYOUT_GENERAL,
+                         static_cast<uint32_t>(regions.size()), regions.data());
+    }
+    m_command_buffer.End();
+}
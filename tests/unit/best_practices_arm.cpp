@@ -17,6 +17,7 @@
 #include "render_pass_helper.h"
 #include "binding.h"
 #include <algorithm>
+#include <numeric>
 
 const char* kEnableArmValidation = "validate_best_practices_arm";
 
@@ -382,6 +383,46 @@ TEST_F(NegativeBestPracticesARM, SparseIndexBufferTest) {
     test_pipelines(sparse_ibo, sparse_indices.size(), true);
 }
 
+TEST_F(NegativeBestPracticesARM, SparseIndexBufferHostWrite) {
+    TEST_DESCRIPTION("Index buffer scans are reused between draws, make sure writing new indices to mapped memory is noticed.");
+
+    RETURN_IF_SKIP(InitBestPracticesFramework(kEnableArmValidation));
+    RETURN_IF_SKIP(InitState());
+    InitRenderTarget();
+
+    if (IsPlatformMockICD()) {
+        GTEST_SKIP() << "Test not supported by MockICD";
+    }
+
+    std::vector<uint16_t> indices(128);
+    std::iota(indices.begin(), indices.end(), uint16_t(0));
+    VkConstantBufferObj ibo(m_device, indices.size() * sizeof(uint16_t), indices.data(), VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    m_command_buffer.Begin();
+    m_command_buffer.BeginRenderPass(m_renderPassBeginInfo);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipe);
+    vk::CmdBindIndexBuffer(m_command_buffer, ibo, 0, VK_INDEX_TYPE_UINT16);
+
+    // the validation layer will only be able to analyse mapped memory, it's too expensive otherwise to do in the layer itself
+    auto* mapped_indices = static_cast<uint16_t*>(ibo.Memory().Map());
+    vk::CmdDrawIndexed(m_command_buffer, indices.size(), 1, 0, 0, 0);
+
+    mapped_indices[indices.size() - 1] = 0xFFFE;
+    m_errorMonitor->SetDesiredFailureMsg(kPerformanceWarningBit, "BestPractices-Arm-vkCmdDrawIndexed-sparse-index-buffer");
+    vk::CmdDrawIndexed(m_command_buffer, indices.size(), 1, 0, 0, 0);
+    m_errorMonitor->VerifyFound();
+
+    mapped_indices[indices.size() - 1] = uint16_t(indices.size() - 1);
+    vk::CmdDrawIndexed(m_command_buffer, indices.size(), 1, 0, 0, 0);
+    ibo.Memory().Unmap();
+
+    m_command_buffer.EndRenderPass();
+    m_command_buffer.End();
+}
+
 TEST_F(NegativeBestPracticesARM, PostTransformVertexCacheThrashingIndicesTest) {
     TEST_DESCRIPTION(
         "Test for appropriate warnings to be thrown when recording an indexed draw call where the indices thrash the "
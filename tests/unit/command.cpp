@@ -47,6 +47,37 @@ TEST_F(NegativeCommand, CommandPoolConsistency) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeCommand, CommandPoolConsistencyIgnored) {
+    TEST_DESCRIPTION("Free a command buffer from the wrong pool with the error filtered, then destroy the pool it came from.");
+
+    // The error is filtered so the free is still recorded
+    const char* ids[] = {"VUID-vkFreeCommandBuffers-pCommandBuffers-parent"};
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "message_id_filter", VK_LAYER_SETTING_TYPE_STRING_EXT, 1, ids};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::CommandPool command_pool_1(*m_device, m_device->graphics_queue_node_index_);
+    vkt::CommandPool command_pool_2(*m_device, m_device->graphics_queue_node_index_);
+
+    VkCommandBufferAllocateInfo command_buffer_allocate_info = vku::InitStructHelper();
+    command_buffer_allocate_info.commandPool = command_pool_1;
+    command_buffer_allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    VkCommandBuffer cb;
+    vk::AllocateCommandBuffers(device(), &command_buffer_allocate_info, &cb);
+
+    // The command buffer must be removed from the children of command_pool_1, not command_pool_2
+    vk::FreeCommandBuffers(device(), command_pool_2, 1, &cb);
+    command_pool_1.Destroy();
+
+    // The pool given to vkFreeCommandBuffers is still usable
+    vkt::CommandBuffer command_buffer(*m_device, command_pool_2);
+    command_buffer.Begin();
+    command_buffer.End();
+}
+
 TEST_F(NegativeCommand, IndexBufferNotBound) {
     TEST_DESCRIPTION("Run an indexed draw call without an index buffer bound.");
     RETURN_IF_SKIP(Init());
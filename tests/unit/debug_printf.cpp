@@ -13,6 +13,9 @@
 
 #include <vulkan/vulkan_core.h>
 #include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include "layer_validation_tests.h"
 #include "pipeline_helper.h"
 #include "shader_object_helper.h"
@@ -3201,6 +3204,59 @@ TEST_F(NegativeDebugPrintf, OverflowBufferLoop) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeDebugPrintf, BinaryLog) {
+    TEST_DESCRIPTION("Write the printf records to a binary log instead of formatting them");
+    const std::filesystem::path log_path = std::filesystem::temp_directory_path() / "vvl_test_printf_log.bin";
+    struct FileGuard {
+        std::filesystem::path path;
+        // The layer keeps the file open until the device is destroyed, which can prevent removing it on some platforms
+        ~FileGuard() {
+            std::error_code ec;
+            std::filesystem::remove(path, ec);
+        }
+    } log_file_guard{log_path};
+
+    const std::string log_path_str = log_path.string();
+    const char* log_path_cstr = log_path_str.c_str();
+    const VkLayerSettingEXT settings = {OBJECT_LAYER_NAME, "printf_binary_log_file", VK_LAYER_SETTING_TYPE_STRING_EXT, 1,
+                                        &log_path_cstr};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &settings};
+    RETURN_IF_SKIP(InitDebugPrintfFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const char* shader_source = R"glsl(
+        #version 450
+        #extension GL_EXT_debug_printf : enable
+        void main() {
+            uint foo = 127;
+            debugPrintfEXT("binary log == %u", foo);
+        }
+    )glsl";
+
+    CreateComputePipelineHelper pipe(*this);
+    pipe.cs_ = VkShaderObj(*m_device, shader_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    pipe.CreateComputePipeline();
+
+    m_command_buffer.Begin();
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipe);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    m_command_buffer.End();
+
+    // Nothing is reported, the message only goes to the log
+    m_default_queue->SubmitAndWait(m_command_buffer);
+
+    std::ifstream log_file(log_path, std::ios::binary);
+    ASSERT_TRUE(log_file.is_open());
+    const std::string log((std::istreambuf_iterator<char>(log_file)), std::istreambuf_iterator<char>());
+    ASSERT_GE(log.size(), 8u);
+    uint32_t header[2];
+    std::memcpy(header, log.data(), sizeof(header));
+    ASSERT_EQ(header[0], 0x504C5656u);  // "VVLP"
+    ASSERT_EQ(header[1], 1u);
+    ASSERT_NE(log.find("binary log == %u"), std::string::npos);
+}
+
 void NegativeDebugPrintf::BasicFormattingTest(const char* shader, bool warning) {
     RETURN_IF_SKIP(InitDebugPrintfFramework());
     RETURN_IF_SKIP(InitState());
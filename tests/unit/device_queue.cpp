@@ -798,3 +798,60 @@ TEST_F(NegativeDeviceQueue, ArmSchedulingControlsCreateDevice) {
     vk::CreateDevice(Gpu(), &device_ci, nullptr, &device);
     m_errorMonitor->VerifyFound();
 }
+
+TEST_F(NegativeDeviceQueue, ParallelSubmitValidation) {
+    TEST_DESCRIPTION("Validate vkQueueSubmit with all the validation objects running on the submit validation worker pool");
+    const VkLayerSettingEXT layer_setting = {OBJECT_LAYER_NAME, "parallel_submit_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1,
+                                             &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &layer_setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    // never record m_command_buffer
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->Submit(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+
+    m_command_buffer.Begin();
+    m_command_buffer.End();
+    m_default_queue->SubmitAndWait(m_command_buffer);
+}
+
+TEST_F(NegativeDeviceQueue, ParallelSubmitValidationSyncValSkippedSubmit) {
+    TEST_DESCRIPTION("A submit skipped by core validation must not be recorded by sync validation validating in parallel");
+    const std::array<VkLayerSettingEXT, 2> layer_settings = {{
+        {OBJECT_LAYER_NAME, "parallel_submit_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue},
+        {OBJECT_LAYER_NAME, "syncval_submit_time_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue},
+    }};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                               size32(layer_settings), layer_settings.data()};
+    const VkValidationFeatureEnableEXT syncval_enable = VK_VALIDATION_FEATURE_ENABLE_SYNCHRONIZATION_VALIDATION_EXT;
+    VkValidationFeaturesEXT validation_features = vku::InitStructHelper(&layer_settings_create_info);
+    validation_features.enabledValidationFeatureCount = 1;
+    validation_features.pEnabledValidationFeatures = &syncval_enable;
+    AddRequiredExtensions(VK_EXT_VALIDATION_FEATURES_EXTENSION_NAME);
+    RETURN_IF_SKIP(InitFramework(&validation_features));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer_a(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    vkt::Buffer buffer_b(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    vkt::CommandBuffer cb_write(*m_device, m_command_pool);
+    cb_write.Begin();
+    vk::CmdFillBuffer(cb_write, buffer_a, 0, 256, 0);
+    cb_write.End();
+
+    // never record m_command_buffer, core validation skips the submit and the fill never reaches the driver
+    m_errorMonitor->SetDesiredError("VUID-vkQueueSubmit-pCommandBuffers-00070");
+    m_default_queue->Submit({cb_write.handle(), m_command_buffer.handle()});
+    m_errorMonitor->VerifyFound();
+
+    // No hazard with the fill that was not submitted
+    vkt::CommandBuffer cb_read(*m_device, m_command_pool);
+    cb_read.Begin();
+    VkBufferCopy region = {0, 0, 256};
+    vk::CmdCopyBuffer(cb_read, buffer_a, buffer_b, 1, &region);
+    cb_read.End();
+    m_default_queue->SubmitAndWait(cb_read);
+}
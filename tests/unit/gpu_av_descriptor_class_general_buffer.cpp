@@ -2870,4 +2870,68 @@ TEST_F(NegativeGpuAVDescriptorClassGeneralBuffer, SecondaryCommandBuffer) {
     m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-storageBuffers-06936");
     m_default_queue->SubmitAndWait(m_command_buffer);
     m_errorMonitor->VerifyFound();
-}
\ No newline at end of file
+}
+
+TEST_F(NegativeGpuAVDescriptorClassGeneralBuffer, ParallelShaderInstrumentation) {
+    TEST_DESCRIPTION("Create several pipelines in one call while the shaders are instrumented on worker threads");
+    std::vector<VkLayerSettingEXT> layer_settings = {
+        {OBJECT_LAYER_NAME, "gpuav_parallel_shader_instrumentation", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue}};
+    RETURN_IF_SKIP(InitGpuAvFramework(layer_settings));
+    RETURN_IF_SKIP(InitState());
+
+    const char* cs_uniform_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) uniform foo { uvec4 a; uvec4 b; };
+        layout(set = 0, binding = 1) buffer bar { uint data[]; };
+        void main() {
+            data[0] = b.x;
+        }
+    )glsl";
+    const char* cs_storage_source = R"glsl(
+        #version 450
+        layout(set = 0, binding = 0) uniform foo { uvec4 a; };
+        layout(set = 0, binding = 1) buffer bar { uint data[]; };
+        void main() {
+            data[4] = a.x;
+        }
+    )glsl";
+
+    vkt::Buffer uniform_buffer(*m_device, 16, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, kHostVisibleMemProps);
+    vkt::Buffer storage_buffer(*m_device, 16, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, kHostVisibleMemProps);
+    OneOffDescriptorSet descriptor_set(m_device, {{0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                                  {1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}});
+    const vkt::PipelineLayout pipeline_layout(*m_device, {&descriptor_set.layout_});
+    descriptor_set.WriteDescriptorBufferInfo(0, uniform_buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+    descriptor_set.WriteDescriptorBufferInfo(1, storage_buffer, 0, VK_WHOLE_SIZE, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
+    descriptor_set.UpdateDescriptorSets();
+
+    VkShaderObj cs_uniform(*m_device, cs_uniform_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    VkShaderObj cs_storage(*m_device, cs_storage_source, VK_SHADER_STAGE_COMPUTE_BIT);
+    std::array<VkComputePipelineCreateInfo, 2> create_infos;
+    create_infos[0] = vku::InitStructHelper();
+    create_infos[0].stage = cs_uniform.GetStageCreateInfo();
+    create_infos[0].layout = pipeline_layout;
+    create_infos[1] = create_infos[0];
+    create_infos[1].stage = cs_storage.GetStageCreateInfo();
+
+    std::array<VkPipeline, 2> pipelines = {VK_NULL_HANDLE, VK_NULL_HANDLE};
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, size32(create_infos), create_infos.data(), nullptr, pipelines.data());
+
+    m_command_buffer.Begin();
+    vk::CmdBindDescriptorSets(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_layout, 0, 1, &descriptor_set.set_, 0,
+                              nullptr);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelines[0]);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    vk::CmdBindPipeline(m_command_buffer, VK_PIPELINE_BIND_POINT_COMPUTE, pipelines[1]);
+    vk::CmdDispatch(m_command_buffer, 1, 1, 1);
+    m_command_buffer.End();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-uniformBuffers-06935");
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDispatch-storageBuffers-06936");
+    m_default_queue->SubmitAndWait(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+
+    for (VkPipeline pipeline : pipelines) {
+        vk::DestroyPipeline(device(), pipeline, nullptr);
+    }
+}
@@ -15,6 +15,10 @@
  * limitations under the License.
  */
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
 #include "layer_validation_tests.h"
 #include "pipeline_helper.h"
 #include "descriptor_helper.h"
@@ -913,3 +917,98 @@ TEST_F(PositiveGpuAVSpirv, MultiEntrypointVulkan11) {
     pipe.shader_stages_ = {vs.GetStageCreateInfo(), fs.GetStageCreateInfo()};
     pipe.CreateGraphicsPipeline();
 }
+
+// Reads the dump_<id>_after.spv files written by gpuav_debug_dump_instrumented_shaders, and removes all the dumps
+static std::map<uint32_t, std::vector<char>> TakeInstrumentedShaderDumps() {
+    std::map<uint32_t, std::vector<char>> dumps;
+    std::vector<std::filesystem::path> dump_paths;
+    for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::current_path())) {
+        const std::string name = entry.path().filename().string();
+        const bool after = name.size() > 10 && name.compare(name.size() - 10, 10, "_after.spv") == 0;
+        const bool before = name.size() > 11 && name.compare(name.size() - 11, 11, "_before.spv") == 0;
+        if (name.rfind("dump_", 0) != 0 || (!after && !before)) {
+            continue;
+        }
+        if (after) {
+            std::ifstream file(entry.path(), std::ios::binary);
+            std::vector<char>& spirv = dumps[uint32_t(std::stoul(name.substr(5)))];
+            spirv.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        }
+        dump_paths.emplace_back(entry.path());
+    }
+    for (const auto& path : dump_paths) {
+        std::filesystem::remove(path);
+    }
+    return dumps;
+}
+
+TEST_F(PositiveGpuAVSpirv, PassManagerSameInstrumentation) {
+    TEST_DESCRIPTION("The passes sharing the PassManager analysis instrument the same SPIR-V as when each pass walks the shader");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    AddRequiredFeature(vkt::Feature::bufferDeviceAddress);
+    AddRequiredFeature(vkt::Feature::runtimeDescriptorArray);
+    AddRequiredFeature(vkt::Feature::shaderStorageBufferArrayNonUniformIndexing);
+
+    const std::string header = R"glsl(
+        #version 450
+        #extension GL_EXT_nonuniform_qualifier : enable
+        #extension GL_EXT_buffer_reference : enable
+        layout(buffer_reference, std430) buffer Ptr { uint v[]; };
+        layout(set = 0, binding = 0) buffer SSBO { uint index; Ptr ptr; uint data[]; } ssbo[];
+        layout(set = 0, binding = 1) uniform usamplerBuffer u_texel;
+        layout(set = 0, binding = 2, r32ui) uniform uimageBuffer s_texel;
+    )glsl";
+    // Several candidates of the texel buffer pass in a block the passes before it have split
+    std::string many_checks = header + "void main() {\n uint acc = 0;\n";
+    for (uint32_t i = 0; i < 32; ++i) {
+        const std::string n = std::to_string(i);
+        many_checks += "acc += ssbo[nonuniformEXT(acc % 4)].data[acc + " + n + "] + texelFetch(u_texel, int(acc)).x;\n";
+        many_checks += "imageStore(s_texel, int(acc + " + n + "), uvec4(ssbo[0].ptr.v[acc % " + std::to_string(i + 1) + "]));\n";
+        many_checks += "if (acc > " + n + ") { acc ^= imageLoad(s_texel, int(ssbo[1].index)).x; }\n";
+    }
+    many_checks += "ssbo[0].data[0] = acc;\n}\n";
+
+    const std::vector<std::string> corpus = {
+        header + "void main() { ssbo[0].data[gl_GlobalInvocationID.x] = ssbo[1].data[gl_GlobalInvocationID.x + 1]; }",
+        header + R"glsl(
+        void main() {
+            uint x = texelFetch(u_texel, int(gl_GlobalInvocationID.x)).x;
+            for (uint i = 0; i < ssbo[0].index; i++) {
+                x += imageLoad(s_texel, int(i)).x;
+                imageStore(s_texel, int(i + x), uvec4(x));
+            }
+            ssbo[0].ptr.v[x] = x;
+        }
+        )glsl",
+        many_checks,
+    };
+
+    // Each run dumps the instrumented SPIR-V of the corpus, first with the PassManager analysis and then without
+    std::vector<std::map<uint32_t, std::vector<char>>> runs;
+    for (const VkBool32* disable_pass_manager : {&kVkFalse, &kVkTrue}) {
+        std::vector<VkLayerSettingEXT> layer_settings = {
+            {OBJECT_LAYER_NAME, "gpuav_debug_dump_instrumented_shaders", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, &kVkTrue},
+            {OBJECT_LAYER_NAME, "gpuav_debug_disable_pass_manager", VK_LAYER_SETTING_TYPE_BOOL32_EXT, 1, disable_pass_manager}};
+        RETURN_IF_SKIP(InitGpuAvFramework(layer_settings));
+        RETURN_IF_SKIP(InitState());
+        TakeInstrumentedShaderDumps();
+
+        for (const std::string& source : corpus) {
+            CreateComputePipelineHelper pipe(*this);
+            pipe.dsl_bindings_ = {{0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 4, VK_SHADER_STAGE_ALL, nullptr},
+                                  {1, VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr},
+                                  {2, VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER, 1, VK_SHADER_STAGE_ALL, nullptr}};
+            pipe.cs_ = VkShaderObj(*m_device, source.c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_2);
+            pipe.CreateComputePipeline();
+        }
+
+        ShutdownFramework();
+        runs.emplace_back(TakeInstrumentedShaderDumps());
+    }
+
+    ASSERT_GE(runs[0].size(), corpus.size());
+    ASSERT_EQ(runs[0].size(), runs[1].size());
+    for (const auto& [id, spirv] : runs[0]) {
+        EXPECT_TRUE(runs[1][id] == spirv) << "instrumented shader " << id << " differs without the PassManager";
+    }
+}
@@ -2693,6 +2693,38 @@ TEST_F(NegativeGraphicsLibrary, MultisampleStateFragShaderLibrary) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeGraphicsLibrary, MultisampleStateSampleMask) {
+    TEST_DESCRIPTION("pMultisampleState only differing by pSampleMask, the libraries must not share the state");
+    SetTargetApiVersion(VK_API_VERSION_1_2);
+    RETURN_IF_SKIP(InitBasicGraphicsLibrary());
+    InitRenderTarget();
+
+    const VkSampleMask frag_shader_mask = 0x1;
+    const VkSampleMask frag_out_mask = 0x0;
+
+    vkt::PipelineLayout pipeline_layout(*m_device, {});
+    const auto fs_spv = GLSLToSPV(VK_SHADER_STAGE_FRAGMENT_BIT, kFragmentMinimalGlsl);
+    vkt::GraphicsPipelineLibraryStage fs_stage(fs_spv, VK_SHADER_STAGE_FRAGMENT_BIT);
+    CreatePipelineHelper frag_shader_lib(*this);
+    frag_shader_lib.InitFragmentLibInfo(&fs_stage.stage_ci);
+    frag_shader_lib.gp_ci_.layout = pipeline_layout;
+    frag_shader_lib.ms_ci_.pSampleMask = &frag_shader_mask;
+    frag_shader_lib.CreateGraphicsPipeline(false);
+
+    VkPipelineLibraryCreateInfoKHR link_info = vku::InitStructHelper();
+    link_info.libraryCount = 1;
+    link_info.pLibraries = &frag_shader_lib.Handle();
+
+    CreatePipelineHelper frag_out_lib(*this);
+    frag_out_lib.InitFragmentOutputLibInfo(&link_info);
+    frag_out_lib.gp_ci_.layout = pipeline_layout;
+    frag_out_lib.ms_ci_.pSampleMask = &frag_out_mask;
+    frag_out_lib.gp_ci_.flags = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR;
+    m_errorMonitor->SetDesiredError("VUID-VkGraphicsPipelineCreateInfo-pLibraries-06634");
+    frag_out_lib.CreateGraphicsPipeline(false);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeGraphicsLibrary, MultisampleStateFragOutputNull) {
     TEST_DESCRIPTION("fragment output has null Multisample state while Fragment Shader has one");
     SetTargetApiVersion(VK_API_VERSION_1_2);
@@ -550,4 +550,112 @@ TEST_F(NegativeLayerSettings, JsonEscapeParentheses) {
     m_errorMonitor->SetDesiredError("\\\"foo\\\"");
     pipe.CreateComputePipeline();
     m_errorMonitor->VerifyFound();
-}
\ No newline at end of file
+}
+
+TEST_F(NegativeLayerSettings, ValidationSamplingPeriod) {
+    TEST_DESCRIPTION("Only one in every validation_sampling_period recordings of a command buffer is validated by core validation");
+    const uint32_t period = 3;
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "validation_sampling_period", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1,
+                                       &period};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    vkt::Buffer buffer(*m_device, 32, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+    vkt::CommandBuffer cb(*m_device, m_command_pool);
+    // Whichever recording the command buffer starts at, exactly one of |period| recordings is sampled
+    m_errorMonitor->SetDesiredError("VUID-vkCmdFillBuffer-dstBuffer-00029");
+    for (uint32_t i = 0; i < period; ++i) {
+        cb.Begin();
+        vk::CmdFillBuffer(cb, buffer, 0, 4, 0);
+        cb.End();
+    }
+    m_errorMonitor->VerifyFound();
+
+    // Parameter validation is cheap, it still checks every recording
+    m_errorMonitor->SetDesiredError("VUID-vkCmdSetViewport-viewportCount-arraylength", period);
+    for (uint32_t i = 0; i < period; ++i) {
+        cb.Begin();
+        vk::CmdSetViewport(cb, 0, 0, nullptr);
+        cb.End();
+    }
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeLayerSettings, CheckThrottleKeepsFailingChecks) {
+    TEST_DESCRIPTION("Checks over check_throttle_budget_ns are only skipped on objects they passed on, errors are still reported");
+    const uint32_t budget_ns = 1;
+    const uint32_t passes = 1;
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "check_throttle_budget_ns", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &budget_ns},
+        {OBJECT_LAYER_NAME, "check_throttle_passes", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &passes}};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2, settings};
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    vkt::Image src_image(*m_device, 64, 64, format, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    vkt::Image dst_image(*m_device, 64, 64, format, VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT);
+    src_image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    dst_image.SetLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+    VkImageCopy copy_region = {};
+    copy_region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.extent = {64, 64, 1};
+
+    // The destination is not in the layout the copy uses, every submit fails the check so it is never throttled
+    m_command_buffer.Begin();
+    vk::CmdCopyImage(m_command_buffer, src_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_image,
+                     VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy_region);
+    m_command_buffer.End();
+    for (uint32_t i = 0; i < 3; ++i) {
+        m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-09600");
+        m_default_queue->SubmitAndWait(m_command_buffer);
+        m_errorMonitor->VerifyFound();
+    }
+}
+
+TEST_F(NegativeLayerSettings, CheckThrottleSkipsPassingChecks) {
+    TEST_DESCRIPTION("Checks over check_throttle_budget_ns are skipped on a recording they passed on, until it is recorded again");
+    const uint32_t budget_ns = 1;
+    const uint32_t passes = 1;
+    const VkLayerSettingEXT settings[2] = {
+        {OBJECT_LAYER_NAME, "check_throttle_budget_ns", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &budget_ns},
+        {OBJECT_LAYER_NAME, "check_throttle_passes", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &passes}};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 2, settings};
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const VkFormat format = VK_FORMAT_R8G8B8A8_UNORM;
+    const VkImageUsageFlags usage =
+        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    vkt::Image src_image(*m_device, 64, 64, format, usage);
+    vkt::Image dst_image(*m_device, 64, 64, format, usage);
+    src_image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+    dst_image.SetLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+
+    VkImageCopy copy_region = {};
+    copy_region.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+    copy_region.extent = {64, 64, 1};
+    auto record = [&]() {
+        m_command_buffer.Begin();
+        vk::CmdCopyImage(m_command_buffer, src_image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst_image,
+                         VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copy_region);
+        m_command_buffer.End();
+    };
+
+    record();
+    m_default_queue->SubmitAndWait(m_command_buffer);
+
+    // The recording passed once, the image layouts are not checked again so the wrong layout is missed
+    dst_image.SetLayout(VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    m_default_queue->SubmitAndWait(m_command_buffer);
+
+    // A new recording is checked again
+    record();
+    m_errorMonitor->SetDesiredError("VUID-vkCmdDraw-None-09600");
+    m_default_queue->SubmitAndWait(m_command_buffer);
+    m_errorMonitor->VerifyFound();
+}
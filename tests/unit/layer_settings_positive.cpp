@@ -11,6 +11,8 @@
  */
 // stype-check off
 
+#include <filesystem>
+#include <fstream>
 #include "layer_validation_tests.h"
 
 class PositiveLayerSettings : public VkLayerTest {};
@@ -105,3 +107,78 @@ TEST_F(PositiveLayerSettings, DebugAction) {
     RETURN_IF_SKIP(InitState());
     Monitor().VerifyFound();
 }
+
+TEST_F(PositiveLayerSettings, ApiTimingFile) {
+    TEST_DESCRIPTION("The api_timing_file report is written when the instance is destroyed");
+    const std::filesystem::path report_path = std::filesystem::temp_directory_path() / "vvl_test_api_timing.csv";
+    std::filesystem::remove(report_path);
+
+    const std::string report_path_str = report_path.string();
+    const char* report_path_cstr = report_path_str.c_str();
+    const VkLayerSettingEXT setting = {OBJECT_LAYER_NAME, "api_timing_file", VK_LAYER_SETTING_TYPE_STRING_EXT, 1,
+                                       &report_path_cstr};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1, &setting};
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+
+    {
+        vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+        m_command_buffer.Begin();
+        vk::CmdFillBuffer(m_command_buffer, buffer, 0, 256, 0);
+        m_command_buffer.End();
+    }
+    ShutdownFramework();  // Destroy Instance/Device
+
+    std::ifstream report(report_path);
+    ASSERT_TRUE(report.is_open());
+    const std::string content((std::istreambuf_iterator<char>(report)), std::istreambuf_iterator<char>());
+    report.close();
+    std::filesystem::remove(report_path);
+
+    EXPECT_EQ(content.rfind("Zone Name,Count,Total (ms),Avg (ms),Min (ms),Max (ms)\n", 0), 0u);
+    EXPECT_NE(content.find("CoreChecks::PreCallValidate_vkCmdFillBuffer,1,"), std::string::npos);
+    EXPECT_NE(content.find("Driver::Dispatch_vkCmdFillBuffer,1,"), std::string::npos);
+    EXPECT_NE(content.find("\nvkCmdFillBuffer,1,"), std::string::npos);
+    // Every check is in a family, the ones not timed on their own are in Other
+    EXPECT_NE(content.find("CoreChecks::Check::Other_vkCmdFillBuffer,1,"), std::string::npos);
+    EXPECT_NE(content.find("\nCheck::Other,"), std::string::npos);
+}
+
+TEST_F(PositiveLayerSettings, MemoryReport) {
+    TEST_DESCRIPTION("The memory_report_frames setting logs the memory of the validation state every N presents");
+    const uint32_t memory_report_frames = 2;
+    const char* report_flags[3] = {"error", "warn", "info"};
+    const std::array<VkLayerSettingEXT, 2> settings = {{
+        {OBJECT_LAYER_NAME, "memory_report_frames", VK_LAYER_SETTING_TYPE_UINT32_EXT, 1, &memory_report_frames},
+        {OBJECT_LAYER_NAME, "report_flags", VK_LAYER_SETTING_TYPE_STRING_EXT, 3, report_flags},
+    }};
+    VkLayerSettingsCreateInfoEXT create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr,
+                                                (uint32_t)settings.size(), settings.data()};
+    AddSurfaceExtension();
+    RETURN_IF_SKIP(InitFramework(&create_info));
+    RETURN_IF_SKIP(InitState());
+    RETURN_IF_SKIP(InitSwapchain());
+
+    vkt::Buffer buffer(*m_device, 256, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    m_command_buffer.Begin();
+    vk::CmdFillBuffer(m_command_buffer, buffer, 0, 256, 0);
+    m_command_buffer.End();
+    m_default_queue->SubmitAndWait(m_command_buffer);
+
+    vkt::Fence image_acquired(*m_device);
+    const auto swapchain_images = m_swapchain.GetImages();
+    for (uint32_t frame = 0; frame < memory_report_frames; ++frame) {
+        const uint32_t image_index = m_swapchain.AcquireNextImage(image_acquired, kWaitTimeout);
+        image_acquired.Wait(kWaitTimeout);
+        image_acquired.Reset();
+        SetPresentImageLayout(swapchain_images[image_index]);
+
+        // Only the second present reports the memory
+        if (frame == memory_report_frames - 1) {
+            m_errorMonitor->SetDesiredInfo("StateTracker::CommandBuffer");
+        }
+        m_default_queue->Present(m_swapchain, image_index, vkt::no_semaphore);
+        m_default_queue->Wait();
+    }
+    m_errorMonitor->VerifyFound();
+}
@@ -871,6 +871,23 @@ TEST_F(NegativeOther, DuplicateValidPNextStructures) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeOther, CyclicPNextChain) {
+    TEST_DESCRIPTION("Create a pNext chain where the last structure points back to an earlier one");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    RETURN_IF_SKIP(Init());
+
+    // A -> B -> C -> B -> ...
+    VkPhysicalDeviceProtectedMemoryProperties protected_memory_properties = vku::InitStructHelper();
+    VkPhysicalDeviceIDProperties id_properties = vku::InitStructHelper(&protected_memory_properties);
+    protected_memory_properties.pNext = &id_properties;
+    VkPhysicalDeviceProperties2 physical_device_properties2 = vku::InitStructHelper(&id_properties);
+
+    m_errorMonitor->SetDesiredError("UNASSIGNED-GeneralParameterError-pNextCycle");
+    vk::GetPhysicalDeviceProperties2(Gpu(), &physical_device_properties2);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeOther, GetPhysicalDeviceImageFormatPropertiesFlags) {
     RETURN_IF_SKIP(Init());
     if (DeviceExtensionSupported(Gpu(), nullptr, VK_KHR_MAINTENANCE_5_EXTENSION_NAME)) {
@@ -964,6 +964,22 @@ TEST_F(NegativePipeline, ColorBlendUnsupportedLogicOp) {
                                       "VUID-VkPipelineColorBlendStateCreateInfo-logicOpEnable-00606");
 }
 
+TEST_F(NegativePipeline, ColorBlendUnsupportedLogicOpSharedState) {
+    TEST_DESCRIPTION("Pipelines only differing by their color blend state must not share it");
+
+    RETURN_IF_SKIP(Init());
+    InitRenderTarget();
+
+    CreatePipelineHelper pipe(*this);
+    pipe.CreateGraphicsPipeline();
+
+    CreatePipelineHelper logic_op_pipe(*this);
+    logic_op_pipe.cb_ci_.logicOpEnable = VK_TRUE;
+    m_errorMonitor->SetDesiredError("VUID-VkPipelineColorBlendStateCreateInfo-logicOpEnable-00606");
+    logic_op_pipe.CreateGraphicsPipeline();
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativePipeline, ColorBlendUnsupportedDualSourceBlend) {
     TEST_DESCRIPTION("Attempt to use dual-source blending when dualSrcBlend feature is disabled.");
     RETURN_IF_SKIP(Init());
@@ -3768,6 +3784,32 @@ TEST_F(NegativePipeline, IndependentSetsCompute) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativePipeline, ParallelPipelineValidation) {
+    TEST_DESCRIPTION("Validate a batch of compute pipelines on the pipeline validation worker pool");
+    AddRequiredExtensions(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+    const VkLayerSettingEXT layer_setting = {OBJECT_LAYER_NAME, "parallel_pipeline_validation", VK_LAYER_SETTING_TYPE_BOOL32_EXT,
+                                             1, &kVkTrue};
+    VkLayerSettingsCreateInfoEXT layer_settings_create_info = {VK_STRUCTURE_TYPE_LAYER_SETTINGS_CREATE_INFO_EXT, nullptr, 1,
+                                                               &layer_setting};
+    RETURN_IF_SKIP(InitFramework(&layer_settings_create_info));
+    RETURN_IF_SKIP(InitState());
+
+    const vkt::PipelineLayout bad_layout(*m_device, {}, {}, VK_PIPELINE_LAYOUT_CREATE_INDEPENDENT_SETS_BIT_EXT);
+    CreateComputePipelineHelper pipe(*this);
+    pipe.LateBindPipelineInfo();
+
+    // Every odd create info is invalid
+    constexpr uint32_t pipeline_count = 16;
+    std::vector<VkComputePipelineCreateInfo> create_infos(pipeline_count, pipe.cp_ci_);
+    for (uint32_t i = 1; i < pipeline_count; i += 2) {
+        create_infos[i].layout = bad_layout;
+    }
+    std::vector<VkPipeline> pipelines(pipeline_count, VK_NULL_HANDLE);
+    m_errorMonitor->SetDesiredError("VUID-VkComputePipelineCreateInfo-layout-12396", pipeline_count / 2);
+    vk::CreateComputePipelines(device(), VK_NULL_HANDLE, pipeline_count, create_infos.data(), nullptr, pipelines.data());
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativePipeline, PipelineCreationFlags2Library) {
     TEST_DESCRIPTION("Test VK_PIPELINE_CREATE_LIBRARY_BIT_KHR with VkPipelineCreateFlags2");
     SetTargetApiVersion(VK_API_VERSION_1_1);
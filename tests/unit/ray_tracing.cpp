@@ -3963,6 +3963,123 @@ TEST_F(NegativeRayTracing, HostBuildOverlappingScratchBuffers) {
     m_errorMonitor->VerifyFound();
 }
 
+TEST_F(NegativeRayTracing, HostBuildOverlappingScratchBuildRanges) {
+    TEST_DESCRIPTION("Host build where the scratch overlap is only found with the build ranges of the right info");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::accelerationStructureHostCommands);
+    RETURN_IF_SKIP(Init());
+
+    std::vector<vkt::as::BuildGeometryInfoKHR> blas_vec;
+    for (size_t i = 0; i < 3; ++i) {
+        auto blas = vkt::as::blueprint::BuildGeometryInfoSimpleOnHostBottomLevel(*m_device);
+        blas.SetEnableScratchBuild(false);
+        blas_vec.emplace_back(std::move(blas));
+    }
+    blas_vec[2].GetGeometries()[0].SetPrimitiveCount(64);
+
+    const VkDeviceSize small_scratch_size = blas_vec[0].GetSizeInfo().buildScratchSize;
+    const VkDeviceSize large_scratch_size = blas_vec[2].GetSizeInfo().buildScratchSize;
+    if (large_scratch_size <= small_scratch_size) {
+        GTEST_SKIP() << "Scratch size does not grow with the primitive count";
+    }
+
+    // pInfos[2] scratch starts at 0, pInfos[1] scratch starts right after where pInfos[0] scratch would end,
+    // so they only overlap when the scratch size of pInfos[2] is computed with ppBuildRangeInfos[2]
+    auto scratch_data =
+        std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(2 * (large_scratch_size + small_scratch_size)), uint8_t(0));
+    for (auto& blas : blas_vec) {
+        blas.SetHostScratchBuffer(scratch_data);
+    }
+    blas_vec[1].GetInfo().scratchData.hostAddress = scratch_data->data() + small_scratch_size;
+    blas_vec[0].GetInfo().scratchData.hostAddress = scratch_data->data() + large_scratch_size + small_scratch_size;
+
+    m_errorMonitor->SetDesiredErrorRegex("VUID-vkBuildAccelerationStructuresKHR-scratchData-03704",
+                                         "pInfos\\[1\\]\\.scratchData overlaps with pInfos\\[2\\]\\.scratchData");
+    vkt::as::BuildHostAccelerationStructuresKHR(*m_device, blas_vec);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeRayTracing, HostBuildOverlappingDstAccelStructs) {
+    TEST_DESCRIPTION("Host build where the destination acceleration structures of the last two infos share memory");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::accelerationStructureHostCommands);
+    RETURN_IF_SKIP(Init());
+
+    std::vector<vkt::as::BuildGeometryInfoKHR> blas_vec;
+    for (size_t i = 0; i < 3; ++i) {
+        blas_vec.emplace_back(vkt::as::blueprint::BuildGeometryInfoSimpleOnHostBottomLevel(*m_device));
+    }
+
+    VkBufferCreateInfo blas_buffer_ci = vku::InitStructHelper();
+    blas_buffer_ci.size = blas_vec[1].GetSizeInfo().accelerationStructureSize;
+    blas_buffer_ci.usage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    vkt::Buffer buffer_1(*m_device, blas_buffer_ci, vkt::no_mem);
+    vkt::Buffer buffer_2(*m_device, blas_buffer_ci, vkt::no_mem);
+    vkt::DeviceMemory buffer_memory(
+        *m_device, vkt::DeviceMemory::GetResourceAllocInfo(*m_device, buffer_1.MemoryRequirements(), kHostVisibleMemProps));
+    buffer_1.BindMemory(buffer_memory, 0);
+    buffer_2.BindMemory(buffer_memory, 0);
+    blas_vec[1].GetDstAS()->SetDeviceBuffer(std::move(buffer_1));
+    blas_vec[2].GetDstAS()->SetDeviceBuffer(std::move(buffer_2));
+
+    // The overlap is reported with the absolute index of both infos
+    m_errorMonitor->SetDesiredErrorRegex(
+        "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03702",
+        "pInfos\\[1\\]\\.dstAccelerationStructure and pInfos\\[2\\]\\.dstAccelerationStructure memory overlap");
+    vkt::as::BuildHostAccelerationStructuresKHR(*m_device, blas_vec);
+    m_errorMonitor->VerifyFound();
+}
+
+TEST_F(NegativeRayTracing, HostBuildDstOverlapsEarlierUpdateSrc) {
+    TEST_DESCRIPTION("Host build where a destination acceleration structure shares memory with the source of an earlier update");
+
+    SetTargetApiVersion(VK_API_VERSION_1_1);
+    AddRequiredExtensions(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+    AddRequiredFeature(vkt::Feature::accelerationStructure);
+    AddRequiredFeature(vkt::Feature::accelerationStructureHostCommands);
+    RETURN_IF_SKIP(Init());
+
+    auto src_blas = vkt::as::blueprint::BuildGeometryInfoSimpleOnHostBottomLevel(*m_device);
+    src_blas.AddFlags(VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR);
+
+    VkBufferCreateInfo blas_buffer_ci = vku::InitStructHelper();
+    blas_buffer_ci.size = src_blas.GetSizeInfo().accelerationStructureSize;
+    blas_buffer_ci.usage = VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    vkt::Buffer buffer_1(*m_device, blas_buffer_ci, vkt::no_mem);
+    vkt::Buffer buffer_2(*m_device, blas_buffer_ci, vkt::no_mem);
+    vkt::DeviceMemory buffer_memory(
+        *m_device, vkt::DeviceMemory::GetResourceAllocInfo(*m_device, buffer_1.MemoryRequirements(), kHostVisibleMemProps));
+    buffer_1.BindMemory(buffer_memory, 0);
+    buffer_2.BindMemory(buffer_memory, 0);
+
+    src_blas.GetDstAS()->SetDeviceBuffer(std::move(buffer_1));
+    src_blas.BuildHost();
+
+    std::vector<vkt::as::BuildGeometryInfoKHR> blas_vec;
+    auto update_blas = vkt::as::blueprint::BuildGeometryInfoSimpleOnHostBottomLevel(*m_device);
+    update_blas.SetMode(VK_BUILD_ACCELERATION_STRUCTURE_MODE_UPDATE_KHR);
+    update_blas.SetSrcAS(src_blas.GetDstAS());
+    update_blas.AddFlags(VK_BUILD_ACCELERATION_STRUCTURE_ALLOW_UPDATE_BIT_KHR);
+    blas_vec.emplace_back(std::move(update_blas));
+
+    auto blas = vkt::as::blueprint::BuildGeometryInfoSimpleOnHostBottomLevel(*m_device);
+    blas.GetDstAS()->SetDeviceBuffer(std::move(buffer_2));
+    blas_vec.emplace_back(std::move(blas));
+
+    // pInfos[1] comes after the update, the overlap has to be found from its destination as well
+    m_errorMonitor->SetDesiredErrorRegex(
+        "VUID-vkBuildAccelerationStructuresKHR-dstAccelerationStructure-03701",
+        "pInfos\\[1\\]\\.dstAccelerationStructure and pInfos\\[0\\]\\.srcAccelerationStructure memory overlap");
+    vkt::as::BuildHostAccelerationStructuresKHR(*m_device, blas_vec);
+    m_errorMonitor->VerifyFound();
+}
+
 TEST_F(NegativeRayTracing, AccelerationStructureGeometry) {
     TEST_DESCRIPTION("Test VkAccelerationStructureGeometryKHR parameters");
 
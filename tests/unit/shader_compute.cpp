@@ -181,6 +181,55 @@ TEST_F(NegativeShaderCompute, SharedMemorySpecConstantSet) {
     CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
 }
 
+TEST_F(NegativeShaderCompute, SharedMemorySpecConstantCachedModule) {
+    TEST_DESCRIPTION("Specializing a module already specialized without errors with other data still reports the errors");
+
+    RETURN_IF_SKIP(Init());
+
+    const uint32_t max_shared_memory_size = m_device->Physical().limits_.maxComputeSharedMemorySize;
+    const uint32_t max_shared_ints = max_shared_memory_size / 4;
+
+    std::ostringstream cs_source;
+    cs_source << R"glsl(
+        #version 450
+        layout(constant_id = 0) const uint Condition = 0;
+        layout(constant_id = 1) const uint SharedSize = )glsl";
+    cs_source << (max_shared_ints + 16);
+    cs_source << R"glsl(;
+
+        #define enableSharedMemoryOpt (Condition == 1)
+        shared uint arr[enableSharedMemoryOpt ? SharedSize : 1];
+        void main(){}
+    )glsl";
+
+    uint32_t data = 0;
+
+    VkSpecializationMapEntry entry;
+    entry.constantID = 0;
+    entry.offset = 0;
+    entry.size = sizeof(uint32_t);
+
+    VkSpecializationInfo specialization_info = {};
+    specialization_info.mapEntryCount = 1;
+    specialization_info.pMapEntries = &entry;
+    specialization_info.dataSize = sizeof(uint32_t);
+    specialization_info.pData = &data;
+
+    const auto set_info = [&](CreateComputePipelineHelper& helper) {
+        helper.cs_ = VkShaderObj(*m_device, cs_source.str().c_str(), VK_SHADER_STAGE_COMPUTE_BIT, SPV_ENV_VULKAN_1_0,
+                                 SPV_SOURCE_GLSL, &specialization_info);
+    };
+    // Valid, so the specialized module is cached
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+
+    // Same SPIR-V and map entries, only the data differs
+    data = 1;
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit, "VUID-RuntimeSpirv-Workgroup-06530");
+
+    data = 0;
+    CreateComputePipelineHelper::OneshotTest(*this, set_info, kErrorBit);
+}
+
 TEST_F(NegativeShaderCompute, WorkGroupSizeSpecConstant) {
     TEST_DESCRIPTION("Validate compute shader shared memory does not exceed maxComputeWorkGroupSize");
 
@@ -579,6 +579,95 @@ TEST_F(NegativeSparseBuffer, OverlappingBufferCopy4) {
     m_default_queue->Wait();
 }
 
+TEST_F(NegativeSparseBuffer, OverlappingBufferCopyRebindSplit) {
+    TEST_DESCRIPTION("Test overlapping sparse buffers' copy from the end of a binding split by a later bind");
+
+    AddRequiredFeature(vkt::Feature::sparseBinding);
+    RETURN_IF_SKIP(Init());
+
+    if (m_device->QueuesWithSparseCapability().empty()) {
+        GTEST_SKIP() << "Required SPARSE_BINDING queue families not present";
+    }
+
+    vkt::Semaphore semaphore(*m_device);
+
+    VkBufferCreateInfo b_info = vkt::Buffer::CreateInfo(256, VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+    b_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT;
+    vkt::Buffer buffer_sparse2(*m_device, b_info, vkt::no_mem);
+    const VkDeviceSize page_size = buffer_sparse2.MemoryRequirements().size;
+
+    b_info.size = 4 * page_size;
+    vkt::Buffer buffer_sparse(*m_device, b_info, vkt::no_mem);
+
+    const VkMemoryRequirements buffer_mem_reqs = buffer_sparse.MemoryRequirements();
+    VkMemoryAllocateInfo buffer_mem_alloc =
+        vkt::DeviceMemory::GetResourceAllocInfo(*m_device, buffer_mem_reqs, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    vkt::DeviceMemory buffer_mem(*m_device, buffer_mem_alloc);
+    buffer_mem_alloc.allocationSize = page_size;
+    vkt::DeviceMemory buffer_mem2(*m_device, buffer_mem_alloc);
+
+    // The whole buffer is bound to buffer_mem, then its second page is rebound to buffer_mem2.
+    // This splits the first binding, its last part covers pages 2 and 3 but still starts at resource offset 0
+    std::array<VkSparseMemoryBind, 2> buffer_memory_binds = {};
+    buffer_memory_binds[0].size = 4 * page_size;
+    buffer_memory_binds[0].memory = buffer_mem;
+    buffer_memory_binds[1].resourceOffset = page_size;
+    buffer_memory_binds[1].size = page_size;
+    buffer_memory_binds[1].memory = buffer_mem2;
+
+    // buffer_sparse2 is bound to the same memory as the last page of buffer_sparse
+    VkSparseMemoryBind buffer_memory_bind_2 = {};
+    buffer_memory_bind_2.size = page_size;
+    buffer_memory_bind_2.memory = buffer_mem;
+    buffer_memory_bind_2.memoryOffset = 3 * page_size;
+
+    std::array<VkSparseBufferMemoryBindInfo, 2> buffer_memory_bind_infos = {};
+    buffer_memory_bind_infos[0].buffer = buffer_sparse;
+    buffer_memory_bind_infos[0].bindCount = size32(buffer_memory_binds);
+    buffer_memory_bind_infos[0].pBinds = buffer_memory_binds.data();
+    buffer_memory_bind_infos[1].buffer = buffer_sparse2;
+    buffer_memory_bind_infos[1].bindCount = 1;
+    buffer_memory_bind_infos[1].pBinds = &buffer_memory_bind_2;
+
+    VkBindSparseInfo bind_info = vku::InitStructHelper();
+    bind_info.bufferBindCount = size32(buffer_memory_bind_infos);
+    bind_info.pBufferBinds = buffer_memory_bind_infos.data();
+    bind_info.signalSemaphoreCount = 1;
+    bind_info.pSignalSemaphores = &semaphore.handle();
+
+    VkQueue sparse_queue = m_device->QueuesWithSparseCapability()[0]->handle();
+    vkt::Fence sparse_queue_fence(*m_device);
+    vk::QueueBindSparse(sparse_queue, 1, &bind_info, sparse_queue_fence);
+    ASSERT_EQ(VK_SUCCESS, sparse_queue_fence.Wait(kWaitTimeout));
+    // Set up complete
+
+    VkBufferCopy copy_info;
+    copy_info.srcOffset = 3 * page_size;
+    copy_info.dstOffset = 0;
+    copy_info.size = page_size;
+
+    m_command_buffer.Begin();
+    // The last page of buffer_sparse and buffer_sparse2 are both bound to the last page of buffer_mem
+    vk::CmdCopyBuffer(m_command_buffer, buffer_sparse, buffer_sparse2, 1, &copy_info);
+    m_command_buffer.End();
+
+    // Submitting copy command with overlapping device memory regions
+    VkPipelineStageFlags mask = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+    VkSubmitInfo submit_info = vku::InitStructHelper();
+    submit_info.waitSemaphoreCount = 1;
+    submit_info.pWaitSemaphores = &semaphore.handle();
+    submit_info.pWaitDstStageMask = &mask;
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &m_command_buffer.handle();
+
+    m_errorMonitor->SetDesiredError("VUID-vkCmdCopyBuffer-pRegions-00117");
+    vk::QueueSubmit(m_default_queue->handle(), 1, &submit_info, VK_NULL_HANDLE);
+    m_errorMonitor->VerifyFound();
+
+    // Wait for operations to finish before destroying anything
+    m_default_queue->Wait();
+}
+
 TEST_F(NegativeSparseBuffer, BufferFlagsFeature) {
     TEST_DESCRIPTION("Create buffers with Flags that require disabled sparse features");
 
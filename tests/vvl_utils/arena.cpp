@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "containers/arena.h"
+
+TEST(UtilsArena, Alignment) {
+    vvl::Arena arena(256);
+    for (size_t alignment : {1, 2, 4, 8, 16, 32, 64}) {
+        arena.Allocate(1, 1);
+        void *ptr = arena.Allocate(3, alignment);
+        EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % alignment);
+    }
+}
+
+TEST(UtilsArena, DistinctAllocations) {
+    vvl::Arena arena(128);
+    std::vector<uint32_t *> values;
+    for (uint32_t i = 0; i < 1000; ++i) {
+        values.emplace_back(arena.New<uint32_t>(i));
+    }
+    // Spans many blocks, nothing was overwritten
+    for (uint32_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(i, *values[i]);
+    }
+    EXPECT_EQ(1000 * sizeof(uint32_t), arena.AllocatedBytes());
+    EXPECT_GE(arena.ReservedBytes(), arena.AllocatedBytes());
+}
+
+TEST(UtilsArena, LargerThanBlock) {
+    vvl::Arena arena(64);
+    uint8_t *small = static_cast<uint8_t *>(arena.Allocate(16));
+    uint8_t *large = static_cast<uint8_t *>(arena.Allocate(1000));
+    std::memset(small, 1, 16);
+    std::memset(large, 2, 1000);
+    EXPECT_EQ(1, small[15]);
+    EXPECT_EQ(2, large[999]);
+}
+
+TEST(UtilsArena, Reset) {
+    vvl::Arena arena;
+    arena.New<uint64_t>(1);
+    arena.Reset();
+    EXPECT_EQ(0u, arena.AllocatedBytes());
+    EXPECT_EQ(0u, arena.ReservedBytes());
+    EXPECT_EQ(7u, *arena.New<uint64_t>(7));
+}
+
+TEST(UtilsArena, BlockCache) {
+    auto block_cache = std::make_shared<vvl::ArenaBlockCache>(256, 256, 1024);
+    std::vector<void *> first_blocks;
+    {
+        vvl::Arena arena(block_cache);
+        for (uint32_t i = 0; i < 4; ++i) {
+            first_blocks.emplace_back(arena.Allocate(200, 1));
+        }
+        // Too large for the cache, comes from the heap
+        arena.Allocate(1000);
+        EXPECT_EQ(0u, block_cache->CachedBytes());
+    }
+    EXPECT_EQ(1024u, block_cache->CachedBytes());
+
+    // The blocks are reused, nothing new is taken from the heap
+    vvl::Arena arena(block_cache);
+    for (uint32_t i = 0; i < 4; ++i) {
+        void *ptr = arena.Allocate(200, 1);
+        EXPECT_NE(first_blocks.end(), std::find(first_blocks.begin(), first_blocks.end(), ptr));
+    }
+    EXPECT_EQ(0u, block_cache->CachedBytes());
+    arena.Reset();
+    EXPECT_EQ(1024u, block_cache->CachedBytes());
+    block_cache->Trim();
+    EXPECT_EQ(0u, block_cache->CachedBytes());
+}
+
+TEST(UtilsArena, BlockCacheGrowingBlocks) {
+    auto block_cache = std::make_shared<vvl::ArenaBlockCache>(64, 256, 4096);
+    vvl::Arena arena(block_cache);
+    // The first block is the smallest one
+    arena.Allocate(16, 1);
+    EXPECT_EQ(64u, arena.ReservedBytes());
+    // Then they double, up to the largest size
+    arena.Allocate(60, 1);
+    EXPECT_EQ(64u + 128u, arena.ReservedBytes());
+    arena.Allocate(120, 1);
+    EXPECT_EQ(64u + 128u + 256u, arena.ReservedBytes());
+    arena.Allocate(250, 1);
+    EXPECT_EQ(64u + 128u + 256u + 256u, arena.ReservedBytes());
+    // Too large for any block, not cached
+    arena.Allocate(1000, 1);
+    EXPECT_EQ(64u + 128u + 256u + 256u + 1001u, arena.ReservedBytes());
+
+    arena.Reset();
+    EXPECT_EQ(64u + 128u + 256u + 256u, block_cache->CachedBytes());
+    // Starts over from the smallest block, taken from the cache
+    arena.Allocate(16, 1);
+    EXPECT_EQ(64u, arena.ReservedBytes());
+    EXPECT_EQ(128u + 256u + 256u, block_cache->CachedBytes());
+}
+
+TEST(UtilsArena, Allocator) {
+    vvl::Arena arena(128);
+    {
+        std::vector<uint32_t, vvl::ArenaAllocator<uint32_t>> values{vvl::ArenaAllocator<uint32_t>(arena)};
+        for (uint32_t i = 0; i < 100; ++i) {
+            values.emplace_back(i);
+        }
+        for (uint32_t i = 0; i < 100; ++i) {
+            ASSERT_EQ(i, values[i]);
+        }
+        auto shared = std::allocate_shared<uint64_t>(vvl::ArenaAllocator<uint64_t>(arena), 7);
+        EXPECT_EQ(7u, *shared);
+    }
+    EXPECT_GE(arena.AllocatedBytes(), 100 * sizeof(uint32_t));
+}
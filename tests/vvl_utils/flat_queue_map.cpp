@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <map>
+#include <memory>
+
+#include "containers/container_utils.h"
+#include "containers/flat_queue_map.h"
+
+template <typename Key, typename T>
+bool HaveSameElements(const vvl::flat_queue_map<Key, T>& flat, const std::map<Key, T>& ref) {
+    if (flat.size() != ref.size()) {
+        return false;
+    }
+    auto ref_it = ref.begin();
+    for (const auto& [key, value] : flat) {
+        if (key != ref_it->first || value != ref_it->second) {
+            return false;
+        }
+        ++ref_it;
+    }
+    return true;
+}
+
+TEST(UtilsCustomContainer, FlatQueueMapAppendAndRetire) {
+    vvl::flat_queue_map<uint64_t, int> map;
+    std::map<uint64_t, int> ref;
+
+    // Queue-like usage: append increasing keys, erase a prefix
+    for (uint64_t round = 0; round < 10; round++) {
+        for (uint64_t i = 0; i < 100; i++) {
+            const uint64_t key = round * 100 + i;
+            map[key] = static_cast<int>(key);
+            ref[key] = static_cast<int>(key);
+        }
+        auto it = map.begin();
+        auto ref_it = ref.begin();
+        for (int i = 0; i < 70; i++) {
+            ++it;
+            ++ref_it;
+        }
+        map.erase(map.begin(), it);
+        ref.erase(ref.begin(), ref_it);
+        ASSERT_TRUE(HaveSameElements(map, ref));
+        ASSERT_EQ(map.begin()->first, ref.begin()->first);
+        ASSERT_EQ(map.rbegin()->first, ref.rbegin()->first);
+    }
+
+    map.erase(map.begin(), map.end());
+    ASSERT_TRUE(map.empty());
+    ASSERT_EQ(map.size(), 0u);
+    ASSERT_EQ(map.begin(), map.end());
+}
+
+TEST(UtilsCustomContainer, FlatQueueMapOutOfOrderInsert) {
+    vvl::flat_queue_map<uint64_t, int> map;
+    std::map<uint64_t, int> ref;
+
+    for (uint64_t key : {10, 20, 30, 40}) {
+        map[key] = 1;
+        ref[key] = 1;
+    }
+    // Dead prefix in front of 30
+    map.erase(map.begin(), map.find(30));
+    ref.erase(ref.begin(), ref.find(30));
+
+    // In front of the first element, in the middle, duplicate
+    for (uint64_t key : {25, 5, 35, 30}) {
+        const bool inserted = map.insert({key, 2}).second;
+        const bool ref_inserted = ref.insert({key, 2}).second;
+        ASSERT_EQ(inserted, ref_inserted);
+    }
+    ASSERT_TRUE(HaveSameElements(map, ref));
+
+    ASSERT_TRUE(vvl::Contains(map, uint64_t(35)));
+    ASSERT_FALSE(vvl::Contains(map, uint64_t(20)));
+    ASSERT_FALSE(vvl::Contains(map, uint64_t(100)));
+    ASSERT_EQ(vvl::Find(map, uint64_t(30)), &map.find(30)->second);
+    ASSERT_EQ(vvl::Find(map, uint64_t(31)), nullptr);
+}
+
+TEST(UtilsCustomContainer, FlatQueueMapEraseReleasesValues) {
+    vvl::flat_queue_map<uint64_t, std::shared_ptr<int>> map;
+    auto value = std::make_shared<int>(0);
+
+    for (uint64_t key = 0; key < 8; key++) {
+        map[key] = value;
+    }
+    ASSERT_EQ(value.use_count(), 9);
+
+    // Erased elements must not keep their resources alive even if their slots are not compacted yet
+    map.erase(map.begin(), map.find(4));
+    ASSERT_EQ(value.use_count(), 5);
+    map.erase(map.find(6));
+    ASSERT_EQ(value.use_count(), 4);
+    map.erase(map.begin(), map.end());
+    ASSERT_EQ(value.use_count(), 1);
+}
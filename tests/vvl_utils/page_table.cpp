@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <map>
+#include <random>
+
+#include "containers/page_table.h"
+
+using PageTable = vvl::PageTable<uint32_t>;
+
+struct PageRun {
+    uint64_t begin;
+    uint64_t end;
+    uint32_t value;
+    bool operator==(const PageRun &other) const { return begin == other.begin && end == other.end && value == other.value; }
+};
+
+static std::vector<PageRun> GetRuns(const PageTable &table, uint64_t begin, uint64_t end) {
+    std::vector<PageRun> runs;
+    table.ForEachRun(begin, end, [&](uint64_t run_begin, uint64_t run_end, uint32_t value) {
+        runs.emplace_back(PageRun{run_begin, run_end, value});
+    });
+    return runs;
+}
+
+static auto IgnoreReplaced = [](uint32_t, uint64_t) {};
+
+TEST(UtilsPageTable, Empty) {
+    PageTable table(4000);
+    EXPECT_EQ(0u, table.Get(0));
+    EXPECT_EQ(0u, table.Get(3999));
+    const std::vector<PageRun> expected = {{0, 4000, 0}};
+    EXPECT_EQ(expected, GetRuns(table, 0, 4000));
+    EXPECT_TRUE(GetRuns(table, 10, 10).empty());
+}
+
+TEST(UtilsPageTable, SetAndGet) {
+    PageTable table(2000);
+    table.Set(10, 20, 1, IgnoreReplaced);
+    table.Set(15, 600, 2, IgnoreReplaced);
+    table.Set(1024, 1536, 3, IgnoreReplaced);
+
+    EXPECT_EQ(0u, table.Get(9));
+    EXPECT_EQ(1u, table.Get(10));
+    EXPECT_EQ(1u, table.Get(14));
+    EXPECT_EQ(2u, table.Get(15));
+    EXPECT_EQ(2u, table.Get(599));
+    EXPECT_EQ(0u, table.Get(600));
+    EXPECT_EQ(3u, table.Get(1024));
+    EXPECT_EQ(3u, table.Get(1535));
+    EXPECT_EQ(0u, table.Get(1536));
+
+    // Runs crossing leaves are reported once
+    const std::vector<PageRun> expected = {{0, 10, 0},     {10, 15, 1},     {15, 600, 2},
+                                           {600, 1024, 0}, {1024, 1536, 3}, {1536, 2000, 0}};
+    EXPECT_EQ(expected, GetRuns(table, 0, 2000));
+
+    const std::vector<PageRun> clipped = {{12, 15, 1}, {15, 100, 2}};
+    EXPECT_EQ(clipped, GetRuns(table, 12, 100));
+}
+
+TEST(UtilsPageTable, Replaced) {
+    PageTable table(3 * PageTable::kLeafSize);
+    table.Set(0, 3 * PageTable::kLeafSize, 1, IgnoreReplaced);
+    table.Set(100, 200, 2, IgnoreReplaced);
+
+    std::map<uint32_t, uint64_t> replaced;
+    auto count_replaced = [&](uint32_t value, uint64_t count) { replaced[value] += count; };
+    table.Set(50, 2 * PageTable::kLeafSize, 3, count_replaced);
+
+    const std::map<uint32_t, uint64_t> expected = {{1, 2 * PageTable::kLeafSize - 50 - 100}, {2, 100}};
+    EXPECT_EQ(expected, replaced);
+
+    // Setting the same value doesn't replace anything
+    replaced.clear();
+    table.Set(60, 70, 3, count_replaced);
+    EXPECT_TRUE(replaced.empty());
+}
+
+TEST(UtilsPageTable, PastTheEnd) {
+    PageTable table(100);
+    table.Set(90, 200, 1, IgnoreReplaced);
+    const std::vector<PageRun> expected = {{0, 90, 0}, {90, 100, 1}};
+    EXPECT_EQ(expected, GetRuns(table, 0, 1000));
+}
+
+TEST(UtilsPageTable, Random) {
+    const uint64_t page_count = 5000;
+    PageTable table(page_count);
+    std::vector<uint32_t> reference(page_count, 0);
+    std::vector<uint64_t> reference_counts(8, 0);
+    reference_counts[0] = page_count;
+    std::vector<uint64_t> counts = reference_counts;
+
+    std::mt19937 generator(2026);
+    std::uniform_int_distribution<uint64_t> page_distribution(0, page_count);
+    std::uniform_int_distribution<uint32_t> value_distribution(0, 7);
+    for (int i = 0; i < 2000; ++i) {
+        uint64_t begin = page_distribution(generator);
+        uint64_t end = page_distribution(generator);
+        if (begin > end) {
+            std::swap(begin, end);
+        }
+        const uint32_t value = value_distribution(generator);
+
+        table.Set(begin, end, value, [&](uint32_t replaced, uint64_t count) {
+            counts[replaced] -= count;
+            counts[value] += count;
+        });
+        for (uint64_t page = begin; page < end; ++page) {
+            --reference_counts[reference[page]];
+            ++reference_counts[value];
+            reference[page] = value;
+        }
+    }
+
+    EXPECT_EQ(reference_counts, counts);
+    for (uint64_t page = 0; page < page_count; ++page) {
+        ASSERT_EQ(reference[page], table.Get(page));
+    }
+    uint64_t next_page = 0;
+    for (const PageRun &run : GetRuns(table, 0, page_count)) {
+        ASSERT_EQ(next_page, run.begin);
+        for (uint64_t page = run.begin; page < run.end; ++page) {
+            ASSERT_EQ(reference[page], run.value);
+        }
+        if (run.end < page_count) {
+            ASSERT_NE(reference[run.end], run.value);
+        }
+        next_page = run.end;
+    }
+    EXPECT_EQ(page_count, next_page);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include "../framework/test_common.h"
+#include <random>
+
+#include "containers/range_sweep.h"
+
+using Range = vvl::range<int64_t>;
+using Pairs = std::vector<std::pair<uint32_t, uint32_t>>;
+
+static auto KeepAll = [](uint32_t, uint32_t) { return true; };
+
+TEST(UtilsRangeSweep, TwoSets) {
+    const std::vector<Range> a = {{0, 4}, {10, 12}, {20, 20}, {3, 11}};
+    const std::vector<Range> b = {{4, 10}, {11, 30}, {-5, 1}};
+
+    // Ranges are half open, {0, 4} and {4, 10} only touch. Empty {20, 20} never intersects.
+    const Pairs expected = {{0, 2}, {1, 1}, {3, 0}};
+    EXPECT_EQ(expected, vvl::GetIntersectingRangePairs(a, b, KeepAll));
+}
+
+TEST(UtilsRangeSweep, SingleSet) {
+    const std::vector<Range> ranges = {{0, 8}, {8, 16}, {4, 12}, {4, 12}, {16, 16}};
+    const Pairs expected = {{0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}};
+    EXPECT_EQ(expected, vvl::GetIntersectingRangePairs(ranges, KeepAll));
+}
+
+TEST(UtilsRangeSweep, Filter) {
+    const std::vector<Range> ranges = {{0, 8}, {0, 8}, {0, 8}};
+    const Pairs expected = {{0, 2}};
+    EXPECT_EQ(expected, vvl::GetIntersectingRangePairs(ranges, [](uint32_t i, uint32_t j) { return (i + j) % 2 == 0; }));
+}
+
+TEST(UtilsRangeSweep, MatchesBruteForce) {
+    std::mt19937 rng(42);
+    auto random_ranges = [&rng](size_t count) {
+        std::vector<Range> ranges(count);
+        for (Range& r : ranges) {
+            const int64_t begin = int64_t(rng() % 100) - 20;
+            // Some of them are empty or invalid
+            r = Range(begin, begin + int64_t(rng() % 30) - 5);
+        }
+        return ranges;
+    };
+
+    for (uint32_t iteration = 0; iteration < 200; iteration++) {
+        const std::vector<Range> a = random_ranges(rng() % 40);
+        const std::vector<Range> b = random_ranges(rng() % 40);
+
+        Pairs expected;
+        for (uint32_t i = 0; i < a.size(); i++) {
+            for (uint32_t j = 0; j < b.size(); j++) {
+                if (a[i].non_empty() && b[j].non_empty() && a[i].intersects(b[j])) {
+                    expected.emplace_back(i, j);
+                }
+            }
+        }
+        ASSERT_EQ(expected, vvl::GetIntersectingRangePairs(a, b, KeepAll));
+
+        Pairs expected_single_set;
+        for (uint32_t i = 0; i < a.size(); i++) {
+            for (uint32_t j = i + 1; j < a.size(); j++) {
+                if (a[i].non_empty() && a[j].non_empty() && a[i].intersects(a[j])) {
+                    expected_single_set.emplace_back(i, j);
+                }
+            }
+        }
+        ASSERT_EQ(expected_single_set, vvl::GetIntersectingRangePairs(a, KeepAll));
+    }
+}